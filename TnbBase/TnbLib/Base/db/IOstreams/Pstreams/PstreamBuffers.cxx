@@ -106,6 +106,40 @@ void tnbLib::PstreamBuffers::finishedSends(labelList& recvSizes, const bool bloc
 }
 
 
+void tnbLib::PstreamBuffers::finishedNeighbourSends
+(
+	const labelUList& neighProcs,
+	labelList& recvSizes,
+	const bool block
+)
+{
+	finishedSendsCalled_ = true;
+
+	if (commsType_ == UPstream::commsTypes::nonBlocking)
+	{
+		Pstream::exchangeSizes(neighProcs, sendBuf_, recvSizes, tag_, comm_);
+
+		Pstream::exchange<DynamicList<char>, char>
+			(
+				sendBuf_,
+				recvSizes,
+				recvBuf_,
+				tag_,
+				comm_,
+				block
+				);
+	}
+	else
+	{
+		FatalErrorInFunction
+			<< "Obtaining sizes not supported in "
+			<< UPstream::commsTypeNames[commsType_] << endl
+			<< " since transfers already in progress. Use non-blocking instead."
+			<< exit(FatalError);
+	}
+}
+
+
 void tnbLib::PstreamBuffers::clear()
 {
 	forAll(sendBuf_, i)
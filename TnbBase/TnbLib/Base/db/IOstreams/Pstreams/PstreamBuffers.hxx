@@ -152,6 +152,17 @@ namespace tnbLib
 		//  non-blocking.
 		FoamBase_EXPORT void finishedSends(labelList& recvSizes, const bool block = true);
 
+		//- Mark all sends as having been done when only the given
+		//  neighbour processors have been sent to. Same as above but the
+		//  sizes are only exchanged with the neighbours. Note: currently
+		//  only valid for non-blocking.
+		FoamBase_EXPORT void finishedNeighbourSends
+		(
+			const labelUList& neighProcs,
+			labelList& recvSizes,
+			const bool block = true
+		);
+
 		//- Clear storage and reset
 		FoamBase_EXPORT void clear();
 
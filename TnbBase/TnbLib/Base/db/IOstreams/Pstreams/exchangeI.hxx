@@ -131,6 +131,74 @@ void tnbLib::Pstream::exchangeSizes
 }
 
 
+template<class Container>
+void tnbLib::Pstream::exchangeSizes
+(
+	const labelUList& neighProcs,
+	const Container& sendBufs,
+	labelList& recvSizes,
+	const int tag,
+	const label comm
+)
+{
+	if (sendBufs.size() != UPstream::nProcs(comm))
+	{
+		FatalErrorInFunction
+			<< "Size of container " << sendBufs.size()
+			<< " does not equal the number of processors "
+			<< UPstream::nProcs(comm)
+			<< tnbLib::abort(FatalError);
+	}
+
+	recvSizes.setSize(sendBufs.size());
+	recvSizes = 0;
+
+	if (UPstream::parRun() && UPstream::nProcs(comm) > 1)
+	{
+		label startOfRequests = Pstream::nRequests();
+
+		labelList sendSizes(neighProcs.size());
+
+		forAll(neighProcs, i)
+		{
+			const label proci = neighProcs[i];
+
+			UIPstream::read
+			(
+				UPstream::commsTypes::nonBlocking,
+				proci,
+				reinterpret_cast<char*>(&recvSizes[proci]),
+				sizeof(label),
+				tag,
+				comm
+			);
+		}
+
+		forAll(neighProcs, i)
+		{
+			const label proci = neighProcs[i];
+
+			sendSizes[i] = sendBufs[proci].size();
+
+			UOPstream::write
+			(
+				UPstream::commsTypes::nonBlocking,
+				proci,
+				reinterpret_cast<const char*>(&sendSizes[i]),
+				sizeof(label),
+				tag,
+				comm
+			);
+		}
+
+		Pstream::waitRequests(startOfRequests);
+	}
+
+	recvSizes[Pstream::myProcNo(comm)] =
+		sendBufs[Pstream::myProcNo(comm)].size();
+}
+
+
 template<class Container, class T>
 void tnbLib::Pstream::exchange
 (
@@ -1,6 +1,7 @@
 #pragma once
 #include <IOstreams.hxx>
 #include <dictionary.hxx> // added by amir
+#include <Switch.hxx>
 
 // * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
 
@@ -13,7 +14,12 @@ void tnbLib::DimensionedField<Type, GeoMesh>::readField
 {
 	dimensions_.reset(dimensionSet(fieldDict.lookup("dimensions")));
 
+	// Fields written without the entry keep the orientation given on
+	// construction
+	oriented_ = fieldDict.lookupOrDefault<Switch>("oriented", oriented_);
+
 	Field<Type> f(fieldDictEntry, fieldDict, GeoMesh::size(mesh_));
+	GeoMesh::readOrder(mesh_, f, oriented_);
 	this->transfer(f);
 }
 
@@ -49,7 +55,8 @@ tnbLib::DimensionedField<Type, GeoMesh>::DimensionedField
 	regIOobject(io),
 	Field<Type>(0),
 	mesh_(mesh),
-	dimensions_(dimless)
+	dimensions_(dimless),
+	oriented_(false)
 {
 	readField(dictionary(readStream(typeName)), fieldDictEntry);
 }
@@ -67,7 +74,8 @@ tnbLib::DimensionedField<Type, GeoMesh>::DimensionedField
 	regIOobject(io),
 	Field<Type>(0),
 	mesh_(mesh),
-	dimensions_(dimless)
+	dimensions_(dimless),
+	oriented_(false)
 {
 	readField(fieldDict, fieldDictEntry);
 }
@@ -83,9 +91,32 @@ bool tnbLib::DimensionedField<Type, GeoMesh>::writeData
 ) const
 {
 	writeEntry(os, "dimensions", dimensions());
+
+	if (oriented_)
+	{
+		writeEntry(os, "oriented", Switch(true));
+	}
+
 	os << nl;
 
-	writeEntry(os, fieldDictEntry, static_cast<const Field<Type>&>(*this));
+	if (GeoMesh::reordered(mesh_))
+	{
+		writeEntry
+		(
+			os,
+			fieldDictEntry,
+			GeoMesh::writeOrder
+			(
+				mesh_,
+				static_cast<const Field<Type>&>(*this),
+				oriented_
+			)
+		);
+	}
+	else
+	{
+		writeEntry(os, fieldDictEntry, static_cast<const Field<Type>&>(*this));
+	}
 
 	// Check state of Ostream
 	os.check
@@ -23,6 +23,7 @@ namespace tnbLib
 	{
 		component(gcf.primitiveFieldRef(), gf.primitiveField(), d);
 		component(gcf.boundaryFieldRef(), gf.boundaryField(), d);
+		gcf.oriented() = gf.oriented();
 	}
 
 
@@ -35,6 +36,7 @@ namespace tnbLib
 	{
 		T(gf.primitiveFieldRef(), gf1.primitiveField());
 		T(gf.boundaryFieldRef(), gf1.boundaryField());
+		gf.oriented() = gf1.oriented();
 	}
 
 
@@ -53,6 +55,7 @@ namespace tnbLib
 	{
 		pow(gf.primitiveFieldRef(), gf1.primitiveField(), r);
 		pow(gf.boundaryFieldRef(), gf1.boundaryField(), r);
+		gf.oriented() = false;
 	}
 
 	template
@@ -133,6 +136,7 @@ namespace tnbLib
 	{
 		sqr(gf.primitiveFieldRef(), gf1.primitiveField());
 		sqr(gf.boundaryFieldRef(), gf1.boundaryField());
+		gf.oriented() = false;
 	}
 
 	template<class Type, template<class> class PatchField, class GeoMesh>
@@ -207,6 +211,7 @@ namespace tnbLib
 	{
 		magSqr(gsf.primitiveFieldRef(), gf.primitiveField());
 		magSqr(gsf.boundaryFieldRef(), gf.boundaryField());
+		gsf.oriented() = false;
 	}
 
 	template<class Type, template<class> class PatchField, class GeoMesh>
@@ -265,6 +270,7 @@ namespace tnbLib
 	{
 		mag(gsf.primitiveFieldRef(), gf.primitiveField());
 		mag(gsf.boundaryFieldRef(), gf.boundaryField());
+		gsf.oriented() = false;
 	}
 
 	template<class Type, template<class> class PatchField, class GeoMesh>
@@ -328,6 +334,7 @@ namespace tnbLib
 	{
 		cmptAv(gcf.primitiveFieldRef(), gf.primitiveField());
 		cmptAv(gcf.boundaryFieldRef(), gf.boundaryField());
+		gcf.oriented() = false;
 	}
 
 	template<class Type, template<class> class PatchField, class GeoMesh>
@@ -534,6 +541,7 @@ namespace tnbLib
 	{
 		tnbLib::max(res.primitiveFieldRef(), gf1.primitiveField(), gf2.primitiveField());
 		tnbLib::max(res.boundaryFieldRef(), gf1.boundaryField(), gf2.boundaryField());
+		res.oriented() = gf1.oriented() || gf2.oriented();
 	}
 
 	template<class Type, template<class> class PatchField, class GeoMesh>
@@ -593,6 +601,7 @@ namespace tnbLib
 	{
 		tnbLib::min(res.primitiveFieldRef(), gf1.primitiveField(), gf2.primitiveField());
 		tnbLib::min(res.boundaryFieldRef(), gf1.boundaryField(), gf2.boundaryField());
+		res.oriented() = gf1.oriented() || gf2.oriented();
 	}
 
 	template<class Type, template<class> class PatchField, class GeoMesh>
@@ -652,6 +661,7 @@ namespace tnbLib
 	{
 		tnbLib::cmptMultiply(res.primitiveFieldRef(), gf1.primitiveField(), gf2.primitiveField());
 		tnbLib::cmptMultiply(res.boundaryFieldRef(), gf1.boundaryField(), gf2.boundaryField());
+		res.oriented() = gf1.oriented() != gf2.oriented();
 	}
 
 	template<class Type, template<class> class PatchField, class GeoMesh>
@@ -711,6 +721,7 @@ namespace tnbLib
 	{
 		tnbLib::cmptDivide(res.primitiveFieldRef(), gf1.primitiveField(), gf2.primitiveField());
 		tnbLib::cmptDivide(res.boundaryFieldRef(), gf1.boundaryField(), gf2.boundaryField());
+		res.oriented() = gf1.oriented() != gf2.oriented();
 	}
 
 	template<class Type, template<class> class PatchField, class GeoMesh>
@@ -769,6 +780,7 @@ namespace tnbLib
 	{
 		tnbLib::max(res.primitiveFieldRef(), dt1.value(), gf2.primitiveField());
 		tnbLib::max(res.boundaryFieldRef(), dt1.value(), gf2.boundaryField());
+		res.oriented() = gf2.oriented();
 	}
 
 	template<class Type, template<class> class PatchField, class GeoMesh>
@@ -814,6 +826,7 @@ namespace tnbLib
 	{
 		tnbLib::max(res.primitiveFieldRef(), gf1.primitiveField(), dt2.value());
 		tnbLib::max(res.boundaryFieldRef(), gf1.boundaryField(), dt2.value());
+		res.oriented() = gf1.oriented();
 	}
 
 	template<class Type, template<class> class PatchField, class GeoMesh>
@@ -857,6 +870,7 @@ namespace tnbLib
 	{
 		tnbLib::min(res.primitiveFieldRef(), dt1.value(), gf2.primitiveField());
 		tnbLib::min(res.boundaryFieldRef(), dt1.value(), gf2.boundaryField());
+		res.oriented() = gf2.oriented();
 	}
 
 	template<class Type, template<class> class PatchField, class GeoMesh>
@@ -902,6 +916,7 @@ namespace tnbLib
 	{
 		tnbLib::min(res.primitiveFieldRef(), gf1.primitiveField(), dt2.value());
 		tnbLib::min(res.boundaryFieldRef(), gf1.boundaryField(), dt2.value());
+		res.oriented() = gf1.oriented();
 	}
 
 	template<class Type, template<class> class PatchField, class GeoMesh>
@@ -945,6 +960,7 @@ namespace tnbLib
 	{
 		tnbLib::cmptMultiply(res.primitiveFieldRef(), dt1.value(), gf2.primitiveField());
 		tnbLib::cmptMultiply(res.boundaryFieldRef(), dt1.value(), gf2.boundaryField());
+		res.oriented() = gf2.oriented();
 	}
 
 	template<class Type, template<class> class PatchField, class GeoMesh>
@@ -990,6 +1006,7 @@ namespace tnbLib
 	{
 		tnbLib::cmptMultiply(res.primitiveFieldRef(), gf1.primitiveField(), dt2.value());
 		tnbLib::cmptMultiply(res.boundaryFieldRef(), gf1.boundaryField(), dt2.value());
+		res.oriented() = gf1.oriented();
 	}
 
 	template<class Type, template<class> class PatchField, class GeoMesh>
@@ -1035,6 +1052,7 @@ namespace tnbLib
 	{
 		tnbLib::cmptDivide(res.primitiveFieldRef(), dt1.value(), gf2.primitiveField());
 		tnbLib::cmptDivide(res.boundaryFieldRef(), dt1.value(), gf2.boundaryField());
+		res.oriented() = gf2.oriented();
 	}
 
 	template<class Type, template<class> class PatchField, class GeoMesh>
@@ -1079,6 +1097,7 @@ namespace tnbLib
 	{
 		tnbLib::cmptDivide(res.primitiveFieldRef(), gf1.primitiveField(), dt2.value());
 		tnbLib::cmptDivide(res.boundaryFieldRef(), gf1.boundaryField(), dt2.value());
+		res.oriented() = gf1.oriented();
 	}
 
 	template<class Type, template<class> class PatchField, class GeoMesh>
@@ -1125,6 +1144,7 @@ namespace tnbLib
 	{
 		tnbLib::negate(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::negate(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = gf1.oriented();
 	}
 
 	template<class Type, template<class> class PatchField, class GeoMesh>
@@ -1153,6 +1173,7 @@ namespace tnbLib
 	{
 		tnbLib::multiply(res.primitiveFieldRef(), gf1.primitiveField(), gf2.primitiveField());
 		tnbLib::multiply(res.boundaryFieldRef(), gf1.boundaryField(), gf2.boundaryField());
+		res.oriented() = gf1.oriented() != gf2.oriented();
 	}
 
 	template<class Type, template<class> class PatchField, class GeoMesh>
@@ -1213,6 +1234,7 @@ namespace tnbLib
 	{
 		tnbLib::multiply(res.primitiveFieldRef(), gf1.primitiveField(), gf2.primitiveField());
 		tnbLib::multiply(res.boundaryFieldRef(), gf1.boundaryField(), gf2.boundaryField());
+		res.oriented() = gf1.oriented() != gf2.oriented();
 	}
 
 	template<class Type, template<class> class PatchField, class GeoMesh>
@@ -1273,6 +1295,7 @@ namespace tnbLib
 	{
 		tnbLib::divide(res.primitiveFieldRef(), gf1.primitiveField(), gf2.primitiveField());
 		tnbLib::divide(res.boundaryFieldRef(), gf1.boundaryField(), gf2.boundaryField());
+		res.oriented() = gf1.oriented() != gf2.oriented();
 	}
 
 	template<class Type, template<class> class PatchField, class GeoMesh>
@@ -1333,6 +1356,7 @@ namespace tnbLib
 	{
 		tnbLib::multiply(res.primitiveFieldRef(), dt1.value(), gf2.primitiveField());
 		tnbLib::multiply(res.boundaryFieldRef(), dt1.value(), gf2.boundaryField());
+		res.oriented() = gf2.oriented();
 	}
 
 	template<class Type, template<class> class PatchField, class GeoMesh>
@@ -1379,6 +1403,7 @@ namespace tnbLib
 	{
 		tnbLib::multiply(res.primitiveFieldRef(), gf1.primitiveField(), dt2.value());
 		tnbLib::multiply(res.boundaryFieldRef(), gf1.boundaryField(), dt2.value());
+		res.oriented() = gf1.oriented();
 	}
 
 	template<class Type, template<class> class PatchField, class GeoMesh>
@@ -1423,6 +1448,7 @@ namespace tnbLib
 	{
 		tnbLib::divide(res.primitiveFieldRef(), gf1.primitiveField(), dt2.value());
 		tnbLib::divide(res.boundaryFieldRef(), gf1.boundaryField(), dt2.value());
+		res.oriented() = gf1.oriented();
 	}
 
 	template<class Type, template<class> class PatchField, class GeoMesh>
@@ -1831,6 +1857,7 @@ namespace tnbLib
 	{
 		tnbLib::add(gf.primitiveFieldRef(), gf1.primitiveField(), gf2.primitiveField());
 		tnbLib::add(gf.boundaryFieldRef(), gf1.boundaryField(), gf2.boundaryField());
+		gf.oriented() = gf1.oriented() || gf2.oriented();
 	}
 
 	template <class Type1, class Type2, template<class> class PatchField, class GeoMesh>
@@ -1896,6 +1923,7 @@ namespace tnbLib
 	{
 		tnbLib::add(gf.primitiveFieldRef(), gf1.primitiveField(), dvs.value());
 		tnbLib::add(gf.boundaryFieldRef(), gf1.boundaryField(), dvs.value());
+		gf.oriented() = gf1.oriented();
 	}
 
 	template <class Form, class Type, template<class> class PatchField, class GeoMesh>
@@ -1944,6 +1972,7 @@ namespace tnbLib
 	{
 		tnbLib::add(gf.primitiveFieldRef(), dvs.value(), gf1.primitiveField());
 		tnbLib::add(gf.boundaryFieldRef(), dvs.value(), gf1.boundaryField());
+		gf.oriented() = gf1.oriented();
 	}
 
 	template <class Form, class Type, template<class> class PatchField, class GeoMesh>
@@ -1993,6 +2022,7 @@ namespace tnbLib
 	{
 		tnbLib::subtract(gf.primitiveFieldRef(), gf1.primitiveField(), gf2.primitiveField());
 		tnbLib::subtract(gf.boundaryFieldRef(), gf1.boundaryField(), gf2.boundaryField());
+		gf.oriented() = gf1.oriented() || gf2.oriented();
 	}
 
 	template <class Type1, class Type2, template<class> class PatchField, class GeoMesh>
@@ -2058,6 +2088,7 @@ namespace tnbLib
 	{
 		tnbLib::subtract(gf.primitiveFieldRef(), gf1.primitiveField(), dvs.value());
 		tnbLib::subtract(gf.boundaryFieldRef(), gf1.boundaryField(), dvs.value());
+		gf.oriented() = gf1.oriented();
 	}
 
 	template <class Form, class Type, template<class> class PatchField, class GeoMesh>
@@ -2106,6 +2137,7 @@ namespace tnbLib
 	{
 		tnbLib::subtract(gf.primitiveFieldRef(), dvs.value(), gf1.primitiveField());
 		tnbLib::subtract(gf.boundaryFieldRef(), dvs.value(), gf1.boundaryField());
+		gf.oriented() = gf1.oriented();
 	}
 
 	template <class Form, class Type, template<class> class PatchField, class GeoMesh>
@@ -2156,6 +2188,7 @@ namespace tnbLib
 	{
 		tnbLib::outer(gf.primitiveFieldRef(), gf1.primitiveField(), gf2.primitiveField());
 		tnbLib::outer(gf.boundaryFieldRef(), gf1.boundaryField(), gf2.boundaryField());
+		gf.oriented() = gf1.oriented() != gf2.oriented();
 	}
 
 	template <class Type1, class Type2, template<class> class PatchField, class GeoMesh>
@@ -2221,6 +2254,7 @@ namespace tnbLib
 	{
 		tnbLib::outer(gf.primitiveFieldRef(), gf1.primitiveField(), dvs.value());
 		tnbLib::outer(gf.boundaryFieldRef(), gf1.boundaryField(), dvs.value());
+		gf.oriented() = gf1.oriented();
 	}
 
 	template <class Form, class Type, template<class> class PatchField, class GeoMesh>
@@ -2269,6 +2303,7 @@ namespace tnbLib
 	{
 		tnbLib::outer(gf.primitiveFieldRef(), dvs.value(), gf1.primitiveField());
 		tnbLib::outer(gf.boundaryFieldRef(), dvs.value(), gf1.boundaryField());
+		gf.oriented() = gf1.oriented();
 	}
 
 	template <class Form, class Type, template<class> class PatchField, class GeoMesh>
@@ -2318,6 +2353,7 @@ namespace tnbLib
 	{
 		tnbLib::cross(gf.primitiveFieldRef(), gf1.primitiveField(), gf2.primitiveField());
 		tnbLib::cross(gf.boundaryFieldRef(), gf1.boundaryField(), gf2.boundaryField());
+		gf.oriented() = gf1.oriented() != gf2.oriented();
 	}
 
 	template <class Type1, class Type2, template<class> class PatchField, class GeoMesh>
@@ -2383,6 +2419,7 @@ namespace tnbLib
 	{
 		tnbLib::cross(gf.primitiveFieldRef(), gf1.primitiveField(), dvs.value());
 		tnbLib::cross(gf.boundaryFieldRef(), gf1.boundaryField(), dvs.value());
+		gf.oriented() = gf1.oriented();
 	}
 
 	template <class Form, class Type, template<class> class PatchField, class GeoMesh>
@@ -2431,6 +2468,7 @@ namespace tnbLib
 	{
 		tnbLib::cross(gf.primitiveFieldRef(), dvs.value(), gf1.primitiveField());
 		tnbLib::cross(gf.boundaryFieldRef(), dvs.value(), gf1.boundaryField());
+		gf.oriented() = gf1.oriented();
 	}
 
 	template <class Form, class Type, template<class> class PatchField, class GeoMesh>
@@ -2479,6 +2517,7 @@ namespace tnbLib
 	{
 		tnbLib::dot(gf.primitiveFieldRef(), gf1.primitiveField(), gf2.primitiveField());
 		tnbLib::dot(gf.boundaryFieldRef(), gf1.boundaryField(), gf2.boundaryField());
+		gf.oriented() = gf1.oriented() != gf2.oriented();
 	}
 
 	template <class Type1, class Type2, template<class> class PatchField, class GeoMesh>
@@ -2544,6 +2583,7 @@ namespace tnbLib
 	{
 		tnbLib::dot(gf.primitiveFieldRef(), gf1.primitiveField(), dvs.value());
 		tnbLib::dot(gf.boundaryFieldRef(), gf1.boundaryField(), dvs.value());
+		gf.oriented() = gf1.oriented();
 	}
 
 	template <class Form, class Type, template<class> class PatchField, class GeoMesh>
@@ -2592,6 +2632,7 @@ namespace tnbLib
 	{
 		tnbLib::dot(gf.primitiveFieldRef(), dvs.value(), gf1.primitiveField());
 		tnbLib::dot(gf.boundaryFieldRef(), dvs.value(), gf1.boundaryField());
+		gf.oriented() = gf1.oriented();
 	}
 
 	template <class Form, class Type, template<class> class PatchField, class GeoMesh>
@@ -2641,6 +2682,7 @@ namespace tnbLib
 	{
 		tnbLib::dotdot(gf.primitiveFieldRef(), gf1.primitiveField(), gf2.primitiveField());
 		tnbLib::dotdot(gf.boundaryFieldRef(), gf1.boundaryField(), gf2.boundaryField());
+		gf.oriented() = gf1.oriented() != gf2.oriented();
 	}
 
 	template <class Type1, class Type2, template<class> class PatchField, class GeoMesh>
@@ -2706,6 +2748,7 @@ namespace tnbLib
 	{
 		tnbLib::dotdot(gf.primitiveFieldRef(), gf1.primitiveField(), dvs.value());
 		tnbLib::dotdot(gf.boundaryFieldRef(), gf1.boundaryField(), dvs.value());
+		gf.oriented() = gf1.oriented();
 	}
 
 	template <class Form, class Type, template<class> class PatchField, class GeoMesh>
@@ -2754,6 +2797,7 @@ namespace tnbLib
 	{
 		tnbLib::dotdot(gf.primitiveFieldRef(), dvs.value(), gf1.primitiveField());
 		tnbLib::dotdot(gf.boundaryFieldRef(), dvs.value(), gf1.boundaryField());
+		gf.oriented() = gf1.oriented();
 	}
 
 	template <class Form, class Type, template<class> class PatchField, class GeoMesh>
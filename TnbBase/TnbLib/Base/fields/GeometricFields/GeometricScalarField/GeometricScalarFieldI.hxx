@@ -17,6 +17,7 @@ namespace tnbLib
 	{
 		stabilise(result.primitiveFieldRef(), gsf.primitiveField(), ds.value());
 		stabilise(result.boundaryFieldRef(), gsf.boundaryField(), ds.value());
+		result.oriented() = gsf.oriented();
 	}
 
 
@@ -78,6 +79,7 @@ namespace tnbLib
 	{
 		tnbLib::add(res.primitiveFieldRef(), dt1.value(), gf2.primitiveField());
 		tnbLib::add(res.boundaryFieldRef(), dt1.value(), gf2.boundaryField());
+		res.oriented() = gf2.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -125,6 +127,7 @@ namespace tnbLib
 	{
 		tnbLib::add(res.primitiveFieldRef(), gf1.primitiveField(), dt2.value());
 		tnbLib::add(res.boundaryFieldRef(), gf1.boundaryField(), dt2.value());
+		res.oriented() = gf1.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -170,6 +173,7 @@ namespace tnbLib
 	{
 		tnbLib::subtract(res.primitiveFieldRef(), dt1.value(), gf2.primitiveField());
 		tnbLib::subtract(res.boundaryFieldRef(), dt1.value(), gf2.boundaryField());
+		res.oriented() = gf2.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -217,6 +221,7 @@ namespace tnbLib
 	{
 		tnbLib::subtract(res.primitiveFieldRef(), gf1.primitiveField(), dt2.value());
 		tnbLib::subtract(res.boundaryFieldRef(), gf1.boundaryField(), dt2.value());
+		res.oriented() = gf1.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -263,6 +268,7 @@ namespace tnbLib
 	{
 		tnbLib::multiply(res.primitiveFieldRef(), gf1.primitiveField(), gf2.primitiveField());
 		tnbLib::multiply(res.boundaryFieldRef(), gf1.boundaryField(), gf2.boundaryField());
+		res.oriented() = gf1.oriented() != gf2.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -325,6 +331,7 @@ namespace tnbLib
 	{
 		tnbLib::divide(res.primitiveFieldRef(), gf1.primitiveField(), gf2.primitiveField());
 		tnbLib::divide(res.boundaryFieldRef(), gf1.boundaryField(), gf2.boundaryField());
+		res.oriented() = gf1.oriented() != gf2.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -388,6 +395,7 @@ namespace tnbLib
 	{
 		tnbLib::divide(res.primitiveFieldRef(), dt1.value(), gf2.primitiveField());
 		tnbLib::divide(res.boundaryFieldRef(), dt1.value(), gf2.boundaryField());
+		res.oriented() = gf2.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -442,6 +450,7 @@ namespace tnbLib
 	{
 		pow(Pow.primitiveFieldRef(), gsf1.primitiveField(), gsf2.primitiveField());
 		pow(Pow.boundaryFieldRef(), gsf1.boundaryField(), gsf2.boundaryField());
+		Pow.oriented() = false;
 	}
 
 
@@ -618,6 +627,7 @@ namespace tnbLib
 	{
 		pow(tPow.primitiveFieldRef(), gsf.primitiveField(), ds.value());
 		pow(tPow.boundaryFieldRef(), gsf.boundaryField(), ds.value());
+		tPow.oriented() = false;
 	}
 
 
@@ -714,6 +724,7 @@ namespace tnbLib
 	{
 		pow(tPow.primitiveFieldRef(), ds.value(), gsf.primitiveField());
 		pow(tPow.boundaryFieldRef(), ds.value(), gsf.boundaryField());
+		tPow.oriented() = false;
 	}
 
 
@@ -837,6 +848,7 @@ namespace tnbLib
 			gsf1.boundaryField(),
 			gsf2.boundaryField()
 		);
+		Atan2.oriented() = false;
 	}
 
 
@@ -957,6 +969,7 @@ namespace tnbLib
 	{
 		atan2(tAtan2.primitiveFieldRef(), gsf.primitiveField(), ds.value());
 		atan2(tAtan2.boundaryFieldRef(), gsf.boundaryField(), ds.value());
+		tAtan2.oriented() = false;
 	}
 
 
@@ -1039,6 +1052,7 @@ namespace tnbLib
 	{
 		atan2(tAtan2.primitiveFieldRef(), ds.value(), gsf.primitiveField());
 		atan2(tAtan2.boundaryFieldRef(), ds.value(), gsf.boundaryField());
+		tAtan2.oriented() = false;
 	}
 
 
@@ -1119,6 +1133,7 @@ namespace tnbLib
 	{
 		tnbLib::pow3(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::pow3(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1147,6 +1162,7 @@ namespace tnbLib
 	{
 		tnbLib::pow4(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::pow4(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1175,6 +1191,7 @@ namespace tnbLib
 	{
 		tnbLib::pow5(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::pow5(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1203,6 +1220,7 @@ namespace tnbLib
 	{
 		tnbLib::pow6(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::pow6(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1231,6 +1249,7 @@ namespace tnbLib
 	{
 		tnbLib::pow025(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::pow025(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1260,6 +1279,7 @@ namespace tnbLib
 	{
 		tnbLib::sqrt(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::sqrt(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1288,6 +1308,7 @@ namespace tnbLib
 	{
 		tnbLib::cbrt(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::cbrt(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1316,6 +1337,7 @@ namespace tnbLib
 	{
 		tnbLib::sign(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::sign(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = gf1.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1344,6 +1366,7 @@ namespace tnbLib
 	{
 		tnbLib::pos(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::pos(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = gf1.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1372,6 +1395,7 @@ namespace tnbLib
 	{
 		tnbLib::pos0(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::pos0(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = gf1.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1400,6 +1424,7 @@ namespace tnbLib
 	{
 		tnbLib::neg(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::neg(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = gf1.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1428,6 +1453,7 @@ namespace tnbLib
 	{
 		tnbLib::neg0(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::neg0(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = gf1.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1456,6 +1482,7 @@ namespace tnbLib
 	{
 		tnbLib::posPart(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::posPart(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = gf1.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1485,6 +1512,7 @@ namespace tnbLib
 	{
 		tnbLib::negPart(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::negPart(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = gf1.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1514,6 +1542,7 @@ namespace tnbLib
 	{
 		tnbLib::exp(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::exp(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1542,6 +1571,7 @@ namespace tnbLib
 	{
 		tnbLib::log(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::log(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1570,6 +1600,7 @@ namespace tnbLib
 	{
 		tnbLib::log10(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::log10(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1599,6 +1630,7 @@ namespace tnbLib
 	{
 		tnbLib::sin(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::sin(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1627,6 +1659,7 @@ namespace tnbLib
 	{
 		tnbLib::cos(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::cos(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1655,6 +1688,7 @@ namespace tnbLib
 	{
 		tnbLib::tan(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::tan(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1683,6 +1717,7 @@ namespace tnbLib
 	{
 		tnbLib::asin(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::asin(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1712,6 +1747,7 @@ namespace tnbLib
 	{
 		tnbLib::acos(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::acos(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1741,6 +1777,7 @@ namespace tnbLib
 	{
 		tnbLib::atan(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::atan(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1770,6 +1807,7 @@ namespace tnbLib
 	{
 		tnbLib::sinh(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::sinh(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1799,6 +1837,7 @@ namespace tnbLib
 	{
 		tnbLib::cosh(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::cosh(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1828,6 +1867,7 @@ namespace tnbLib
 	{
 		tnbLib::tanh(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::tanh(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1857,6 +1897,7 @@ namespace tnbLib
 	{
 		tnbLib::asinh(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::asinh(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1886,6 +1927,7 @@ namespace tnbLib
 	{
 		tnbLib::acosh(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::acosh(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1915,6 +1957,7 @@ namespace tnbLib
 	{
 		tnbLib::atanh(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::atanh(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1944,6 +1987,7 @@ namespace tnbLib
 	{
 		tnbLib::erf(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::erf(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -1972,6 +2016,7 @@ namespace tnbLib
 	{
 		tnbLib::erfc(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::erfc(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -2001,6 +2046,7 @@ namespace tnbLib
 	{
 		tnbLib::lgamma(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::lgamma(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -2030,6 +2076,7 @@ namespace tnbLib
 	{
 		tnbLib::j0(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::j0(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -2058,6 +2105,7 @@ namespace tnbLib
 	{
 		tnbLib::j1(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::j1(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -2086,6 +2134,7 @@ namespace tnbLib
 	{
 		tnbLib::y0(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::y0(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -2114,6 +2163,7 @@ namespace tnbLib
 	{
 		tnbLib::y1(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::y1(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -2223,6 +2273,7 @@ namespace tnbLib
 	{
 		jn(gsf.primitiveFieldRef(), n, gsf1.primitiveField());
 		jn(gsf.boundaryFieldRef(), n, gsf1.boundaryField());
+		gsf.oriented() = false;
 	}
 
 	template <template<class> class PatchField, class GeoMesh>
@@ -2254,6 +2305,7 @@ namespace tnbLib
 	{
 		yn(gsf.primitiveFieldRef(), n, gsf1.primitiveField());
 		yn(gsf.boundaryFieldRef(), n, gsf1.boundaryField());
+		gsf.oriented() = false;
 	}
 
 	template <template<class> class PatchField, class GeoMesh>
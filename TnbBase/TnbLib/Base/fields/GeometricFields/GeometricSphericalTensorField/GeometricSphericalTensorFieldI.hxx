@@ -14,6 +14,7 @@ namespace tnbLib
 	{
 		tnbLib::tr(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::tr(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -45,6 +46,7 @@ namespace tnbLib
 	{
 		tnbLib::sph(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::sph(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -77,6 +79,7 @@ namespace tnbLib
 	{
 		tnbLib::det(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::det(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -107,6 +110,7 @@ namespace tnbLib
 	{
 		tnbLib::inv(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::inv(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -141,6 +145,7 @@ namespace tnbLib
 	{
 		tnbLib::divide(res.primitiveFieldRef(), gf1.primitiveField(), gf2.primitiveField());
 		tnbLib::divide(res.boundaryFieldRef(), gf1.boundaryField(), gf2.boundaryField());
+		res.oriented() = gf1.oriented() != gf2.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -205,6 +210,7 @@ namespace tnbLib
 	{
 		tnbLib::divide(res.primitiveFieldRef(), dt1.value(), gf2.primitiveField());
 		tnbLib::divide(res.boundaryFieldRef(), dt1.value(), gf2.boundaryField());
+		res.oriented() = gf2.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -255,6 +261,7 @@ namespace tnbLib
 	{
 		tnbLib::divide(res.primitiveFieldRef(), gf1.primitiveField(), dt2.value());
 		tnbLib::divide(res.boundaryFieldRef(), gf1.boundaryField(), dt2.value());
+		res.oriented() = gf1.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
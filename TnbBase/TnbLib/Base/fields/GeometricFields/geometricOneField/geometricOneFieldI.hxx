@@ -7,6 +7,12 @@ inline const tnbLib::dimensionSet& tnbLib::geometricOneField::dimensions() const
 }
 
 
+inline bool tnbLib::geometricOneField::oriented() const
+{
+	return false;
+}
+
+
 inline tnbLib::one tnbLib::geometricOneField::operator[](const label) const
 {
 	return one();
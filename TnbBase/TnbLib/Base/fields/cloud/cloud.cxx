@@ -1,6 +1,8 @@
 #include <cloud.hxx>
 
 #include <Time.hxx>
+#include <tnbDebug.hxx>
+#include <registerSwitch.hxx>
 
 // * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
 
@@ -12,6 +14,17 @@ namespace tnbLib
 	word cloud::defaultName("defaultCloud");
 }
 
+int tnbLib::cloud::sortInterval
+(
+	tnbLib::debug::optimisationSwitch("cloudSortInterval", 0)
+);
+registerOptSwitch
+(
+	"cloudSortInterval",
+	int,
+	tnbLib::cloud::sortInterval
+);
+
 
 // * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
 
@@ -46,4 +59,22 @@ void tnbLib::cloud::autoMap(const mapPolyMesh&)
 }
 
 
+void tnbLib::cloud::beginDistribute()
+{
+	NotImplemented;
+}
+
+
+void tnbLib::cloud::distribute(const mapDistributePolyMesh&)
+{
+	NotImplemented;
+}
+
+
+void tnbLib::cloud::countParticles(labelList&) const
+{
+	NotImplemented;
+}
+
+
 // ************************************************************************* //
\ No newline at end of file
@@ -0,0 +1,51 @@
+#include <threadLoop.hxx>
+
+#include <tnbDebug.hxx>
+#include <registerSwitch.hxx>
+
+// * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
+
+int tnbLib::threadLoop::nThreads
+(
+	tnbLib::debug::optimisationSwitch("nThreads", 1)
+);
+registerOptSwitch
+(
+	"nThreads",
+	int,
+	tnbLib::threadLoop::nThreads
+);
+
+namespace tnbLib
+{
+	// Index of the thread within the current run. Not a class member as
+	// thread-local data cannot be exported.
+	static thread_local label threadIndex_ = 0;
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+tnbLib::label tnbLib::threadLoop::nThreadsFor
+(
+	const label n,
+	const label minSize
+)
+{
+	return max(label(1), min(label(nThreads), n/max(minSize, label(1))));
+}
+
+
+tnbLib::label tnbLib::threadLoop::threadIndex()
+{
+	return threadIndex_;
+}
+
+
+void tnbLib::threadLoop::setThreadIndex(const label threadi)
+{
+	threadIndex_ = threadi;
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,143 @@
+#pragma once
+#ifndef _threadLoop_Header
+#define _threadLoop_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+	tnbLib::threadLoop
+
+Description
+	Shared-memory threading of loops over independent items.
+
+	The range [0, n) is split into contiguous chunks, one per thread, and
+	the given function is called for each chunk with the thread index and
+	the chunk bounds. The number of threads is set by the nThreads
+	optimisation switch (default 1, i.e. no threads are started):
+
+	\verbatim
+	OptimisationSwitches
+	{
+		nThreads    4;
+	}
+	\endverbatim
+
+	The function must only write to data owned by its chunk or by its
+	thread and must not do any parallel communication. Demand-driven data
+	of shared objects, e.g. mesh addressing, has to be constructed before
+	the loop. Within the function threadIndex() returns the index of the
+	thread, e.g. to select per-thread storage from a function which does
+	not take it as an argument.
+
+	For items of widely varying cost runDynamic hands out blocks of items
+	to the threads as they become free instead of one chunk per thread.
+
+SourceFiles
+	threadLoop.C
+
+\*---------------------------------------------------------------------------*/
+
+#include <label.hxx>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	/*---------------------------------------------------------------------------*\
+							  Class threadLoop Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class threadLoop
+	{
+	public:
+
+		// Static Data
+
+			//- Maximum number of threads
+		static FoamBase_EXPORT int nThreads;
+
+
+		// Static Member Functions
+
+			//- Return the number of threads to use for n items with at least
+			//  minSize items per thread
+		static FoamBase_EXPORT label nThreadsFor
+		(
+			const label n,
+			const label minSize = 1
+		);
+
+		//- Return the index of the calling thread within the current run,
+		//  0 outside of a run
+		static FoamBase_EXPORT label threadIndex();
+
+		//- Set the index of the calling thread
+		static FoamBase_EXPORT void setThreadIndex(const label threadi);
+
+		//- Return the start of the chunk of the given thread
+		static inline label chunkStart
+		(
+			const label n,
+			const label nThreads,
+			const label threadi
+		);
+
+		//- Call f(threadi, start, end) for the chunks of [0, n) on nThreads
+		//  threads and wait for them to finish
+		template<class Function>
+		static void run(const label n, const label nThreads, const Function& f);
+
+		//- As above using nThreadsFor(n, minSize) threads
+		template<class Function>
+		static void run(const label n, const Function& f, const label minSize);
+
+		//- Call f(threadi, start, end) for the blocks of blockSize items of
+		//  [0, n), each taken by the next free thread of
+		//  nThreadsFor(n, blockSize), and wait for them to finish
+		template<class Function>
+		static void runDynamic
+		(
+			const label n,
+			const label blockSize,
+			const Function& f
+		);
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#include <threadLoopI.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_threadLoop_Header
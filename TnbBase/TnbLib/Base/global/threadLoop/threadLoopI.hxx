@@ -0,0 +1,132 @@
+#pragma once
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2018 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Description
+
+\*---------------------------------------------------------------------------*/
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+inline tnbLib::label tnbLib::threadLoop::chunkStart
+(
+	const label n,
+	const label nThreads,
+	const label threadi
+)
+{
+	return label((int64_t(n)*threadi)/nThreads);
+}
+
+
+template<class Function>
+void tnbLib::threadLoop::run
+(
+	const label n,
+	const label nThreads,
+	const Function& f
+)
+{
+	if (nThreads <= 1)
+	{
+		f(0, 0, n);
+		return;
+	}
+
+	std::vector<std::thread> threads;
+	threads.reserve(nThreads - 1);
+
+	for (label threadi = 1; threadi < nThreads; threadi++)
+	{
+		const label start = chunkStart(n, nThreads, threadi);
+		const label end = chunkStart(n, nThreads, threadi + 1);
+
+		threads.push_back
+		(
+			std::thread
+			(
+				[&f, threadi, start, end]()
+				{
+					setThreadIndex(threadi);
+					f(threadi, start, end);
+				}
+			)
+		);
+	}
+
+	// The calling thread does the first chunk
+	f(0, 0, chunkStart(n, nThreads, 1));
+
+	for (std::thread& t : threads)
+	{
+		t.join();
+	}
+}
+
+
+template<class Function>
+void tnbLib::threadLoop::run
+(
+	const label n,
+	const Function& f,
+	const label minSize
+)
+{
+	run(n, nThreadsFor(n, minSize), f);
+}
+
+
+template<class Function>
+void tnbLib::threadLoop::runDynamic
+(
+	const label n,
+	const label blockSize,
+	const Function& f
+)
+{
+	const label size = max(blockSize, label(1));
+	const label nThreads = nThreadsFor(n, size);
+
+	std::atomic<label> next(0);
+
+	run
+	(
+		nThreads,
+		nThreads,
+		[&](const label threadi, const label, const label)
+		{
+			for
+			(
+				label start = next.fetch_add(size);
+				start < n;
+				start = next.fetch_add(size)
+			)
+			{
+				f(threadi, start, min(start + size, n));
+			}
+		}
+	);
+}
+
+
+// ************************************************************************* //
@@ -7,10 +7,12 @@
 #include <globalMeshData.hxx>
 #include <processorPolyPatch.hxx>
 #include <polyMeshTetDecomposition.hxx>
+#include <polyMeshTetTransforms.hxx>
 #include <indexedOctree.hxx>
 #include <treeDataCell.hxx>
 #include <MeshObject.hxx>
 #include <pointMesh.hxx>
+#include <threadLoop.hxx>
 
 #include <PstreamReduceOps.hxx> // added by amir
 #include <SubField.hxx> // added by amir
@@ -211,6 +213,7 @@ tnbLib::polyMesh::polyMesh(const IOobject& io)
 	solutionD_(Zero),
 	tetBasePtIsPtr_(readTetBasePtIs()),
 	cellTreePtr_(nullptr),
+	tetTransformsPtr_(nullptr),
 	pointZones_
 	(
 		IOobject
@@ -407,6 +410,7 @@ tnbLib::polyMesh::polyMesh
 	solutionD_(Zero),
 	tetBasePtIsPtr_(readTetBasePtIs()),
 	cellTreePtr_(nullptr),
+	tetTransformsPtr_(nullptr),
 	pointZones_
 	(
 		IOobject
@@ -561,6 +565,7 @@ tnbLib::polyMesh::polyMesh
 	solutionD_(Zero),
 	tetBasePtIsPtr_(readTetBasePtIs()),
 	cellTreePtr_(nullptr),
+	tetTransformsPtr_(nullptr),
 	pointZones_
 	(
 		IOobject
@@ -884,6 +889,17 @@ tnbLib::polyMesh::cellTree() const
 }
 
 
+const tnbLib::polyMeshTetTransforms& tnbLib::polyMesh::tetTransforms() const
+{
+	if (tetTransformsPtr_.empty())
+	{
+		tetTransformsPtr_.reset(new polyMeshTetTransforms(*this));
+	}
+
+	return tetTransformsPtr_();
+}
+
+
 void tnbLib::polyMesh::addPatches
 (
 	const List<polyPatch*>& p,
@@ -1341,6 +1357,9 @@ tnbLib::tmp<tnbLib::scalarField> tnbLib::polyMesh::movePoints
 	// Cell tree might become invalid
 	cellTreePtr_.clear();
 
+	// Tet transforms are invalid
+	tetTransformsPtr_.clear();
+
 	// Reset valid directions (could change with rotation)
 	geometricD_ = Zero;
 	solutionD_ = Zero;
@@ -1651,4 +1670,99 @@ tnbLib::label tnbLib::polyMesh::findCell
 }
 
 
+void tnbLib::polyMesh::findCells
+(
+	const UList<point>& points,
+	labelList& cells,
+	labelList& tetFaces,
+	labelList& tetPts
+) const
+{
+	// Construct the face-diagonal decomposition on all the processors as it
+	// uses parallel transfers
+	(void)tetBasePtIs();
+
+	cells.setSize(points.size());
+	tetFaces.setSize(points.size());
+	tetPts.setSize(points.size());
+
+	if (nCells() == 0)
+	{
+		cells = -1;
+		tetFaces = -1;
+		tetPts = -1;
+		return;
+	}
+
+	// Construct the demand-driven data of the search before the threads
+	// start
+	const indexedOctree<treeDataCell>& tree = cellTree();
+	(void)this->cells();
+	(void)cellCentres();
+	(void)faceCentres();
+
+	threadLoop::run
+	(
+		points.size(),
+		[&](const label, const label start, const label end)
+		{
+			for (label i = start; i < end; i++)
+			{
+				cells[i] = tree.findInside(points[i]);
+
+				if (cells[i] != -1)
+				{
+					findTetFacePt(cells[i], points[i], tetFaces[i], tetPts[i]);
+
+					// The point is outside the tets of the cell, e.g. on a
+					// warped face
+					if (tetFaces[i] == -1)
+					{
+						cells[i] = -1;
+					}
+				}
+				else
+				{
+					tetFaces[i] = -1;
+					tetPts[i] = -1;
+				}
+			}
+		},
+		100
+	);
+}
+
+
+tnbLib::labelList tnbLib::polyMesh::findNearestCells
+(
+	const UList<point>& points
+) const
+{
+	labelList nearest(points.size(), -1);
+
+	if (nCells() == 0)
+	{
+		return nearest;
+	}
+
+	const indexedOctree<treeDataCell>& tree = cellTree();
+	(void)cellCentres();
+
+	threadLoop::run
+	(
+		points.size(),
+		[&](const label, const label start, const label end)
+		{
+			for (label i = start; i < end; i++)
+			{
+				nearest[i] = tree.findNearest(points[i], sqr(great)).index();
+			}
+		},
+		100
+	);
+
+	return nearest;
+}
+
+
 // ************************************************************************* //
\ No newline at end of file
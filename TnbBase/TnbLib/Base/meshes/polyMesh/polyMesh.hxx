@@ -66,6 +66,7 @@ namespace tnbLib
 	class globalMeshData;
 	class mapPolyMesh;
 	class polyMeshTetDecomposition;
+	class polyMeshTetTransforms;
 	class treeDataCell;
 	template<class Type> class indexedOctree;
 
@@ -156,6 +157,9 @@ namespace tnbLib
 		//- Search tree to allow spatial cell searching
 		mutable autoPtr<indexedOctree<treeDataCell>> cellTreePtr_;
 
+		//- Reverse barycentric transforms of the tets of the cells
+		mutable autoPtr<polyMeshTetTransforms> tetTransformsPtr_;
+
 
 		// Zoning information
 
@@ -403,8 +407,15 @@ namespace tnbLib
 		//- Return the current instance directory for faces
 		FoamBase_EXPORT const fileName& facesInstance() const;
 
-		//- Set the instance for mesh files
-		FoamBase_EXPORT void setInstance(const fileName&);
+		//- Set the instance and the write option for mesh files
+		FoamBase_EXPORT void setInstance
+		(
+			const fileName&,
+			const IOobject::writeOption wOpt = IOobject::AUTO_WRITE
+		);
+
+		//- Set the instance for the points file
+		FoamBase_EXPORT void setPointsInstance(const fileName&);
 
 
 		// Access
@@ -472,6 +483,9 @@ namespace tnbLib
 		//- Return the cell search tree
 		FoamBase_EXPORT const indexedOctree<treeDataCell>& cellTree() const;
 
+		//- Return the cached reverse transforms of the tets of the cells
+		FoamBase_EXPORT const polyMeshTetTransforms& tetTransforms() const;
+
 		//- Return point zone mesh
 		const pointZoneMesh& pointZones() const
 		{
@@ -753,6 +767,24 @@ namespace tnbLib
 			const cellDecomposition = CELL_TETS
 		) const;
 
+		//- Find the cell, tetFacei and tetPti of each of a set of points
+		//  with the cell tree, in parallel. The entries of the points not
+		//  found are set to -1.
+		FoamBase_EXPORT void findCells
+		(
+			const UList<point>& points,
+			labelList& cells,
+			labelList& tetFaces,
+			labelList& tetPts
+		) const;
+
+		//- Return the cell with the nearest centre to each of a set of
+		//  points found with the cell tree, in parallel
+		FoamBase_EXPORT labelList findNearestCells
+		(
+			const UList<point>& points
+		) const;
+
 
 		// Member Operators
 
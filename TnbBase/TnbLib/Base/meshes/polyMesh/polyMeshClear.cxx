@@ -5,6 +5,7 @@
 #include <MeshObject.hxx>
 #include <indexedOctree.hxx>
 #include <treeDataCell.hxx>
+#include <polyMeshTetTransforms.hxx>
 #include <pointMesh.hxx>
 
 // * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
@@ -47,6 +48,9 @@ void tnbLib::polyMesh::clearGeom()
 
 	// Remove the cell tree
 	cellTreePtr_.clear();
+
+	// Remove the tet transforms
+	tetTransformsPtr_.clear();
 }
 
 
@@ -107,6 +111,9 @@ void tnbLib::polyMesh::clearAddressing(const bool isMeshUpdate)
 
 	// Remove the cell tree
 	cellTreePtr_.clear();
+
+	// Remove the tet transforms
+	tetTransformsPtr_.clear();
 }
 
 
@@ -138,6 +145,7 @@ void tnbLib::polyMesh::clearTetBasePtIs()
 	}
 
 	tetBasePtIsPtr_.clear();
+	tetTransformsPtr_.clear();
 }
 
 
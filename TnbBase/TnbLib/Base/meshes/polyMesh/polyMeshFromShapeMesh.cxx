@@ -453,6 +453,7 @@ tnbLib::polyMesh::polyMesh
 	solutionD_(Zero),
 	tetBasePtIsPtr_(nullptr),
 	cellTreePtr_(nullptr),
+	tetTransformsPtr_(nullptr),
 	pointZones_
 	(
 		IOobject
@@ -739,6 +740,7 @@ tnbLib::polyMesh::polyMesh
 	solutionD_(Zero),
 	tetBasePtIsPtr_(nullptr),
 	cellTreePtr_(nullptr),
+	tetTransformsPtr_(nullptr),
 	pointZones_
 	(
 		IOobject
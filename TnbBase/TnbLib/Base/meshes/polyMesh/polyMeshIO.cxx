@@ -2,48 +2,64 @@
 
 #include <Time.hxx>
 #include <cellIOList.hxx>
+#include <polyMeshTetTransforms.hxx>
 
 // * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
 
-void tnbLib::polyMesh::setInstance(const fileName& inst)
+void tnbLib::polyMesh::setInstance
+(
+	const fileName& inst,
+	const IOobject::writeOption wOpt
+)
 {
 	if (debug)
 	{
 		InfoInFunction << "Resetting file instance to " << inst << endl;
 	}
 
-	points_.writeOpt() = IOobject::AUTO_WRITE;
+	points_.writeOpt() = wOpt;
 	points_.instance() = inst;
 
-	faces_.writeOpt() = IOobject::AUTO_WRITE;
+	faces_.writeOpt() = wOpt;
 	faces_.instance() = inst;
 
-	owner_.writeOpt() = IOobject::AUTO_WRITE;
+	owner_.writeOpt() = wOpt;
 	owner_.instance() = inst;
 
-	neighbour_.writeOpt() = IOobject::AUTO_WRITE;
+	neighbour_.writeOpt() = wOpt;
 	neighbour_.instance() = inst;
 
-	boundary_.writeOpt() = IOobject::AUTO_WRITE;
+	boundary_.writeOpt() = wOpt;
 	boundary_.instance() = inst;
 
-	pointZones_.writeOpt() = IOobject::AUTO_WRITE;
+	pointZones_.writeOpt() = wOpt;
 	pointZones_.instance() = inst;
 
-	faceZones_.writeOpt() = IOobject::AUTO_WRITE;
+	faceZones_.writeOpt() = wOpt;
 	faceZones_.instance() = inst;
 
-	cellZones_.writeOpt() = IOobject::AUTO_WRITE;
+	cellZones_.writeOpt() = wOpt;
 	cellZones_.instance() = inst;
 
 	if (tetBasePtIsPtr_.valid())
 	{
-		tetBasePtIsPtr_->writeOpt() = IOobject::AUTO_WRITE;
+		tetBasePtIsPtr_->writeOpt() = wOpt;
 		tetBasePtIsPtr_->instance() = inst;
 	}
 }
 
 
+void tnbLib::polyMesh::setPointsInstance(const fileName& inst)
+{
+	if (debug)
+	{
+		InfoInFunction << "Resetting points instance to " << inst << endl;
+	}
+
+	points_.instance() = inst;
+}
+
+
 tnbLib::polyMesh::readUpdateState tnbLib::polyMesh::readUpdate()
 {
 	if (debug)
@@ -370,6 +386,7 @@ tnbLib::polyMesh::readUpdateState tnbLib::polyMesh::readUpdate()
 
 		// Re-read tet base points
 		tetBasePtIsPtr_ = readTetBasePtIs();
+		tetTransformsPtr_.clear();
 
 
 		if (boundaryChanged)
@@ -429,6 +446,7 @@ tnbLib::polyMesh::readUpdateState tnbLib::polyMesh::readUpdate()
 		{
 			tetBasePtIsPtr_ = newTetBasePtIsPtr;
 		}
+		tetTransformsPtr_.clear();
 
 		// Calculate the geometry for the patches (transformation tensors etc.)
 		boundary_.calcGeometry();
@@ -0,0 +1,88 @@
+#include <polyMeshTetTransforms.hxx>
+
+#include <polyMesh.hxx>
+#include <threadLoop.hxx>
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+tnbLib::polyMeshTetTransforms::polyMeshTetTransforms(const polyMesh& mesh)
+	:
+	faceOwner_(mesh.faceOwner()),
+	ownerStart_(mesh.nFaces()),
+	neighbourStart_(mesh.nInternalFaces())
+{
+	const faceList& fs = mesh.faces();
+	const labelList& own = mesh.faceOwner();
+	const labelList& nei = mesh.faceNeighbour();
+	const labelList& tetBasePtIs = mesh.tetBasePtIs();
+	const pointField& pts = mesh.points();
+	const vectorField& ccs = mesh.cellCentres();
+
+	label nTets = 0;
+
+	forAll(fs, facei)
+	{
+		ownerStart_[facei] = nTets;
+		nTets += fs[facei].nTriangles();
+	}
+
+	forAll(nei, facei)
+	{
+		neighbourStart_[facei] = nTets;
+		nTets += fs[facei].nTriangles();
+	}
+
+	transforms_.setSize(nTets);
+
+	// The tet points are those of tetIndices::faceTriIs, the faces without
+	// a valid base point being decomposed from their first point
+	threadLoop::run
+	(
+		fs.size(),
+		[&](const label, const label start, const label end)
+		{
+			for (label facei = start; facei < end; facei++)
+			{
+				const face& f = fs[facei];
+				const label basePti = max(tetBasePtIs[facei], 0);
+
+				const point& base = pts[f[basePti]];
+
+				for (label tetPti = 1; tetPti < f.size() - 1; tetPti++)
+				{
+					const label facePti = (tetPti + basePti) % f.size();
+
+					const point& a = pts[f[facePti]];
+					const point& b = pts[f[f.fcIndex(facePti)]];
+
+					transform& ownT =
+						transforms_[ownerStart_[facei] + tetPti - 1];
+
+					reverseTransform
+					(
+						barycentricTensor(ccs[own[facei]], base, a, b),
+						ownT.detA,
+						ownT.T
+					);
+
+					if (facei < nei.size())
+					{
+						transform& neiT =
+							transforms_[neighbourStart_[facei] + tetPti - 1];
+
+						reverseTransform
+						(
+							barycentricTensor(ccs[nei[facei]], base, b, a),
+							neiT.detA,
+							neiT.T
+						);
+					}
+				}
+			}
+		},
+		1000
+	);
+}
+
+
+// ************************************************************************* //
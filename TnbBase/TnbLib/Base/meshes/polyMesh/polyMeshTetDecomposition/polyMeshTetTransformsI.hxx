@@ -0,0 +1,52 @@
+#pragma once
+// * * * * * * * * * * * * * Static Member Functions * * * * * * * * * * * * //
+
+inline void tnbLib::polyMeshTetTransforms::reverseTransform
+(
+	const barycentricTensor& A,
+	scalar& detA,
+	barycentricTensor& T
+)
+{
+	const vector ab = A.b() - A.a();
+	const vector ac = A.c() - A.a();
+	const vector ad = A.d() - A.a();
+	const vector bc = A.c() - A.b();
+	const vector bd = A.d() - A.b();
+
+	detA = ab & (ac ^ ad);
+
+	T = barycentricTensor
+	(
+		bd ^ bc,
+		ac ^ ad,
+		ad ^ ab,
+		ab ^ ac
+	);
+}
+
+
+// * * * * * * * * * * * * * * * Member Operators  * * * * * * * * * * * * * //
+
+inline const tnbLib::polyMeshTetTransforms::transform&
+tnbLib::polyMeshTetTransforms::operator()
+(
+	const label celli,
+	const label facei,
+	const label tetPti
+) const
+{
+	return
+		transforms_
+		[
+			(
+				faceOwner_[facei] == celli
+			  ? ownerStart_[facei]
+			  : neighbourStart_[facei]
+			)
+		  + tetPti - 1
+		];
+}
+
+
+// ************************************************************************* //
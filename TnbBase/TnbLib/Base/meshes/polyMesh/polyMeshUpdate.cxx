@@ -34,6 +34,7 @@ Description
 #include <pointMesh.hxx>
 #include <indexedOctree.hxx>
 #include <treeDataCell.hxx>
+#include <polyMeshTetTransforms.hxx>
 
 #include <MeshObject.hxx>
 
@@ -60,6 +61,8 @@ void tnbLib::polyMesh::updateMesh(const mapPolyMesh& mpm)
 	tetBasePtIsPtr_.clear();
 	// Remove the cell tree
 	cellTreePtr_.clear();
+	// Remove the tet transforms
+	tetTransformsPtr_.clear();
 
 	// Update parallel data
 	if (globalMeshDataPtr_.valid())
@@ -45,7 +45,9 @@ tnbLib::primitiveMesh::primitiveMesh()
 	cellCentresPtr_(nullptr),
 	faceCentresPtr_(nullptr),
 	cellVolumesPtr_(nullptr),
-	faceAreasPtr_(nullptr)
+	faceAreasPtr_(nullptr),
+	geomChangedFacesPtr_(nullptr),
+	geomPointsPtr_(nullptr)
 {}
 
 
@@ -85,7 +87,9 @@ tnbLib::primitiveMesh::primitiveMesh
 	cellCentresPtr_(nullptr),
 	faceCentresPtr_(nullptr),
 	cellVolumesPtr_(nullptr),
-	faceAreasPtr_(nullptr)
+	faceAreasPtr_(nullptr),
+	geomChangedFacesPtr_(nullptr),
+	geomPointsPtr_(nullptr)
 {}
 
 
@@ -301,8 +305,14 @@ tnbLib::tmp<tnbLib::scalarField> tnbLib::primitiveMesh::movePoints
 		sweptVols[facei] = f[facei].sweptVol(oldPoints, newPoints);
 	}
 
-	// Force recalculation of all geometric data with new points
-	clearGeom();
+	// Update the geometry of the moved parts of the mesh if it is available,
+	// otherwise force recalculation of all geometric data with new points.
+	// The old-time points are not the base of the update: the mesh may
+	// already have moved within the time step.
+	if (!incrementalGeometry || !updateGeom(newPoints))
+	{
+		clearGeom();
+	}
 
 	return tsweptVols;
 }
@@ -175,6 +175,14 @@ namespace tnbLib
 		//- Face areas
 		mutable vectorField* faceAreasPtr_;
 
+		//- Faces whose geometric coefficients changed in the last
+		//  incremental geometry update (see incrementalGeometry)
+		mutable labelList* geomChangedFacesPtr_;
+
+		//- Points the face and cell geometry was last calculated for,
+		//  the base of the next incremental geometry update
+		mutable pointField* geomPointsPtr_;
+
 
 		// Topological calculations
 
@@ -250,6 +258,15 @@ namespace tnbLib
 			vectorField& fAreas
 		) const;
 
+		//- Calculate the centre and area of a single face
+		static FoamBase_EXPORT void makeFaceCentreAndArea
+		(
+			const face& f,
+			const pointField& p,
+			point& fCtr,
+			vector& fArea
+		);
+
 		//- Calculate cell centres and volumes
 		FoamBase_EXPORT void calcCellCentresAndVols() const;
 		FoamBase_EXPORT void makeCellCentresAndVols
@@ -260,6 +277,13 @@ namespace tnbLib
 			scalarField& cellVols
 		) const;
 
+		//- Update the face and cell geometry of the parts of the mesh that
+		//  moved since the geometry was last calculated, keeping that of
+		//  the static parts. Faces and cells that are purely translated are
+		//  shifted rather than recalculated. Returns false if the geometry
+		//  was not available and hence has to be calculated from scratch.
+		FoamBase_EXPORT bool updateGeom(const pointField& p);
+
 		//- Calculate edge vectors
 		FoamBase_EXPORT void calcEdgeVectors() const;
 
@@ -399,6 +423,11 @@ namespace tnbLib
 		static FoamBase_EXPORT const ::tnbLib::word typeName; 
 		static FoamBase_EXPORT int debug;
 
+		//- Update the geometry of the moving parts of the mesh only on
+		//  movePoints instead of recalculating it from scratch
+		//  (optimisation switch incrementalMeshGeometry)
+		static FoamBase_EXPORT bool incrementalGeometry;
+
 		//- Estimated number of cells per edge
 		static const unsigned cellsPerEdge_ = 4;
 
@@ -592,6 +621,11 @@ namespace tnbLib
 			const pointField& oldP
 		);
 
+		//- Return the faces whose centre, area or neighbouring cell
+		//  geometry changed in the last incremental geometry update.
+		//  Derived face coefficients of all other faces are still valid.
+		FoamBase_EXPORT const labelList& geomChangedFaces() const;
+
 
 		//- Return true if given face label is internal to the mesh
 		inline bool isInternalFace(const label faceIndex) const;
@@ -799,6 +833,7 @@ namespace tnbLib
 		inline bool hasFaceCentres() const;
 		inline bool hasCellVolumes() const;
 		inline bool hasFaceAreas() const;
+		inline bool hasGeomChangedFaces() const;
 
 		// On-the-fly addressing calculation. These functions return either
 		// a reference to the full addressing (if already calculated) or
@@ -95,6 +95,16 @@ void tnbLib::primitiveMesh::printAllocated() const
 		Pout << "    Face-areas" << endl;
 	}
 
+	if (geomChangedFacesPtr_)
+	{
+		Pout << "    Geometry-changed faces" << endl;
+	}
+
+	if (geomPointsPtr_)
+	{
+		Pout << "    Geometry points" << endl;
+	}
+
 }
 
 
@@ -111,6 +121,8 @@ void tnbLib::primitiveMesh::clearGeom()
 	deleteDemandDrivenData(faceCentresPtr_);
 	deleteDemandDrivenData(cellVolumesPtr_);
 	deleteDemandDrivenData(faceAreasPtr_);
+	deleteDemandDrivenData(geomChangedFacesPtr_);
+	deleteDemandDrivenData(geomPointsPtr_);
 }
 
 
@@ -1,5 +1,7 @@
 #include <primitiveMesh.hxx>
 
+#include <demandDrivenData.hxx>
+
 /*---------------------------------------------------------------------------*\
   =========                 |
   \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
@@ -60,6 +62,13 @@ void tnbLib::primitiveMesh::calcFaceCentresAndAreas() const
 
 	makeFaceCentresAndAreas(points(), fCtrs, fAreas);
 
+	// Keep the points for the incremental update after the next motion
+	if (incrementalGeometry)
+	{
+		deleteDemandDrivenData(geomPointsPtr_);
+		geomPointsPtr_ = new pointField(points());
+	}
+
 	if (debug)
 	{
 		Pout << "primitiveMesh::calcFaceCentresAndAreas() : "
@@ -80,55 +89,66 @@ void tnbLib::primitiveMesh::makeFaceCentresAndAreas
 
 	forAll(fs, facei)
 	{
-		const labelList& f = fs[facei];
-		label nPoints = f.size();
+		makeFaceCentreAndArea(fs[facei], p, fCtrs[facei], fAreas[facei]);
+	}
+}
+
+
+void tnbLib::primitiveMesh::makeFaceCentreAndArea
+(
+	const face& f,
+	const pointField& p,
+	point& fCtr,
+	vector& fArea
+)
+{
+	label nPoints = f.size();
+
+	// If the face is a triangle, do a direct calculation for efficiency
+	// and to avoid round-off error-related problems
+	if (nPoints == 3)
+	{
+		fCtr = (1.0 / 3.0)*(p[f[0]] + p[f[1]] + p[f[2]]);
+		fArea = 0.5*((p[f[1]] - p[f[0]]) ^ (p[f[2]] - p[f[0]]));
+	}
+	else
+	{
+		vector sumN = Zero;
+		scalar sumA = 0.0;
+		vector sumAc = Zero;
+
+		point fCentre = p[f[0]];
+		for (label pi = 1; pi < nPoints; pi++)
+		{
+			fCentre += p[f[pi]];
+		}
+
+		fCentre /= nPoints;
+
+		for (label pi = 0; pi < nPoints; pi++)
+		{
+			const point& nextPoint = p[f[(pi + 1) % nPoints]];
+
+			vector c = p[f[pi]] + nextPoint + fCentre;
+			vector n = (nextPoint - p[f[pi]]) ^ (fCentre - p[f[pi]]);
+			scalar a = mag(n);
+
+			sumN += n;
+			sumA += a;
+			sumAc += a * c;
+		}
 
-		// If the face is a triangle, do a direct calculation for efficiency
-		// and to avoid round-off error-related problems
-		if (nPoints == 3)
+		// This is to deal with zero-area faces. Mark very small faces
+		// to be detected in e.g., processorPolyPatch.
+		if (sumA < rootVSmall)
 		{
-			fCtrs[facei] = (1.0 / 3.0)*(p[f[0]] + p[f[1]] + p[f[2]]);
-			fAreas[facei] = 0.5*((p[f[1]] - p[f[0]]) ^ (p[f[2]] - p[f[0]]));
+			fCtr = fCentre;
+			fArea = Zero;
 		}
 		else
 		{
-			vector sumN = Zero;
-			scalar sumA = 0.0;
-			vector sumAc = Zero;
-
-			point fCentre = p[f[0]];
-			for (label pi = 1; pi < nPoints; pi++)
-			{
-				fCentre += p[f[pi]];
-			}
-
-			fCentre /= nPoints;
-
-			for (label pi = 0; pi < nPoints; pi++)
-			{
-				const point& nextPoint = p[f[(pi + 1) % nPoints]];
-
-				vector c = p[f[pi]] + nextPoint + fCentre;
-				vector n = (nextPoint - p[f[pi]]) ^ (fCentre - p[f[pi]]);
-				scalar a = mag(n);
-
-				sumN += n;
-				sumA += a;
-				sumAc += a * c;
-			}
-
-			// This is to deal with zero-area faces. Mark very small faces
-			// to be detected in e.g., processorPolyPatch.
-			if (sumA < rootVSmall)
-			{
-				fCtrs[facei] = fCentre;
-				fAreas[facei] = Zero;
-			}
-			else
-			{
-				fCtrs[facei] = (1.0 / 3.0)*sumAc / sumA;
-				fAreas[facei] = 0.5*sumN;
-			}
+			fCtr = (1.0 / 3.0)*sumAc / sumA;
+			fArea = 0.5*sumN;
 		}
 	}
 }
@@ -0,0 +1,341 @@
+#include <primitiveMesh.hxx>
+
+#include <tnbDebug.hxx>
+#include <registerSwitch.hxx>
+#include <DynamicList.hxx>
+#include <demandDrivenData.hxx>
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Description
+	Incremental update of the face centres and areas and of the cell centres
+	and volumes after mesh motion.
+
+	Faces and cells none of whose points moved keep their geometry. Faces and
+	cells all of whose points moved by the same displacement are shifted.
+	Only the remaining, deforming, faces and cells are recalculated so that
+	the cost scales with the size of the deforming region rather than with
+	the size of the mesh.
+
+\*---------------------------------------------------------------------------*/
+
+// * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
+
+bool tnbLib::primitiveMesh::incrementalGeometry
+(
+	tnbLib::debug::optimisationSwitch("incrementalMeshGeometry", 0)
+);
+registerOptSwitch
+(
+	"incrementalMeshGeometry",
+	bool,
+	tnbLib::primitiveMesh::incrementalGeometry
+);
+
+
+namespace tnbLib
+{
+	// Motion state of a face or cell
+	enum geomMotionState
+	{
+		unmoved,
+		translated,
+		deformed
+	};
+
+	// Return true if the displacements are equal within tol
+	static inline bool sameDisplacement
+	(
+		const vector& d0,
+		const vector& d1,
+		const scalar tol
+	)
+	{
+		return magSqr(d1 - d0) <= sqr(tol);
+	}
+}
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+bool tnbLib::primitiveMesh::updateGeom(const pointField& p)
+{
+	if
+	(
+		!geomPointsPtr_
+	 || geomPointsPtr_->size() < nPoints()
+	 || !faceCentresPtr_
+	 || !faceAreasPtr_
+	 || !cellCentresPtr_
+	 || !cellVolumesPtr_
+	)
+	{
+		return false;
+	}
+
+	if (debug)
+	{
+		Pout << "primitiveMesh::updateGeom(const pointField&) : "
+			<< "Updating geometry of moved faces and cells"
+			<< endl;
+	}
+
+	const faceList& fs = faces();
+	const pointField& oldP = *geomPointsPtr_;
+	const labelList& own = faceOwner();
+	const labelList& nei = faceNeighbour();
+	const cellList& cs = cells();
+
+	vectorField& fCtrs = *faceCentresPtr_;
+	vectorField& fAreas = *faceAreasPtr_;
+	vectorField& cellCtrs = *cellCentresPtr_;
+	scalarField& cellVols = *cellVolumesPtr_;
+
+	// Point displacement and the tolerance on equal displacements, relative
+	// to the round-off in the point positions
+	vectorField pointDisp(nPoints());
+	scalar maxMagP = 0;
+	for (label pointi = 0; pointi < nPoints(); pointi++)
+	{
+		pointDisp[pointi] = p[pointi] - oldP[pointi];
+		maxMagP = max(maxMagP, mag(p[pointi]));
+	}
+	const scalar tol = small * maxMagP;
+
+
+	// Faces
+
+	List<geomMotionState> faceState(nFaces(), unmoved);
+	vectorField faceDisp(nFaces(), Zero);
+	label nDeformedFaces = 0;
+
+	forAll(fs, facei)
+	{
+		const face& f = fs[facei];
+
+		const vector& d0 = pointDisp[f[0]];
+		bool moved = (d0 != vector::zero);
+		bool rigid = true;
+
+		for (label fp = 1; fp < f.size(); fp++)
+		{
+			const vector& d = pointDisp[f[fp]];
+
+			if (d != vector::zero)
+			{
+				moved = true;
+			}
+			if (!sameDisplacement(d0, d, tol))
+			{
+				rigid = false;
+			}
+		}
+
+		if (!moved)
+		{
+			continue;
+		}
+		else if (rigid)
+		{
+			faceState[facei] = translated;
+			faceDisp[facei] = d0;
+			fCtrs[facei] += d0;
+		}
+		else
+		{
+			faceState[facei] = deformed;
+			makeFaceCentreAndArea(f, p, fCtrs[facei], fAreas[facei]);
+			nDeformedFaces++;
+		}
+	}
+
+
+	// Cells
+
+	List<geomMotionState> cellState(nCells(), unmoved);
+	vectorField cellDisp(nCells(), Zero);
+	label nDeformedCells = 0;
+
+	forAll(cs, celli)
+	{
+		const labelList& cFaces = cs[celli];
+
+		bool moved = false;
+		bool rigid = true;
+
+		forAll(cFaces, cFacei)
+		{
+			const label facei = cFaces[cFacei];
+
+			if (faceState[facei] != unmoved)
+			{
+				moved = true;
+			}
+			if
+			(
+				faceState[facei] == deformed
+			 || !sameDisplacement
+				(
+					faceDisp[cFaces[0]],
+					faceDisp[facei],
+					tol
+				)
+			)
+			{
+				rigid = false;
+			}
+		}
+
+		if (!moved)
+		{
+			continue;
+		}
+		else if (rigid)
+		{
+			cellState[celli] = translated;
+			cellDisp[celli] = faceDisp[cFaces[0]];
+			cellCtrs[celli] += cellDisp[celli];
+		}
+		else
+		{
+			cellState[celli] = deformed;
+			nDeformedCells++;
+
+			// Estimated cell centre as the average of the face centres
+			vector cEst = Zero;
+			forAll(cFaces, cFacei)
+			{
+				cEst += fCtrs[cFaces[cFacei]];
+			}
+			cEst /= cFaces.size();
+
+			// Accumulate the face-pyramid volumes and centres as in
+			// makeCellCentresAndVols
+			vector cellCtr = Zero;
+			scalar cellVol = 0;
+
+			forAll(cFaces, cFacei)
+			{
+				const label facei = cFaces[cFacei];
+
+				const scalar pyr3Vol =
+					own[facei] == celli
+				  ? fAreas[facei] & (fCtrs[facei] - cEst)
+				  : fAreas[facei] & (cEst - fCtrs[facei]);
+
+				const vector pc = (3.0 / 4.0)*fCtrs[facei] + (1.0 / 4.0)*cEst;
+
+				cellCtr += pyr3Vol * pc;
+				cellVol += pyr3Vol;
+			}
+
+			cellCtrs[celli] =
+				mag(cellVol) > vSmall ? cellCtr / cellVol : cEst;
+			cellVols[celli] = (1.0 / 3.0)*cellVol;
+		}
+	}
+
+
+	// Faces whose derived coefficients (interpolation weights, deltas etc.)
+	// have to be recalculated: all those next to moving geometry except
+	// those translated together with their cells
+
+	DynamicList<label> changedFaces(nDeformedFaces + nDeformedCells);
+
+	forAll(fs, facei)
+	{
+		const label ownState = cellState[own[facei]];
+		const label neiState =
+			facei < nInternalFaces() ? cellState[nei[facei]] : label(unmoved);
+
+		if
+		(
+			faceState[facei] == unmoved
+		 && ownState == unmoved
+		 && neiState == unmoved
+		)
+		{
+			continue;
+		}
+
+		const bool translatedTogether =
+			faceState[facei] == translated
+		 && ownState == translated
+		 && sameDisplacement(faceDisp[facei], cellDisp[own[facei]], tol)
+		 && (
+				facei >= nInternalFaces()
+			 || (
+					neiState == translated
+				 && sameDisplacement
+					(
+						faceDisp[facei],
+						cellDisp[nei[facei]],
+						tol
+					)
+				)
+			);
+
+		if (!translatedTogether)
+		{
+			changedFaces.append(facei);
+		}
+	}
+
+	deleteDemandDrivenData(geomChangedFacesPtr_);
+	geomChangedFacesPtr_ = new labelList();
+	geomChangedFacesPtr_->transfer(changedFaces);
+
+	// The geometry now corresponds to the new points
+	*geomPointsPtr_ = p;
+
+	if (debug)
+	{
+		Pout << "primitiveMesh::updateGeom(const pointField&) : "
+			<< "Recalculated " << nDeformedFaces << " of " << nFaces()
+			<< " faces and " << nDeformedCells << " of " << nCells()
+			<< " cells; " << geomChangedFacesPtr_->size()
+			<< " faces with changed coefficients" << endl;
+	}
+
+	return true;
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+const tnbLib::labelList& tnbLib::primitiveMesh::geomChangedFaces() const
+{
+	if (!geomChangedFacesPtr_)
+	{
+		FatalErrorInFunction
+			<< "Geometry-changed faces are only available after an "
+			<< "incremental geometry update"
+			<< abort(FatalError);
+	}
+
+	return *geomChangedFacesPtr_;
+}
+
+
+// ************************************************************************* //
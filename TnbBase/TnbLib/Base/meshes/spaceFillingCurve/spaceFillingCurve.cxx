@@ -0,0 +1,169 @@
+#include <spaceFillingCurve.hxx>
+
+#include <boundBox.hxx>
+#include <ListOps.hxx>
+
+// * * * * * * * * * * * * * * * Local Functions * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+	// Number of bits per direction of the curve lattice
+	static const unsigned int sfcBits = 21;
+
+	// Return the lattice coordinates of the point
+	static inline void sfcLattice
+	(
+		const point& pt,
+		const point& min,
+		const scalar span,
+		uint64_t X[3]
+	)
+	{
+		const uint64_t maxX = (uint64_t(1) << sfcBits) - 1;
+
+		for (direction cmpt = 0; cmpt < 3; cmpt++)
+		{
+			const scalar f =
+				span > 0 ? (pt[cmpt] - min[cmpt])/span : 0;
+
+			X[cmpt] = f <= 0 ? 0 : f >= 1 ? maxX : uint64_t(f*(maxX + 1));
+		}
+	}
+
+	// Interleave the bits of the lattice coordinates, most significant
+	// first
+	static inline uint64_t sfcInterleave(const uint64_t X[3])
+	{
+		uint64_t key = 0;
+
+		for (int bit = sfcBits - 1; bit >= 0; bit--)
+		{
+			for (direction cmpt = 0; cmpt < 3; cmpt++)
+			{
+				key = (key << 1) | ((X[cmpt] >> bit) & 1);
+			}
+		}
+
+		return key;
+	}
+
+	// Return the order of the points sorted by the given key function
+	template<class KeyFunction>
+	static labelList sfcOrder
+	(
+		const UList<point>& points,
+		const KeyFunction& keyFunction
+	)
+	{
+		labelList order;
+
+		if (points.empty())
+		{
+			return order;
+		}
+
+		// Local bounds only: the ordering is independent on each processor
+		const boundBox bb(points, false);
+		const scalar span = cmptMax(bb.span());
+
+		List<uint64_t> keys(points.size());
+		forAll(points, pointi)
+		{
+			keys[pointi] = keyFunction(points[pointi], bb.min(), span);
+		}
+
+		sortedOrder(keys, order);
+
+		return order;
+	}
+}
+
+
+// * * * * * * * * * * * * * * * Global Functions  * * * * * * * * * * * * * //
+
+uint64_t tnbLib::hilbertKey
+(
+	const point& pt,
+	const point& min,
+	const scalar span
+)
+{
+	uint64_t X[3];
+	sfcLattice(pt, min, span, X);
+
+	// Transform the lattice coordinates into the transposed Hilbert index
+	// (J. Skilling, Programming the Hilbert curve, AIP Conf. Proc. 707, 2004)
+
+	const uint64_t M = uint64_t(1) << (sfcBits - 1);
+
+	// Inverse undo excess work
+	for (uint64_t Q = M; Q > 1; Q >>= 1)
+	{
+		const uint64_t P = Q - 1;
+
+		for (direction cmpt = 0; cmpt < 3; cmpt++)
+		{
+			if (X[cmpt] & Q)
+			{
+				// Invert
+				X[0] ^= P;
+			}
+			else
+			{
+				// Exchange
+				const uint64_t t = (X[0] ^ X[cmpt]) & P;
+				X[0] ^= t;
+				X[cmpt] ^= t;
+			}
+		}
+	}
+
+	// Gray encode
+	X[1] ^= X[0];
+	X[2] ^= X[1];
+
+	uint64_t t = 0;
+	for (uint64_t Q = M; Q > 1; Q >>= 1)
+	{
+		if (X[2] & Q)
+		{
+			t ^= Q - 1;
+		}
+	}
+
+	for (direction cmpt = 0; cmpt < 3; cmpt++)
+	{
+		X[cmpt] ^= t;
+	}
+
+	return sfcInterleave(X);
+}
+
+
+uint64_t tnbLib::mortonKey
+(
+	const point& pt,
+	const point& min,
+	const scalar span
+)
+{
+	uint64_t X[3];
+	sfcLattice(pt, min, span, X);
+
+	return sfcInterleave(X);
+}
+
+
+tnbLib::labelList tnbLib::hilbertOrder(const UList<point>& points)
+{
+	return sfcOrder(points, hilbertKey);
+}
+
+
+tnbLib::labelList tnbLib::mortonOrder(const UList<point>& points)
+{
+	return sfcOrder(points, mortonKey);
+}
+
+
+// ************************************************************************* //
@@ -34,7 +34,8 @@ namespace tnbLib
 		regIOobject(io),
 		Field<Type>(field),
 		mesh_(mesh),
-		dimensions_(dims)
+		dimensions_(dims),
+		oriented_(false)
 	{
 		if (field.size() && field.size() != GeoMesh::size(mesh))
 		{
@@ -59,7 +60,8 @@ namespace tnbLib
 		regIOobject(io),
 		Field<Type>(GeoMesh::size(mesh)),
 		mesh_(mesh),
-		dimensions_(dims)
+		dimensions_(dims),
+		oriented_(false)
 	{
 		if (checkIOFlags)
 		{
@@ -80,7 +82,8 @@ namespace tnbLib
 		regIOobject(io),
 		Field<Type>(GeoMesh::size(mesh), dt.value()),
 		mesh_(mesh),
-		dimensions_(dt.dimensions())
+		dimensions_(dt.dimensions()),
+		oriented_(false)
 	{
 		if (checkIOFlags)
 		{
@@ -98,7 +101,8 @@ namespace tnbLib
 		regIOobject(df),
 		Field<Type>(df),
 		mesh_(df.mesh_),
-		dimensions_(df.dimensions_)
+		dimensions_(df.dimensions_),
+		oriented_(df.oriented_)
 	{}
 
 
@@ -112,7 +116,8 @@ namespace tnbLib
 		regIOobject(df, reuse),
 		Field<Type>(df, reuse),
 		mesh_(df.mesh_),
-		dimensions_(df.dimensions_)
+		dimensions_(df.dimensions_),
+		oriented_(df.oriented_)
 	{}
 
 
@@ -125,7 +130,8 @@ namespace tnbLib
 		regIOobject(move(df), true),
 		Field<Type>(move(df)),
 		mesh_(df.mesh_),
-		dimensions_(move(df.dimensions_))
+		dimensions_(move(df.dimensions_)),
+		oriented_(df.oriented_)
 	{}
 
 
@@ -142,7 +148,8 @@ namespace tnbLib
 			tdf.isTmp()
 			),
 		mesh_(tdf().mesh_),
-		dimensions_(tdf().dimensions_)
+		dimensions_(tdf().dimensions_),
+		oriented_(tdf().oriented_)
 	{
 		tdf.clear();
 	}
@@ -158,7 +165,8 @@ namespace tnbLib
 		regIOobject(io),
 		Field<Type>(df),
 		mesh_(df.mesh_),
-		dimensions_(df.dimensions_)
+		dimensions_(df.dimensions_),
+		oriented_(df.oriented_)
 	{}
 
 
@@ -173,7 +181,8 @@ namespace tnbLib
 		regIOobject(io, df),
 		Field<Type>(df, reuse),
 		mesh_(df.mesh_),
-		dimensions_(df.dimensions_)
+		dimensions_(df.dimensions_),
+		oriented_(df.oriented_)
 	{}
 
 
@@ -187,7 +196,8 @@ namespace tnbLib
 		regIOobject(newName, df, newName != df.name()),
 		Field<Type>(df),
 		mesh_(df.mesh_),
-		dimensions_(df.dimensions_)
+		dimensions_(df.dimensions_),
+		oriented_(df.oriented_)
 	{}
 
 
@@ -202,7 +212,8 @@ namespace tnbLib
 		regIOobject(newName, df, true),
 		Field<Type>(df, reuse),
 		mesh_(df.mesh_),
-		dimensions_(df.dimensions_)
+		dimensions_(df.dimensions_),
+		oriented_(df.oriented_)
 	{}
 
 
@@ -220,7 +231,8 @@ namespace tnbLib
 			tdf.isTmp()
 			),
 		mesh_(tdf().mesh_),
-		dimensions_(tdf().dimensions_)
+		dimensions_(tdf().dimensions_),
+		oriented_(tdf().oriented_)
 	{
 		tdf.clear();
 	}
@@ -504,6 +516,7 @@ namespace tnbLib
 		};
 
 		dimensions_ = df.dimensions();
+		oriented_ = df.oriented();
 		Field<Type>::operator=(df);
 	}
 
@@ -529,6 +542,7 @@ namespace tnbLib
 		};
 
 		dimensions_ = move(df.dimensions());
+		oriented_ = df.oriented();
 		Field<Type>::operator=(move(df));
 	}
 
@@ -556,6 +570,7 @@ namespace tnbLib
 		};
 
 		dimensions_ = df.dimensions();
+		oriented_ = df.oriented();
 		this->transfer(const_cast<DimensionedField<Type, GeoMesh>&>(df));
 		tdf.clear();
 	}
@@ -640,6 +655,7 @@ namespace tnbLib
 				" during operatrion " << "*=" << abort(FatalError);
 		};
 		dimensions_ *= df.dimensions();
+		oriented_ = oriented_ != df.oriented();
 		Field<Type>::operator *=(df);
 	}
 
@@ -666,6 +682,7 @@ namespace tnbLib
 				" during operatrion " << "/=" << abort(FatalError);
 		};
 		dimensions_ /= df.dimensions();
+		oriented_ = oriented_ != df.oriented();
 		Field<Type>::operator /=(df);
 	}
 
@@ -1374,6 +1374,7 @@ void tnbLib::GeometricField<Type, PatchField, GeoMesh>::operator=
 	// Only assign field contents not ID
 
 	this->dimensions() = gf.dimensions();
+	this->oriented() = gf.oriented();
 
 	if (tgf.isTmp())
 	{
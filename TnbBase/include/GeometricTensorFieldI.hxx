@@ -14,6 +14,7 @@ namespace tnbLib
 	{
 		tnbLib::T(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::T(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = gf1.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -43,6 +44,7 @@ namespace tnbLib
 	{
 		tnbLib::tr(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::tr(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -73,6 +75,7 @@ namespace tnbLib
 	{
 		tnbLib::sph(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::sph(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -103,6 +106,7 @@ namespace tnbLib
 	{
 		tnbLib::symm(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::symm(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -133,6 +137,7 @@ namespace tnbLib
 	{
 		tnbLib::twoSymm(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::twoSymm(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -163,6 +168,7 @@ namespace tnbLib
 	{
 		tnbLib::skew(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::skew(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -192,6 +198,7 @@ namespace tnbLib
 	{
 		tnbLib::dev(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::dev(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -221,6 +228,7 @@ namespace tnbLib
 	{
 		tnbLib::dev2(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::dev2(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -250,6 +258,7 @@ namespace tnbLib
 	{
 		tnbLib::det(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::det(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -278,6 +287,7 @@ namespace tnbLib
 	{
 		tnbLib::cof(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::cof(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -306,6 +316,7 @@ namespace tnbLib
 	{
 		tnbLib::inv(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::inv(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -335,6 +346,7 @@ namespace tnbLib
 	{
 		tnbLib::eigenValues(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::eigenValues(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -366,6 +378,7 @@ namespace tnbLib
 	{
 		tnbLib::eigenVectors(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::eigenVectors(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -397,6 +410,7 @@ namespace tnbLib
 	{
 		tnbLib::eigenValues(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::eigenValues(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -429,6 +443,7 @@ namespace tnbLib
 	{
 		tnbLib::eigenVectors(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::eigenVectors(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -463,6 +478,7 @@ namespace tnbLib
 	{
 		tnbLib::hdual(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::hdual(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -492,6 +508,7 @@ namespace tnbLib
 	{
 		tnbLib::hdual(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::hdual(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -522,6 +539,7 @@ namespace tnbLib
 	{
 		tnbLib::divide(res.primitiveFieldRef(), gf1.primitiveField(), gf2.primitiveField());
 		tnbLib::divide(res.boundaryFieldRef(), gf1.boundaryField(), gf2.boundaryField());
+		res.oriented() = gf1.oriented() != gf2.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -584,6 +602,7 @@ namespace tnbLib
 	{
 		tnbLib::divide(res.primitiveFieldRef(), dt1.value(), gf2.primitiveField());
 		tnbLib::divide(res.boundaryFieldRef(), dt1.value(), gf2.boundaryField());
+		res.oriented() = gf2.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -631,6 +650,7 @@ namespace tnbLib
 	{
 		tnbLib::divide(res.primitiveFieldRef(), gf1.primitiveField(), dt2.value());
 		tnbLib::divide(res.boundaryFieldRef(), gf1.boundaryField(), dt2.value());
+		res.oriented() = gf1.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -331,6 +331,20 @@ namespace tnbLib
 			const label comm = UPstream::worldComm
 		);
 
+		//- Helper: exchange sizes of sendData with the given neighbour
+		//  processors only, by point-to-point messages rather than an
+		//  all-to-all. The sizes from the other processors are zero, so
+		//  sendData must be empty for all but the neighbours.
+		template<class Container>
+		static void exchangeSizes
+		(
+			const labelUList& neighProcs,
+			const Container& sendData,
+			labelList& sizes,
+			const int tag = UPstream::msgType(),
+			const label comm = UPstream::worldComm
+		);
+
 		//- Exchange contiguous data. Sends sendData, receives into
 		//  recvData. Determines sizes to receive.
 		//  If block=true will wait for all transfers to finish.
@@ -77,6 +77,8 @@ namespace tnbLib
 
 		inline const dimensionSet& dimensions() const;
 
+		inline bool oriented() const;
+
 		inline one operator[](const label) const;
 
 		inline oneField field() const;
@@ -206,6 +206,12 @@ namespace tnbLib
 	}
 
 
+	inline bool primitiveMesh::hasGeomChangedFaces() const
+	{
+		return geomChangedFacesPtr_;
+	}
+
+
 	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
 } // End namespace tnbLib
@@ -259,6 +259,9 @@ tnbLib::fvMesh::fvMesh(const IOobject& io)
 		Pout << FUNCTION_NAME << "Constructing fvMesh from IOobject" << endl;
 	}
 
+	// Renumber for locality before any field is read
+	renumberFromControlDict();
+
 	// Check the existence of the cell volumes and read if present
 	// and set the storage of V00
 	if (fileHandler().isFile(time().timePath() / "V0"))
@@ -300,6 +303,7 @@ tnbLib::fvMesh::fvMesh(const IOobject& io)
 			ioObj,
 			*this
 		);
+		phiPtr_->oriented() = true;
 	}
 }
 
@@ -492,6 +496,11 @@ tnbLib::polyMesh::readUpdateState tnbLib::fvMesh::readUpdate()
 
 		clearOut();
 
+		// The mesh has been re-read in the I/O order
+		ioCellMapPtr_.clear();
+		ioFaceMapPtr_.clear();
+		ioFlipMapPtr_.clear();
+		renumberFromControlDict();
 	}
 	else if (state == polyMesh::TOPO_CHANGE)
 	{
@@ -501,6 +510,12 @@ tnbLib::polyMesh::readUpdateState tnbLib::fvMesh::readUpdate()
 		}
 
 		clearOut();
+
+		// The mesh has been re-read in the I/O order
+		ioCellMapPtr_.clear();
+		ioFaceMapPtr_.clear();
+		ioFlipMapPtr_.clear();
+		renumberFromControlDict();
 	}
 	else if (state == polyMesh::POINTS_MOVED)
 	{
@@ -727,6 +742,7 @@ tnbLib::tmp<tnbLib::scalarField> tnbLib::fvMesh::movePoints(const pointField& p)
 			*this,
 			dimVolume / dimTime
 		);
+		phiPtr_->oriented() = true;
 	}
 	else
 	{
@@ -785,6 +801,12 @@ void tnbLib::fvMesh::updateMesh(const mapPolyMesh& mpm)
 	// Update polyMesh. This needs to keep volume existent!
 	polyMesh::updateMesh(mpm);
 
+	// The changed mesh is written in the in-memory order, and so are the
+	// fields from now on
+	ioCellMapPtr_.clear();
+	ioFaceMapPtr_.clear();
+	ioFlipMapPtr_.clear();
+
 	if (VPtr_)
 	{
 		// Grab old time volumes if the time has been incremented
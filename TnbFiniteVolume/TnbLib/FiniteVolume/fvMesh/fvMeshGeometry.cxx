@@ -45,6 +45,7 @@ void tnbLib::fvMesh::makeSf() const
 		dimArea,
 		faceAreas()
 	);
+	SfPtr_->oriented() = true;
 }
 
 
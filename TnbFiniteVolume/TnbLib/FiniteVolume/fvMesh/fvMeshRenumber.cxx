@@ -0,0 +1,389 @@
+#include <fvMesh.hxx>
+
+#include <Time.hxx>
+#include <bandCompression.hxx>
+#include <spaceFillingCurve.hxx>
+#include <ListOps.hxx>
+#include <SortableList.hxx>
+#include <cellZoneMesh.hxx>
+#include <faceZoneMesh.hxx>
+#include <OSspecific.hxx>
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Description
+	In-memory renumbering of the cells and internal faces of an fvMesh.
+
+\*---------------------------------------------------------------------------*/
+
+// * * * * * * * * * * * * * * * Local Functions * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+	// Return the maximum distance between the owner and neighbour of the
+	// internal faces
+	static label meshBandwidth(const primitiveMesh& mesh)
+	{
+		const labelList& own = mesh.faceOwner();
+		const labelList& nei = mesh.faceNeighbour();
+
+		label band = 0;
+
+		forAll(nei, facei)
+		{
+			band = max(band, nei[facei] - own[facei]);
+		}
+
+		return band;
+	}
+}
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+void tnbLib::fvMesh::renumberFromControlDict()
+{
+	const dictionary& controlDict = time().controlDict();
+
+	if (!controlDict.found("renumber"))
+	{
+		return;
+	}
+
+	const dictionary& renumberDict = controlDict.subDict("renumber");
+	const word method(renumberDict.lookup("method"));
+
+	if (method == "none")
+	{
+		return;
+	}
+
+	// The labels in the sets are those of the mesh files
+	const fileName setsDir
+	(
+		time().path()/facesInstance()/meshDir()/"sets"
+	);
+
+	if (isDir(setsDir) && readDir(setsDir).size())
+	{
+		FatalIOErrorInFunction(renumberDict)
+			<< "Mesh " << name() << " has sets in " << setsDir
+			<< " which would not be renumbered" << nl
+			<< "Remove the sets or the renumber sub-dictionary"
+			<< exit(FatalIOError);
+	}
+
+	labelList cellOrder;
+
+	if (method == "CuthillMcKee" || method == "reverseCuthillMcKee")
+	{
+		cellOrder = bandCompression(cellCells());
+
+		if (method == "reverseCuthillMcKee")
+		{
+			reverse(cellOrder);
+		}
+	}
+	else if (method == "hilbert")
+	{
+		cellOrder = hilbertOrder(cellCentres());
+	}
+	else if (method == "morton")
+	{
+		cellOrder = mortonOrder(cellCentres());
+	}
+	else
+	{
+		FatalIOErrorInFunction(renumberDict)
+			<< "Unknown renumber method " << method << nl
+			<< "Valid methods are :" << nl
+			<< "(none CuthillMcKee reverseCuthillMcKee hilbert morton)"
+			<< exit(FatalIOError);
+	}
+
+	const label oldBand = returnReduce(meshBandwidth(*this), maxOp<label>());
+
+	renumber(cellOrder);
+
+	Info << "Renumbered mesh " << name() << " in memory using " << method
+		<< ": bandwidth " << oldBand << " -> "
+		<< returnReduce(meshBandwidth(*this), maxOp<label>())
+		<< nl << endl;
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void tnbLib::fvMesh::renumber(const labelList& cellOrder)
+{
+	if (cellOrder.size() != nCells())
+	{
+		FatalErrorInFunction
+			<< "Size of cell order " << cellOrder.size()
+			<< " differs from the number of cells " << nCells()
+			<< abort(FatalError);
+	}
+
+	const labelList reverseCellOrder(invert(nCells(), cellOrder));
+
+	// Upper-triangular order of the internal faces: faces are visited by
+	// their lower numbered new cell and sorted by the other. Boundary faces
+	// keep their order.
+	labelList faceOrder(nFaces());
+	{
+		labelList oldToNewFace(nFaces(), -1);
+
+		label newFacei = 0;
+
+		DynamicList<label> nbr;
+		DynamicList<label> nbrFaces;
+		labelList order;
+
+		forAll(cellOrder, newCelli)
+		{
+			const cell& cFaces = cells()[cellOrder[newCelli]];
+
+			nbr.clear();
+			nbrFaces.clear();
+
+			forAll(cFaces, i)
+			{
+				const label facei = cFaces[i];
+
+				if (isInternalFace(facei))
+				{
+					label nbrCelli = reverseCellOrder[faceNeighbour()[facei]];
+					if (nbrCelli == newCelli)
+					{
+						nbrCelli = reverseCellOrder[faceOwner()[facei]];
+					}
+
+					// The lower numbered cell handles the face
+					if (newCelli < nbrCelli)
+					{
+						nbr.append(nbrCelli);
+						nbrFaces.append(facei);
+					}
+				}
+			}
+
+			sortedOrder(nbr, order);
+
+			forAll(order, i)
+			{
+				oldToNewFace[nbrFaces[order[i]]] = newFacei++;
+			}
+		}
+
+		for (label facei = nInternalFaces(); facei < nFaces(); facei++)
+		{
+			oldToNewFace[facei] = facei;
+		}
+
+		faceOrder = invert(nFaces(), oldToNewFace);
+	}
+
+	const labelList reverseFaceOrder(invert(nFaces(), faceOrder));
+
+
+	// Reorder the primitives, flipping the internal faces whose owner is
+	// numbered after their neighbour
+
+	faceList newFaces(reorder(reverseFaceOrder, faces()));
+	labelList newOwner
+	(
+		tnbLib::renumber
+		(
+			reverseCellOrder,
+			reorder(reverseFaceOrder, faceOwner())
+		)
+	);
+	labelList newNeighbour
+	(
+		tnbLib::renumber
+		(
+			reverseCellOrder,
+			reorder(reverseFaceOrder, faceNeighbour())
+		)
+	);
+
+	boolList flipMap(nInternalFaces(), false);
+
+	forAll(newNeighbour, facei)
+	{
+		if (newOwner[facei] > newNeighbour[facei])
+		{
+			Swap(newOwner[facei], newNeighbour[facei]);
+			newFaces[facei] = newFaces[facei].reverseFace();
+			flipMap[facei] = true;
+		}
+	}
+
+	const polyBoundaryMesh& patches = boundaryMesh();
+	labelList patchSizes(patches.size());
+	labelList patchStarts(patches.size());
+	forAll(patches, patchi)
+	{
+		patchSizes[patchi] = patches[patchi].size();
+		patchStarts[patchi] = patches[patchi].start();
+	}
+
+	// The mesh files are not changed by the renumbering
+	const fileName pointsInst(pointsInstance());
+	const fileName facesInst(facesInstance());
+	const IOobject::writeOption wOpt = boundaryMesh().writeOpt();
+
+	resetPrimitives
+	(
+		NullObjectMove<pointField>(),
+		move(newFaces),
+		move(newOwner),
+		move(newNeighbour),
+		patchSizes,
+		patchStarts,
+		true
+	);
+
+	setInstance(facesInst, wOpt);
+	setPointsInstance(pointsInst);
+
+
+	// Renumber the zones
+	{
+		faceZoneMesh& fZones = faceZones();
+		fZones.clearAddressing();
+		forAll(fZones, zonei)
+		{
+			faceZone& fZone = fZones[zonei];
+			labelList newAddressing(fZone.size());
+			boolList newFlipMap(fZone.size());
+			forAll(fZone, i)
+			{
+				const label facei = reverseFaceOrder[fZone[i]];
+
+				newAddressing[i] = facei;
+				newFlipMap[i] =
+					fZone.flipMap()[i]
+				 != (facei < nInternalFaces() && flipMap[facei]);
+			}
+			labelList newToOld;
+			sortedOrder(newAddressing, newToOld);
+			fZone.resetAddressing
+			(
+				UIndirectList<label>(newAddressing, newToOld)(),
+				UIndirectList<bool>(newFlipMap, newToOld)()
+			);
+		}
+
+		cellZoneMesh& cZones = cellZones();
+		cZones.clearAddressing();
+		forAll(cZones, zonei)
+		{
+			cZones[zonei] = UIndirectList<label>
+			(
+				reverseCellOrder,
+				cZones[zonei]
+			)();
+			tnbLib::sort(cZones[zonei]);
+		}
+	}
+
+
+	// Combine with any previous renumbering into the I/O addressing
+
+	labelList ioCellMap(nCells());
+	labelList ioFaceMap(nInternalFaces());
+	boolList ioFlipMap(nInternalFaces());
+
+	forAll(ioCellMap, celli)
+	{
+		ioCellMap[celli] =
+			renumbered() ? ioCellMapPtr_()[cellOrder[celli]] : cellOrder[celli];
+	}
+
+	forAll(ioFaceMap, facei)
+	{
+		const label oldFacei = faceOrder[facei];
+
+		if (renumbered())
+		{
+			ioFaceMap[facei] = ioFaceMapPtr_()[oldFacei];
+			ioFlipMap[facei] = flipMap[facei] != ioFlipMapPtr_()[oldFacei];
+		}
+		else
+		{
+			ioFaceMap[facei] = oldFacei;
+			ioFlipMap[facei] = flipMap[facei];
+		}
+	}
+
+	ioCellMapPtr_.reset(new labelList(move(ioCellMap)));
+	ioFaceMapPtr_.reset(new labelList(move(ioFaceMap)));
+	ioFlipMapPtr_.reset(new boolList(move(ioFlipMap)));
+
+	// Remove all geometry and addressing derived from the old numbering
+	clearOut();
+}
+
+
+const tnbLib::labelList& tnbLib::fvMesh::ioCellMap() const
+{
+	if (!renumbered())
+	{
+		FatalErrorInFunction
+			<< "Mesh " << name() << " has not been renumbered"
+			<< abort(FatalError);
+	}
+
+	return ioCellMapPtr_();
+}
+
+
+const tnbLib::labelList& tnbLib::fvMesh::ioFaceMap() const
+{
+	if (!renumbered())
+	{
+		FatalErrorInFunction
+			<< "Mesh " << name() << " has not been renumbered"
+			<< abort(FatalError);
+	}
+
+	return ioFaceMapPtr_();
+}
+
+
+const tnbLib::boolList& tnbLib::fvMesh::ioFlipMap() const
+{
+	if (!renumbered())
+	{
+		FatalErrorInFunction
+			<< "Mesh " << name() << " has not been renumbered"
+			<< abort(FatalError);
+	}
+
+	return ioFlipMapPtr_();
+}
+
+
+// ************************************************************************* //
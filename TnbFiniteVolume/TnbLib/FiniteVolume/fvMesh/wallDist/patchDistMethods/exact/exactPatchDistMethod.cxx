@@ -0,0 +1,571 @@
+#include <exactPatchDistMethod.hxx>
+
+#include <fvMesh.hxx>
+#include <volFields.hxx>
+#include <emptyFvPatchFields.hxx>
+#include <uindirectPrimitivePatch.hxx>
+#include <primitiveFacePatch.hxx>
+#include <indexedOctree.hxx>
+#include <treeDataPrimitivePatch.hxx>
+#include <treeDataPoint.hxx>
+#include <PstreamBuffers.hxx>
+#include <ListListOps.hxx>
+#include <threadLoop.hxx>
+#include <addToRunTimeSelectionTable.hxx>
+
+// * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+	namespace patchDistMethods
+	{
+		defineTypeNameAndDebug(exact, 0);
+		addToRunTimeSelectionTable(patchDistMethod, exact, dictionary);
+	}
+}
+
+
+// * * * * * * * * * * * * * * * Local Functions * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+	// Return the square of the distance between two boxes
+	static inline scalar distSqr(const boundBox& a, const boundBox& b)
+	{
+		return magSqr
+		(
+			max
+			(
+				max(a.min() - b.max(), b.min() - a.max()),
+				vector::zero
+			)
+		);
+	}
+}
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+void tnbLib::patchDistMethods::exact::nearest
+(
+	const faceList& faces,
+	const pointField& points,
+	const pointField& samples,
+	scalarField& dist,
+	vectorField* normalPtr
+)
+{
+	if (faces.empty())
+	{
+		return;
+	}
+
+	typedef treeDataPrimitivePatch<primitiveFacePatch> treeType;
+
+	const primitiveFacePatch patch(faces, points);
+
+	const indexedOctree<treeType> tree
+	(
+		treeType(false, patch, indexedOctree<treeType>::perturbTol()),
+		treeBoundBox(points).extend(1e-4),
+		8,
+		10,
+		3.0
+	);
+
+	// Only the samples nearer than their current distance are updated so
+	// the search radius of every sample is bounded by its current distance
+	threadLoop::run
+	(
+		samples.size(),
+		[&](const label, const label start, const label end)
+		{
+			for (label samplei = start; samplei < end; samplei++)
+			{
+				const point& sample = samples[samplei];
+
+				const pointIndexHit info =
+					tree.findNearest(sample, sqr(dist[samplei]));
+
+				if (!info.hit())
+				{
+					continue;
+				}
+
+				const vector d = sample - info.hitPoint();
+				const scalar magD = mag(d);
+
+				if (magD < dist[samplei])
+				{
+					dist[samplei] = magD;
+
+					if (normalPtr)
+					{
+						if (magD > vSmall)
+						{
+							(*normalPtr)[samplei] = d/magD;
+						}
+						else
+						{
+							const vector a = faces[info.index()].area(points);
+							(*normalPtr)[samplei] = a/(mag(a) + vSmall);
+						}
+					}
+				}
+			}
+		},
+		1000
+	);
+}
+
+
+void tnbLib::patchDistMethods::exact::remotePatchFaces
+(
+	const faceList& localFaces,
+	const pointField& localPoints,
+	const pointField& samples,
+	const scalarField& dist,
+	faceList& faces,
+	pointField& points
+) const
+{
+	const label nProcs = Pstream::nProcs();
+	const label myProci = Pstream::myProcNo();
+
+	// Bound the distances using a few patch points of every processor
+	scalarField distBound(dist);
+	{
+		List<pointField> procSamples(nProcs);
+
+		const label n = min(nSamples_, localPoints.size());
+		procSamples[myProci].setSize(n);
+		for (label i = 0; i < n; i++)
+		{
+			procSamples[myProci][i] = localPoints[(i*localPoints.size())/n];
+		}
+
+		Pstream::gatherList(procSamples);
+		Pstream::scatterList(procSamples);
+
+		const pointField allSamples
+		(
+			ListListOps::combine<pointField>
+			(
+				procSamples,
+				accessOp<pointField>()
+			)
+		);
+
+		if (allSamples.size())
+		{
+			const treeDataPoint shapes(allSamples);
+
+			const indexedOctree<treeDataPoint> tree
+			(
+				shapes,
+				treeBoundBox(allSamples).extend(1e-4),
+				8,
+				10,
+				3.0
+			);
+
+			threadLoop::run
+			(
+				samples.size(),
+				[&](const label, const label start, const label end)
+				{
+					for (label samplei = start; samplei < end; samplei++)
+					{
+						const pointIndexHit info = tree.findNearest
+						(
+							samples[samplei],
+							sqr(distBound[samplei])
+						);
+
+						if (info.hit())
+						{
+							distBound[samplei] =
+								mag(samples[samplei] - info.hitPoint());
+						}
+					}
+				},
+				1000
+			);
+		}
+	}
+
+	// Search regions of every processor: the samples are binned into
+	// sub-boxes of their bounding box and each non-empty sub-box gives the
+	// bounding box of its samples and their largest distance bound
+	List<List<boundBox>> procBbs(nProcs);
+	List<scalarList> procRadii(nProcs);
+
+	if (samples.size())
+	{
+		const boundBox bb(samples, false);
+		const vector span(bb.span());
+		const label nDiv = nDivisions_;
+
+		List<boundBox> binBb(nDiv*nDiv*nDiv, boundBox::invertedBox);
+		scalarList binRadius(binBb.size(), scalar(-1));
+
+		forAll(samples, samplei)
+		{
+			const point& sample = samples[samplei];
+
+			label bini = 0;
+			for (direction d = 0; d < vector::nComponents; d++)
+			{
+				const label i =
+					span[d] > vSmall
+				  ? label(nDiv*(sample[d] - bb.min()[d])/span[d])
+				  : 0;
+
+				bini = nDiv*bini + min(max(i, 0), nDiv - 1);
+			}
+
+			binBb[bini].min() = min(binBb[bini].min(), sample);
+			binBb[bini].max() = max(binBb[bini].max(), sample);
+			binRadius[bini] = max(binRadius[bini], distBound[samplei]);
+		}
+
+		DynamicList<boundBox> bbs(binBb.size());
+		DynamicList<scalar> radii(binBb.size());
+
+		forAll(binRadius, bini)
+		{
+			if (binRadius[bini] >= 0)
+			{
+				bbs.append(binBb[bini]);
+				radii.append(binRadius[bini]);
+			}
+		}
+
+		procBbs[myProci].transfer(bbs);
+		procRadii[myProci].transfer(radii);
+	}
+
+	Pstream::gatherList(procBbs);
+	Pstream::scatterList(procBbs);
+	Pstream::gatherList(procRadii);
+	Pstream::scatterList(procRadii);
+
+
+	// Send the patch faces within the search region of each processor
+
+	List<boundBox> faceBb(localFaces.size());
+	forAll(localFaces, facei)
+	{
+		const face& f = localFaces[facei];
+
+		boundBox& bb = faceBb[facei];
+		bb = boundBox::invertedBox;
+		forAll(f, fp)
+		{
+			bb.min() = min(bb.min(), localPoints[f[fp]]);
+			bb.max() = max(bb.max(), localPoints[f[fp]]);
+		}
+	}
+
+	PstreamBuffers pBufs(Pstream::commsTypes::nonBlocking);
+
+	labelList pointMap(localPoints.size(), -1);
+
+	for (label proci = 0; proci < nProcs; proci++)
+	{
+		const List<boundBox>& pbbs = procBbs[proci];
+		const scalarList& pRadii = procRadii[proci];
+
+		if (proci == myProci || pbbs.empty())
+		{
+			continue;
+		}
+
+		DynamicList<face> sendFaces;
+		DynamicList<point> sendPoints;
+		DynamicList<label> usedPoints;
+
+		forAll(localFaces, facei)
+		{
+			bool inReach = false;
+
+			forAll(pbbs, bbi)
+			{
+				if (distSqr(faceBb[facei], pbbs[bbi]) <= sqr(pRadii[bbi]))
+				{
+					inReach = true;
+					break;
+				}
+			}
+
+			if (!inReach)
+			{
+				continue;
+			}
+
+			const face& f = localFaces[facei];
+			face sendFace(f.size());
+
+			forAll(f, fp)
+			{
+				if (pointMap[f[fp]] == -1)
+				{
+					pointMap[f[fp]] = sendPoints.size();
+					sendPoints.append(localPoints[f[fp]]);
+					usedPoints.append(f[fp]);
+				}
+				sendFace[fp] = pointMap[f[fp]];
+			}
+
+			sendFaces.append(sendFace);
+		}
+
+		forAll(usedPoints, i)
+		{
+			pointMap[usedPoints[i]] = -1;
+		}
+
+		if (sendFaces.size())
+		{
+			UOPstream toProc(proci, pBufs);
+			toProc << faceList(sendFaces) << pointField(sendPoints);
+		}
+	}
+
+	labelList recvSizes;
+	pBufs.finishedSends(recvSizes);
+
+
+	// Collect the received faces, renumbered into the combined points
+
+	DynamicList<face> allFaces;
+	DynamicList<point> allPoints;
+
+	for (label proci = 0; proci < nProcs; proci++)
+	{
+		if (proci == myProci || !recvSizes[proci])
+		{
+			continue;
+		}
+
+		UIPstream fromProc(proci, pBufs);
+		const faceList recvFaces(fromProc);
+		const pointField recvPoints(fromProc);
+
+		const label pointOffset = allPoints.size();
+		allPoints.append(recvPoints);
+
+		forAll(recvFaces, facei)
+		{
+			face f(recvFaces[facei]);
+			forAll(f, fp)
+			{
+				f[fp] += pointOffset;
+			}
+			allFaces.append(f);
+		}
+	}
+
+	faces.transfer(allFaces);
+	points.transfer(allPoints);
+
+	if (debug)
+	{
+		Pout << "patchDistMethods::exact::remotePatchFaces : "
+			<< "received " << faces.size() << " remote patch faces" << endl;
+	}
+}
+
+
+void tnbLib::patchDistMethods::exact::calculate
+(
+	const pointField& samples,
+	scalarField& dist,
+	vectorField* normalPtr
+) const
+{
+	dist.setSize(samples.size());
+	dist = great;
+
+	if (normalPtr)
+	{
+		normalPtr->setSize(samples.size());
+		*normalPtr = Zero;
+	}
+
+	// Local patch faces compacted to their own points
+	const polyBoundaryMesh& pbm = mesh_.boundaryMesh();
+
+	DynamicList<label> faceLabels;
+	forAllConstIter(labelHashSet, patchIDs_, iter)
+	{
+		const polyPatch& pp = pbm[iter.key()];
+
+		forAll(pp, i)
+		{
+			faceLabels.append(pp.start() + i);
+		}
+	}
+
+	const uindirectPrimitivePatch localPatch
+	(
+		UIndirectList<face>(mesh_.faces(), faceLabels),
+		mesh_.points()
+	);
+
+	const faceList& localFaces = localPatch.localFaces();
+	const pointField& localPoints = localPatch.localPoints();
+
+	nearest(localFaces, localPoints, samples, dist, normalPtr);
+
+	if (Pstream::parRun())
+	{
+		faceList faces;
+		pointField points;
+		remotePatchFaces
+		(
+			localFaces,
+			localPoints,
+			samples,
+			dist,
+			faces,
+			points
+		);
+
+		nearest(faces, points, samples, dist, normalPtr);
+	}
+}
+
+
+bool tnbLib::patchDistMethods::exact::correct
+(
+	volScalarField& y,
+	volVectorField* nPtr
+)
+{
+	volScalarField::Boundary& ybf = y.boundaryFieldRef();
+
+	// Samples: the cell centres followed by the face centres of the
+	// non-empty patches which are not in the patch set
+	label nSamples = mesh_.nCells();
+	forAll(ybf, patchi)
+	{
+		if
+		(
+			!patchIDs_.found(patchi)
+		 && !isA<emptyFvPatchScalarField>(ybf[patchi])
+		)
+		{
+			nSamples += ybf[patchi].size();
+		}
+	}
+
+	pointField samples(nSamples);
+	SubField<point>(samples, mesh_.nCells()) = mesh_.cellCentres();
+
+	label samplei = mesh_.nCells();
+	forAll(ybf, patchi)
+	{
+		if
+		(
+			!patchIDs_.found(patchi)
+		 && !isA<emptyFvPatchScalarField>(ybf[patchi])
+		)
+		{
+			const vectorField& Cf = mesh_.boundary()[patchi].Cf();
+			SubField<point>(samples, Cf.size(), samplei) = Cf;
+			samplei += Cf.size();
+		}
+	}
+
+	scalarField dist;
+	vectorField normal;
+	calculate(samples, dist, nPtr ? &normal : nullptr);
+
+
+	// Transfer the cell and patch values into y and n
+
+	y.primitiveFieldRef() = scalarField::subField(dist, mesh_.nCells());
+
+	if (nPtr)
+	{
+		nPtr->primitiveFieldRef() =
+			vectorField::subField(normal, mesh_.nCells());
+	}
+
+	samplei = mesh_.nCells();
+	forAll(ybf, patchi)
+	{
+		if (isA<emptyFvPatchScalarField>(ybf[patchi]))
+		{
+			continue;
+		}
+		else if (patchIDs_.found(patchi))
+		{
+			ybf[patchi] == 0.0;
+		}
+		else
+		{
+			const label size = ybf[patchi].size();
+
+			ybf[patchi] == scalarField(scalarField::subField(dist, size, samplei));
+
+			if (nPtr)
+			{
+				nPtr->boundaryFieldRef()[patchi] ==
+					vectorField(vectorField::subField(normal, size, samplei));
+			}
+
+			samplei += size;
+		}
+	}
+
+	// Number of cells and faces without a patch face in reach
+	nUnset_ = 0;
+	forAll(dist, i)
+	{
+		if (dist[i] >= great)
+		{
+			nUnset_++;
+		}
+	}
+
+	return nUnset_ > 0;
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+tnbLib::patchDistMethods::exact::exact
+(
+	const dictionary& dict,
+	const fvMesh& mesh,
+	const labelHashSet& patchIDs
+)
+	:
+	patchDistMethod(mesh, patchIDs),
+	nSamples_(dict.lookupOrDefault<label>("nSamples", 16)),
+	nDivisions_(max(dict.lookupOrDefault<label>("nDivisions", 4), 1)),
+	nUnset_(0)
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+bool tnbLib::patchDistMethods::exact::correct(volScalarField& y)
+{
+	return correct(y, nullptr);
+}
+
+
+bool tnbLib::patchDistMethods::exact::correct
+(
+	volScalarField& y,
+	volVectorField& n
+)
+{
+	return correct(y, &n);
+}
+
+
+// ************************************************************************* //
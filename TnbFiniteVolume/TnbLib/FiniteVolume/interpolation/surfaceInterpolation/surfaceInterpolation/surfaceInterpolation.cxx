@@ -11,6 +11,48 @@
 namespace tnbLib
 {
 	defineTypeNameAndDebug(surfaceInterpolation, 0);
+
+	// Linear interpolation weight of an internal face
+	static inline scalar linearWeight
+	(
+		const vector& Sf,
+		const vector& Cf,
+		const vector& Cown,
+		const vector& Cnei
+	)
+	{
+		// Note: mag in the dot-product.
+		// For all valid meshes, the non-orthogonality will be less that
+		// 90 deg and the dot-product will be positive.  For invalid
+		// meshes (d & s <= 0), this will stabilise the calculation
+		// but the result will be poor.
+		const scalar SfdOwn = mag(Sf & (Cf - Cown));
+		const scalar SfdNei = mag(Sf & (Cnei - Cf));
+		const scalar SfdOwnNei = SfdOwn + SfdNei;
+
+		if (SfdNei / vGreat < SfdOwnNei)
+		{
+			return SfdNei / SfdOwnNei;
+		}
+		else
+		{
+			const scalar dOwn = mag(Cf - Cown);
+			const scalar dNei = mag(Cnei - Cf);
+			const scalar dOwnNei = dOwn + dNei;
+
+			return dNei / dOwnNei;
+		}
+	}
+
+	// Stabilised non-orthogonal delta coefficient
+	static inline scalar nonOrthDeltaCoeff
+	(
+		const vector& unitArea,
+		const vector& delta
+	)
+	{
+		return 1.0 / max(unitArea & delta, 0.05*mag(delta));
+	}
 }
 
 
@@ -97,10 +139,18 @@ tnbLib::surfaceInterpolation::nonOrthCorrectionVectors() const
 
 bool tnbLib::surfaceInterpolation::movePoints()
 {
-	deleteDemandDrivenData(weights_);
-	deleteDemandDrivenData(deltaCoeffs_);
-	deleteDemandDrivenData(nonOrthDeltaCoeffs_);
-	deleteDemandDrivenData(nonOrthCorrectionVectors_);
+	if (mesh_.hasGeomChangedFaces())
+	{
+		// Only the moving parts of the mesh have changed geometry
+		updateGeomChangedFaces();
+	}
+	else
+	{
+		deleteDemandDrivenData(weights_);
+		deleteDemandDrivenData(deltaCoeffs_);
+		deleteDemandDrivenData(nonOrthDeltaCoeffs_);
+		deleteDemandDrivenData(nonOrthCorrectionVectors_);
+	}
 
 	return true;
 }
@@ -147,27 +197,13 @@ void tnbLib::surfaceInterpolation::makeWeights() const
 
 	forAll(owner, facei)
 	{
-		// Note: mag in the dot-product.
-		// For all valid meshes, the non-orthogonality will be less that
-		// 90 deg and the dot-product will be positive.  For invalid
-		// meshes (d & s <= 0), this will stabilise the calculation
-		// but the result will be poor.
-		const scalar SfdOwn = mag(Sf[facei] & (Cf[facei] - C[owner[facei]]));
-		const scalar SfdNei = mag(Sf[facei] & (C[neighbour[facei]] - Cf[facei]));
-		const scalar SfdOwnNei = SfdOwn + SfdNei;
-
-		if (SfdNei / vGreat < SfdOwnNei)
-		{
-			w[facei] = SfdNei / SfdOwnNei;
-		}
-		else
-		{
-			const scalar dOwn = mag(Cf[facei] - C[owner[facei]]);
-			const scalar dNei = mag(C[neighbour[facei]] - Cf[facei]);
-			const scalar dOwnNei = dOwn + dNei;
-
-			w[facei] = dNei / dOwnNei;
-		}
+		w[facei] = linearWeight
+		(
+			Sf[facei],
+			Cf[facei],
+			C[owner[facei]],
+			C[neighbour[facei]]
+		);
 	}
 
 	surfaceScalarField::Boundary& wBf =
@@ -289,7 +325,7 @@ void tnbLib::surfaceInterpolation::makeNonOrthDeltaCoeffs() const
 		// NonOrthDeltaCoeffs[facei] = 1.0/(mag(unitArea & delta) + vSmall);
 
 		// Stabilised form for bad meshes
-		nonOrthDeltaCoeffs[facei] = 1.0 / max(unitArea & delta, 0.05*mag(delta));
+		nonOrthDeltaCoeffs[facei] = nonOrthDeltaCoeff(unitArea, delta);
 	}
 
 	surfaceScalarField::Boundary& nonOrthDeltaCoeffsBf =
@@ -393,4 +429,150 @@ void tnbLib::surfaceInterpolation::makeNonOrthCorrectionVectors() const
 }
 
 
+
+void tnbLib::surfaceInterpolation::updateGeomChangedFaces() const
+{
+	const labelList& changedFaces = mesh_.geomChangedFaces();
+
+	if (debug)
+	{
+		Pout << "surfaceInterpolation::updateGeomChangedFaces() : "
+			<< "Updating geometric coefficients of " << changedFaces.size()
+			<< " faces" << endl;
+	}
+
+	const labelUList& owner = mesh_.owner();
+	const labelUList& neighbour = mesh_.neighbour();
+	const label nInternalFaces = mesh_.nInternalFaces();
+
+	const vectorField& Cf = mesh_.faceCentres();
+	const vectorField& C = mesh_.cellCentres();
+	const vectorField& Sf = mesh_.faceAreas();
+
+	// Non-coupled patches are only updated if any of their faces changed.
+	// Coupled patches are always updated since their coefficients also
+	// depend on the geometry on the other side.
+	const polyBoundaryMesh& pbm = mesh_.boundaryMesh();
+	boolList patchChanged(pbm.size(), false);
+
+	forAll(pbm, patchi)
+	{
+		patchChanged[patchi] = mesh_.boundary()[patchi].coupled();
+	}
+
+	forAll(changedFaces, i)
+	{
+		const label facei = changedFaces[i];
+
+		if (facei >= nInternalFaces)
+		{
+			patchChanged[pbm.whichPatch(facei)] = true;
+		}
+	}
+
+
+	// Internal faces
+
+	forAll(changedFaces, i)
+	{
+		const label facei = changedFaces[i];
+
+		if (facei >= nInternalFaces)
+		{
+			break;
+		}
+
+		const vector delta = C[neighbour[facei]] - C[owner[facei]];
+		const vector unitArea = Sf[facei] / mag(Sf[facei]);
+
+		if (weights_)
+		{
+			weights_->primitiveFieldRef()[facei] =
+				linearWeight
+				(
+					Sf[facei],
+					Cf[facei],
+					C[owner[facei]],
+					C[neighbour[facei]]
+				);
+		}
+
+		if (deltaCoeffs_)
+		{
+			deltaCoeffs_->primitiveFieldRef()[facei] = 1.0 / mag(delta);
+		}
+
+		if (nonOrthDeltaCoeffs_)
+		{
+			nonOrthDeltaCoeffs_->primitiveFieldRef()[facei] =
+				nonOrthDeltaCoeff(unitArea, delta);
+		}
+
+		if (nonOrthCorrectionVectors_)
+		{
+			nonOrthCorrectionVectors_->primitiveFieldRef()[facei] =
+				unitArea
+			  - delta * nonOrthDeltaCoeffs().primitiveField()[facei];
+		}
+	}
+
+
+	// Boundary patches
+
+	forAll(patchChanged, patchi)
+	{
+		if (!patchChanged[patchi])
+		{
+			continue;
+		}
+
+		const fvPatch& p = mesh_.boundary()[patchi];
+
+		if (weights_)
+		{
+			p.makeWeights(weights_->boundaryFieldRef()[patchi]);
+		}
+
+		if (deltaCoeffs_)
+		{
+			deltaCoeffs_->boundaryFieldRef()[patchi] = 1.0 / mag(p.delta());
+		}
+
+		if (nonOrthDeltaCoeffs_ || nonOrthCorrectionVectors_)
+		{
+			const vectorField delta(p.delta());
+			const vectorField nf(p.nf());
+
+			if (nonOrthDeltaCoeffs_)
+			{
+				fvsPatchScalarField& patchNonOrthDeltaCoeffs =
+					nonOrthDeltaCoeffs_->boundaryFieldRef()[patchi];
+
+				forAll(patchNonOrthDeltaCoeffs, patchFacei)
+				{
+					patchNonOrthDeltaCoeffs[patchFacei] =
+						nonOrthDeltaCoeff(nf[patchFacei], delta[patchFacei]);
+				}
+			}
+
+			if (nonOrthCorrectionVectors_ && p.coupled())
+			{
+				const fvsPatchScalarField& patchNonOrthDeltaCoeffs =
+					nonOrthDeltaCoeffs().boundaryField()[patchi];
+
+				fvsPatchVectorField& patchCorrVecs =
+					nonOrthCorrectionVectors_->boundaryFieldRef()[patchi];
+
+				forAll(patchCorrVecs, patchFacei)
+				{
+					patchCorrVecs[patchFacei] =
+						nf[patchFacei]
+					  - delta[patchFacei]*patchNonOrthDeltaCoeffs[patchFacei];
+				}
+			}
+		}
+	}
+}
+
+
 // ************************************************************************* //
@@ -68,6 +68,66 @@ namespace tnbLib
 			return mesh.nInternalFaces();
 		}
 
+
+		//- Return true if the mesh faces have been renumbered in memory
+		static bool reordered(const Mesh& mesh)
+		{
+			return mesh.renumbered();
+		}
+
+		//- Convert a field read from disk into the in-memory face order,
+		//  changing the sign of the values of oriented fields on the
+		//  faces flipped by the renumbering
+		template<class FieldType>
+		static void readOrder
+		(
+			const Mesh& mesh,
+			FieldType& f,
+			const bool oriented
+		)
+		{
+			if (mesh.renumbered())
+			{
+				FieldType mf(f, mesh.ioFaceMap());
+
+				if (oriented)
+				{
+					const boolList& flipMap = mesh.ioFlipMap();
+					forAll(mf, facei)
+					{
+						if (flipMap[facei])
+						{
+							mf[facei] = -mf[facei];
+						}
+					}
+				}
+
+				f.transfer(mf);
+			}
+		}
+
+		//- Return a field in the on-disk face order
+		template<class FieldType>
+		static FieldType writeOrder
+		(
+			const Mesh& mesh,
+			const FieldType& f,
+			const bool oriented
+		)
+		{
+			const labelList& faceMap = mesh.ioFaceMap();
+			const boolList& flipMap = mesh.ioFlipMap();
+
+			FieldType iof(f.size());
+			forAll(f, facei)
+			{
+				iof[faceMap[facei]] =
+					oriented && flipMap[facei] ? -f[facei] : f[facei];
+			}
+
+			return iof;
+		}
+
 		const surfaceVectorField& C()
 		{
 			return mesh_.Cf();
@@ -84,6 +84,44 @@ namespace tnbLib
 			return mesh.nCells();
 		}
 
+
+		//- Return true if the mesh cells have been renumbered in memory
+		static bool reordered(const Mesh& mesh)
+		{
+			return mesh.renumbered();
+		}
+
+		//- Convert a field read from disk into the in-memory cell order
+		template<class FieldType>
+		static void readOrder(const Mesh& mesh, FieldType& f, const bool)
+		{
+			if (mesh.renumbered())
+			{
+				FieldType mf(f, mesh.ioCellMap());
+				f.transfer(mf);
+			}
+		}
+
+		//- Return a field in the on-disk cell order
+		template<class FieldType>
+		static FieldType writeOrder
+		(
+			const Mesh& mesh,
+			const FieldType& f,
+			const bool
+		)
+		{
+			const labelList& cellMap = mesh.ioCellMap();
+
+			FieldType iof(f.size());
+			forAll(f, celli)
+			{
+				iof[cellMap[celli]] = f[celli];
+			}
+
+			return iof;
+		}
+
 		//- Return cell centres
 		const volVectorField& C()
 		{
@@ -865,6 +865,7 @@ flux() const
 	);
 	GeometricField<Type, fvsPatchField, surfaceMesh>& fieldFlux =
 		tfieldFlux.ref();
+	fieldFlux.oriented() = true;
 
 	for (direction cmpt = 0; cmpt < pTraits<Type>::nComponents; cmpt++)
 	{
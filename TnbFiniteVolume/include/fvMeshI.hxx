@@ -1,6 +1,12 @@
 #pragma once
 // * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
 
+inline bool tnbLib::fvMesh::renumbered() const
+{
+	return ioCellMapPtr_.valid();
+}
+
+
 template<class Type>
 typename tnbLib::pTraits<Type>::labelType tnbLib::fvMesh::validComponents() const
 {
@@ -41,6 +41,7 @@ SourceFiles
 
 #include <scalar.hxx> // added by amir
 #include <point.hxx>  // added by amir
+#include <threadedWave.hxx>
 
 namespace tnbLib
 {
@@ -234,6 +235,14 @@ namespace tnbLib
 	}
 
 
+	//- The updates of smoothData do not read the mesh
+	template<>
+	inline bool threadedWave<smoothData>()
+	{
+		return true;
+	}
+
+
 
 	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
@@ -9,6 +9,8 @@
 #include <typeInfo.hxx>
 #include <globalMeshData.hxx>
 #include <pointFields.hxx>
+#include <ListOps.hxx>
+#include <threadLoop.hxx>
 
 #include <PstreamReduceOps.hxx>  // added by amir
 
@@ -17,6 +19,9 @@
 template<class Type, class TrackingData>
 tnbLib::scalar tnbLib::PointEdgeWave<Type, TrackingData>::propagationTol_ = 0.01;
 
+template<class Type, class TrackingData>
+tnbLib::label tnbLib::PointEdgeWave<Type, TrackingData>::minThreadSize_ = 10000;
+
 template<class Type, class TrackingData>
 int tnbLib::PointEdgeWave<Type, TrackingData>::dummyTrackData_ = 12345;
 
@@ -577,6 +582,278 @@ tnbLib::label tnbLib::PointEdgeWave<Type, TrackingData>::handleCollocatedPoints(
 }
 
 
+template<class Type, class TrackingData>
+void tnbLib::PointEdgeWave<Type, TrackingData>::threadedEdgeToPoint
+(
+	const label nThreads
+)
+{
+	const edgeList& edges = mesh_.edges();
+	const labelListList& pointEdges = mesh_.pointEdges();
+
+	// Points of the changed edges. Each is updated by a single thread from
+	// all its changed edges so no two threads write to the same point.
+	labelList candidatePoints(2*nChangedEdges_);
+
+	for (label changedEdgeI = 0; changedEdgeI < nChangedEdges_; changedEdgeI++)
+	{
+		const edge& e = edges[changedEdges_[changedEdgeI]];
+
+		candidatePoints[2*changedEdgeI] = e[0];
+		candidatePoints[2*changedEdgeI + 1] = e[1];
+	}
+	{
+		labelList order;
+		uniqueOrder(candidatePoints, order);
+		candidatePoints = UIndirectList<label>(candidatePoints, order)();
+	}
+
+	List<DynamicList<label>> threadChangedPoints(nThreads);
+	labelList threadNEvals(nThreads, 0);
+	labelList threadNVisited(nThreads, 0);
+
+	threadLoop::run
+	(
+		candidatePoints.size(),
+		nThreads,
+		[&](const label threadi, const label start, const label end)
+		{
+			DynamicList<label>& changed = threadChangedPoints[threadi];
+			label nEvals = 0;
+			label nVisited = 0;
+
+			for (label i = start; i < end; i++)
+			{
+				const label pointi = candidatePoints[i];
+				Type& pointInfo = allPointInfo_[pointi];
+
+				const bool wasValid = pointInfo.valid(td_);
+				bool propagate = false;
+
+				const labelList& pEdges = pointEdges[pointi];
+				forAll(pEdges, pEdgeI)
+				{
+					const label edgeI = pEdges[pEdgeI];
+
+					if (!changedEdge_[edgeI])
+					{
+						continue;
+					}
+
+					const Type& edgeInfo = allEdgeInfo_[edgeI];
+
+					if (!pointInfo.equal(edgeInfo, td_))
+					{
+						nEvals++;
+
+						if
+						(
+							pointInfo.updatePoint
+							(
+								mesh_,
+								pointi,
+								edgeI,
+								edgeInfo,
+								propagationTol_,
+								td_
+							)
+						)
+						{
+							propagate = true;
+						}
+					}
+				}
+
+				if (propagate)
+				{
+					changed.append(pointi);
+				}
+
+				if (!wasValid && pointInfo.valid(td_))
+				{
+					nVisited++;
+				}
+			}
+
+			threadNEvals[threadi] = nEvals;
+			threadNVisited[threadi] = nVisited;
+		}
+	);
+
+	// Mark the changed points in thread order
+	forAll(threadChangedPoints, threadi)
+	{
+		const DynamicList<label>& changed = threadChangedPoints[threadi];
+
+		forAll(changed, i)
+		{
+			if (!changedPoint_[changed[i]])
+			{
+				changedPoint_[changed[i]] = true;
+				changedPoints_[nChangedPoints_++] = changed[i];
+			}
+		}
+
+		nEvals_ += threadNEvals[threadi];
+		nUnvisitedPoints_ -= threadNVisited[threadi];
+	}
+
+	// Reset status of the edges
+	for (label changedEdgeI = 0; changedEdgeI < nChangedEdges_; changedEdgeI++)
+	{
+		changedEdge_[changedEdges_[changedEdgeI]] = false;
+	}
+}
+
+
+template<class Type, class TrackingData>
+void tnbLib::PointEdgeWave<Type, TrackingData>::threadedPointToEdge
+(
+	const label nThreads
+)
+{
+	const edgeList& edges = mesh_.edges();
+	const labelListList& pointEdges = mesh_.pointEdges();
+
+	// Edges of the changed points. Each is updated by a single thread from
+	// its changed end points.
+	label nCandidates = 0;
+	for
+	(
+		label changedPointi = 0;
+		changedPointi < nChangedPoints_;
+		changedPointi++
+	)
+	{
+		nCandidates += pointEdges[changedPoints_[changedPointi]].size();
+	}
+
+	labelList candidateEdges(nCandidates);
+	nCandidates = 0;
+
+	for
+	(
+		label changedPointi = 0;
+		changedPointi < nChangedPoints_;
+		changedPointi++
+	)
+	{
+		const labelList& pEdges = pointEdges[changedPoints_[changedPointi]];
+
+		forAll(pEdges, pEdgeI)
+		{
+			candidateEdges[nCandidates++] = pEdges[pEdgeI];
+		}
+	}
+	{
+		labelList order;
+		uniqueOrder(candidateEdges, order);
+		candidateEdges = UIndirectList<label>(candidateEdges, order)();
+	}
+
+	List<DynamicList<label>> threadChangedEdges(nThreads);
+	labelList threadNEvals(nThreads, 0);
+	labelList threadNVisited(nThreads, 0);
+
+	threadLoop::run
+	(
+		candidateEdges.size(),
+		nThreads,
+		[&](const label threadi, const label start, const label end)
+		{
+			DynamicList<label>& changed = threadChangedEdges[threadi];
+			label nEvals = 0;
+			label nVisited = 0;
+
+			for (label i = start; i < end; i++)
+			{
+				const label edgeI = candidateEdges[i];
+				Type& edgeInfo = allEdgeInfo_[edgeI];
+
+				const bool wasValid = edgeInfo.valid(td_);
+				bool propagate = false;
+
+				const edge& e = edges[edgeI];
+				forAll(e, eI)
+				{
+					const label pointi = e[eI];
+
+					if (!changedPoint_[pointi])
+					{
+						continue;
+					}
+
+					const Type& pointInfo = allPointInfo_[pointi];
+
+					if (!edgeInfo.equal(pointInfo, td_))
+					{
+						nEvals++;
+
+						if
+						(
+							edgeInfo.updateEdge
+							(
+								mesh_,
+								edgeI,
+								pointi,
+								pointInfo,
+								propagationTol_,
+								td_
+							)
+						)
+						{
+							propagate = true;
+						}
+					}
+				}
+
+				if (propagate)
+				{
+					changed.append(edgeI);
+				}
+
+				if (!wasValid && edgeInfo.valid(td_))
+				{
+					nVisited++;
+				}
+			}
+
+			threadNEvals[threadi] = nEvals;
+			threadNVisited[threadi] = nVisited;
+		}
+	);
+
+	// Mark the changed edges in thread order
+	forAll(threadChangedEdges, threadi)
+	{
+		const DynamicList<label>& changed = threadChangedEdges[threadi];
+
+		forAll(changed, i)
+		{
+			if (!changedEdge_[changed[i]])
+			{
+				changedEdge_[changed[i]] = true;
+				changedEdges_[nChangedEdges_++] = changed[i];
+			}
+		}
+
+		nEvals_ += threadNEvals[threadi];
+		nUnvisitedEdges_ -= threadNVisited[threadi];
+	}
+
+	// Reset status of the points
+	for
+	(
+		label changedPointi = 0;
+		changedPointi < nChangedPoints_;
+		changedPointi++
+	)
+	{
+		changedPoint_[changedPoints_[changedPointi]] = false;
+	}
+}
+
+
 // * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
 
 // Iterate, propagating changedPointsInfo across mesh, until no change (or
@@ -745,48 +1022,60 @@ void tnbLib::PointEdgeWave<Type, TrackingData>::setPointInfo
 template<class Type, class TrackingData>
 tnbLib::label tnbLib::PointEdgeWave<Type, TrackingData>::edgeToPoint()
 {
-	for
-		(
-			label changedEdgeI = 0;
-			changedEdgeI < nChangedEdges_;
-			changedEdgeI++
-			)
-	{
-		label edgeI = changedEdges_[changedEdgeI];
+	const label nThreads =
+		threadedWave<Type>()
+	  ? threadLoop::nThreadsFor(nChangedEdges_, minThreadSize_)
+	  : 1;
 
-		if (!changedEdge_[edgeI])
+	if (nThreads > 1)
+	{
+		threadedEdgeToPoint(nThreads);
+	}
+	else
+	{
+		for
+			(
+				label changedEdgeI = 0;
+				changedEdgeI < nChangedEdges_;
+				changedEdgeI++
+				)
 		{
-			FatalErrorInFunction
-				<< "edge " << edgeI
-				<< " not marked as having been changed" << nl
-				<< "This might be caused by multiple occurrences of the same"
-				<< " seed point." << abort(FatalError);
-		}
+			label edgeI = changedEdges_[changedEdgeI];
 
+			if (!changedEdge_[edgeI])
+			{
+				FatalErrorInFunction
+					<< "edge " << edgeI
+					<< " not marked as having been changed" << nl
+					<< "This might be caused by multiple occurrences of the same"
+					<< " seed point." << abort(FatalError);
+			}
 
-		const Type& neighbourWallInfo = allEdgeInfo_[edgeI];
 
-		// Evaluate all connected points (= edge endpoints)
-		const edge& e = mesh_.edges()[edgeI];
+			const Type& neighbourWallInfo = allEdgeInfo_[edgeI];
 
-		forAll(e, eI)
-		{
-			Type& currentWallInfo = allPointInfo_[e[eI]];
+			// Evaluate all connected points (= edge endpoints)
+			const edge& e = mesh_.edges()[edgeI];
 
-			if (!currentWallInfo.equal(neighbourWallInfo, td_))
+			forAll(e, eI)
 			{
-				updatePoint
-				(
-					e[eI],
-					edgeI,
-					neighbourWallInfo,
-					currentWallInfo
-				);
+				Type& currentWallInfo = allPointInfo_[e[eI]];
+
+				if (!currentWallInfo.equal(neighbourWallInfo, td_))
+				{
+					updatePoint
+					(
+						e[eI],
+						edgeI,
+						neighbourWallInfo,
+						currentWallInfo
+					);
+				}
 			}
-		}
 
-		// Reset status of edge
-		changedEdge_[edgeI] = false;
+			// Reset status of edge
+			changedEdge_[edgeI] = false;
+		}
 	}
 
 	// Handled all changed edges by now
@@ -823,49 +1112,61 @@ tnbLib::label tnbLib::PointEdgeWave<Type, TrackingData>::pointToEdge()
 {
 	const labelListList& pointEdges = mesh_.pointEdges();
 
-	for
-		(
-			label changedPointi = 0;
-			changedPointi < nChangedPoints_;
-			changedPointi++
-			)
-	{
-		label pointi = changedPoints_[changedPointi];
+	const label nThreads =
+		threadedWave<Type>()
+	  ? threadLoop::nThreadsFor(nChangedPoints_, minThreadSize_)
+	  : 1;
 
-		if (!changedPoint_[pointi])
+	if (nThreads > 1)
+	{
+		threadedPointToEdge(nThreads);
+	}
+	else
+	{
+		for
+			(
+				label changedPointi = 0;
+				changedPointi < nChangedPoints_;
+				changedPointi++
+				)
 		{
-			FatalErrorInFunction
-				<< "Point " << pointi
-				<< " not marked as having been changed" << nl
-				<< "This might be caused by multiple occurrences of the same"
-				<< " seed point." << abort(FatalError);
-		}
-
-		const Type& neighbourWallInfo = allPointInfo_[pointi];
+			label pointi = changedPoints_[changedPointi];
 
-		// Evaluate all connected edges
+			if (!changedPoint_[pointi])
+			{
+				FatalErrorInFunction
+					<< "Point " << pointi
+					<< " not marked as having been changed" << nl
+					<< "This might be caused by multiple occurrences of the same"
+					<< " seed point." << abort(FatalError);
+			}
 
-		const labelList& edgeLabels = pointEdges[pointi];
-		forAll(edgeLabels, edgeLabelI)
-		{
-			label edgeI = edgeLabels[edgeLabelI];
+			const Type& neighbourWallInfo = allPointInfo_[pointi];
 
-			Type& currentWallInfo = allEdgeInfo_[edgeI];
+			// Evaluate all connected edges
 
-			if (!currentWallInfo.equal(neighbourWallInfo, td_))
+			const labelList& edgeLabels = pointEdges[pointi];
+			forAll(edgeLabels, edgeLabelI)
 			{
-				updateEdge
-				(
-					edgeI,
-					pointi,
-					neighbourWallInfo,
-					currentWallInfo
-				);
+				label edgeI = edgeLabels[edgeLabelI];
+
+				Type& currentWallInfo = allEdgeInfo_[edgeI];
+
+				if (!currentWallInfo.equal(neighbourWallInfo, td_))
+				{
+					updateEdge
+					(
+						edgeI,
+						pointi,
+						neighbourWallInfo,
+						currentWallInfo
+					);
+				}
 			}
-		}
 
-		// Reset status of point
-		changedPoint_[pointi] = false;
+			// Reset status of point
+			changedPoint_[pointi] = false;
+		}
 	}
 
 	// Handled all changed points by now
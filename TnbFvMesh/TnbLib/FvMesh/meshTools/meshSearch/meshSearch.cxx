@@ -6,6 +6,7 @@
 #include <demandDrivenData.hxx>
 #include <treeDataCell.hxx>
 #include <treeDataFace.hxx>
+#include <threadLoop.hxx>
 
 // * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
 
@@ -748,6 +749,50 @@ tnbLib::label tnbLib::meshSearch::findCell
 }
 
 
+tnbLib::labelList tnbLib::meshSearch::findCells
+(
+	const UList<point>& locations
+) const
+{
+	labelList cells(locations.size(), -1);
+
+	if (mesh_.nCells() == 0)
+	{
+		return cells;
+	}
+
+	// Construct the demand-driven data of the inside tests before the
+	// threads start
+	const indexedOctree<treeDataCell>& tree = cellTree();
+	(void)mesh_.cells();
+	(void)mesh_.cellCentres();
+	(void)mesh_.faceCentres();
+	if
+	(
+		cellDecompMode_ == polyMesh::FACE_DIAG_TRIS
+	 || cellDecompMode_ == polyMesh::CELL_TETS
+	)
+	{
+		(void)mesh_.tetBasePtIs();
+	}
+
+	threadLoop::run
+	(
+		locations.size(),
+		[&](const label, const label start, const label end)
+		{
+			for (label i = start; i < end; i++)
+			{
+				cells[i] = tree.findInside(locations[i]);
+			}
+		},
+		100
+	);
+
+	return cells;
+}
+
+
 tnbLib::label tnbLib::meshSearch::findNearestBoundaryFace
 (
 	const point& location,
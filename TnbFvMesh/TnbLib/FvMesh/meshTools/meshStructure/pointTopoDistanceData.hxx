@@ -40,6 +40,7 @@ SourceFiles
 
 #include <point.hxx>
 #include <tensor.hxx>
+#include <threadedWave.hxx>
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
@@ -222,6 +223,14 @@ namespace tnbLib
 	}
 
 
+	//- The updates of pointTopoDistanceData do not read the mesh
+	template<>
+	inline bool threadedWave<pointTopoDistanceData>()
+	{
+		return true;
+	}
+
+
 	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
 } // End namespace tnbLib
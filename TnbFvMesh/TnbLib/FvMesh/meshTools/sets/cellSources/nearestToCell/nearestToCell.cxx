@@ -25,9 +25,14 @@ tnbLib::topoSetSource::addToUsageTable tnbLib::nearestToCell::usage_
 
 void tnbLib::nearestToCell::combine(topoSet& set, const bool add) const
 {
-	forAll(points_, pointi)
+	const labelList nearest(mesh_.findNearestCells(points_));
+
+	forAll(nearest, pointi)
 	{
-		addOrDelete(set, mesh_.findNearestCell(points_[pointi]), add);
+		if (nearest[pointi] != -1)
+		{
+			addOrDelete(set, nearest[pointi], add);
+		}
 	}
 }
 
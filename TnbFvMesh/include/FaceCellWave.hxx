@@ -43,6 +43,12 @@ Description
 	but for non-parallel cyclics this tolerance can be critical and if chosen
 	too small can lead to non-convergence.
 
+	With the nThreads optimisation switch greater than 1 the face to cell and
+	cell to face propagation of large fronts is split between threads, each
+	cell or face being updated by a single thread from all its changed
+	neighbours, for the types for which threadedWave is specialised to
+	return true. Cyclic and processor transfers remain serial.
+
 SourceFiles
 	FaceCellWave.C
 
@@ -52,6 +58,7 @@ SourceFiles
 #include <DynamicList.hxx>
 #include <primitiveFieldsFwd.hxx>
 #include <labelPair.hxx>
+#include <threadedWave.hxx>
 
 //#ifdef FoamFvMesh_EXPORT_DEFINE
 //#define FoamFaceCellWave_EXPORT __declspec(dllexport)
@@ -264,11 +271,23 @@ namespace tnbLib
 		void handleExplicitConnections();
 
 
+		// Threading
+
+			//- Propagate the changed faces to their cells on nThreads threads
+		void threadedFaceToCell(const label nThreads);
+
+		//- Propagate the changed cells to their faces on nThreads threads
+		void threadedCellToFace(const label nThreads);
+
+
 		// Protected static data
 
 		static const scalar geomTol_;
 		static scalar propagationTol_;
 
+		//- Minimum number of changed faces or cells per thread
+		static label minThreadSize_;
+
 		//- Used as default trackdata value to satisfy default template
 		//  argument.
 		static int dummyTrackData_;
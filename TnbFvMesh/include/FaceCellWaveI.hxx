@@ -10,6 +10,8 @@
 #include <typeInfo.hxx>
 #include <SubField.hxx>
 #include <globalMeshData.hxx>
+#include <ListOps.hxx>
+#include <threadLoop.hxx>
 
 // * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
 
@@ -22,6 +24,9 @@ tnbLib::scalar tnbLib::FaceCellWave<Type, TrackingData>::propagationTol_ = 0.01;
 template<class Type, class TrackingData>
 int tnbLib::FaceCellWave<Type, TrackingData>::dummyTrackData_ = 12345;
 
+template<class Type, class TrackingData>
+tnbLib::label tnbLib::FaceCellWave<Type, TrackingData>::minThreadSize_ = 10000;
+
 namespace tnbLib
 {
 	template<class Type, class TrackingData>
@@ -914,6 +919,285 @@ void tnbLib::FaceCellWave<Type, TrackingData>::handleExplicitConnections()
 }
 
 
+template<class Type, class TrackingData>
+void tnbLib::FaceCellWave<Type, TrackingData>::threadedFaceToCell
+(
+	const label nThreads
+)
+{
+	const labelList& owner = mesh_.faceOwner();
+	const labelList& neighbour = mesh_.faceNeighbour();
+	const cellList& cells = mesh_.cells();
+	const label nInternalFaces = mesh_.nInternalFaces();
+
+	// Cells of the changed faces. Each is updated by a single thread from
+	// all its changed faces so no two threads write to the same cell.
+	labelList candidateCells(2*changedFaces_.size());
+	label nCandidates = 0;
+
+	forAll(changedFaces_, changedFacei)
+	{
+		const label facei = changedFaces_[changedFacei];
+
+		candidateCells[nCandidates++] = owner[facei];
+		if (facei < nInternalFaces)
+		{
+			candidateCells[nCandidates++] = neighbour[facei];
+		}
+	}
+	candidateCells.setSize(nCandidates);
+	{
+		labelList order;
+		uniqueOrder(candidateCells, order);
+		candidateCells = UIndirectList<label>(candidateCells, order)();
+	}
+
+	// The geometry Type may read is calculated before the threads start
+	(void)mesh_.cellCentres();
+	(void)mesh_.faceCentres();
+
+	List<DynamicList<label>> threadChangedCells(nThreads);
+	labelList threadNEvals(nThreads, 0);
+	labelList threadNVisited(nThreads, 0);
+
+	threadLoop::run
+	(
+		candidateCells.size(),
+		nThreads,
+		[&](const label threadi, const label start, const label end)
+		{
+			DynamicList<label>& changed = threadChangedCells[threadi];
+			label nEvals = 0;
+			label nVisited = 0;
+
+			for (label i = start; i < end; i++)
+			{
+				const label celli = candidateCells[i];
+				Type& cellInfo = allCellInfo_[celli];
+
+				const bool wasValid = cellInfo.valid(td_);
+				bool propagate = false;
+
+				const labelList& cFaces = cells[celli];
+				forAll(cFaces, cFacei)
+				{
+					const label facei = cFaces[cFacei];
+
+					if (!changedFace_[facei])
+					{
+						continue;
+					}
+
+					const Type& faceInfo = allFaceInfo_[facei];
+
+					if (!cellInfo.equal(faceInfo, td_))
+					{
+						nEvals++;
+
+						if
+						(
+							cellInfo.updateCell
+							(
+								mesh_,
+								celli,
+								facei,
+								faceInfo,
+								propagationTol_,
+								td_
+							)
+						)
+						{
+							propagate = true;
+						}
+					}
+				}
+
+				if (propagate)
+				{
+					changed.append(celli);
+				}
+
+				if (!wasValid && cellInfo.valid(td_))
+				{
+					nVisited++;
+				}
+			}
+
+			threadNEvals[threadi] = nEvals;
+			threadNVisited[threadi] = nVisited;
+		}
+	);
+
+	// Mark the changed cells in thread order
+	forAll(threadChangedCells, threadi)
+	{
+		const DynamicList<label>& changed = threadChangedCells[threadi];
+
+		forAll(changed, i)
+		{
+			if (!changedCell_[changed[i]])
+			{
+				changedCell_[changed[i]] = true;
+				changedCells_.append(changed[i]);
+			}
+		}
+
+		nEvals_ += threadNEvals[threadi];
+		nUnvisitedCells_ -= threadNVisited[threadi];
+	}
+
+	// Reset status of the faces
+	forAll(changedFaces_, changedFacei)
+	{
+		changedFace_[changedFaces_[changedFacei]] = false;
+	}
+}
+
+
+template<class Type, class TrackingData>
+void tnbLib::FaceCellWave<Type, TrackingData>::threadedCellToFace
+(
+	const label nThreads
+)
+{
+	const labelList& owner = mesh_.faceOwner();
+	const labelList& neighbour = mesh_.faceNeighbour();
+	const cellList& cells = mesh_.cells();
+	const label nInternalFaces = mesh_.nInternalFaces();
+
+	// Faces of the changed cells. Each is updated by a single thread from
+	// its changed owner and neighbour.
+	label nCandidates = 0;
+	forAll(changedCells_, changedCelli)
+	{
+		nCandidates += cells[changedCells_[changedCelli]].size();
+	}
+
+	labelList candidateFaces(nCandidates);
+	nCandidates = 0;
+
+	forAll(changedCells_, changedCelli)
+	{
+		const labelList& cFaces = cells[changedCells_[changedCelli]];
+
+		forAll(cFaces, cFacei)
+		{
+			candidateFaces[nCandidates++] = cFaces[cFacei];
+		}
+	}
+	{
+		labelList order;
+		uniqueOrder(candidateFaces, order);
+		candidateFaces = UIndirectList<label>(candidateFaces, order)();
+	}
+
+	// The geometry Type may read is calculated before the threads start
+	(void)mesh_.cellCentres();
+	(void)mesh_.faceCentres();
+
+	List<DynamicList<label>> threadChangedFaces(nThreads);
+	labelList threadNEvals(nThreads, 0);
+	labelList threadNVisited(nThreads, 0);
+
+	threadLoop::run
+	(
+		candidateFaces.size(),
+		nThreads,
+		[&](const label threadi, const label start, const label end)
+		{
+			DynamicList<label>& changed = threadChangedFaces[threadi];
+			label nEvals = 0;
+			label nVisited = 0;
+
+			for (label i = start; i < end; i++)
+			{
+				const label facei = candidateFaces[i];
+				Type& faceInfo = allFaceInfo_[facei];
+
+				const bool wasValid = faceInfo.valid(td_);
+				bool propagate = false;
+
+				for (label sidei = 0; sidei < 2; sidei++)
+				{
+					if (sidei == 1 && facei >= nInternalFaces)
+					{
+						break;
+					}
+
+					const label celli =
+						sidei == 0 ? owner[facei] : neighbour[facei];
+
+					if (!changedCell_[celli])
+					{
+						continue;
+					}
+
+					const Type& cellInfo = allCellInfo_[celli];
+
+					if (!faceInfo.equal(cellInfo, td_))
+					{
+						nEvals++;
+
+						if
+						(
+							faceInfo.updateFace
+							(
+								mesh_,
+								facei,
+								celli,
+								cellInfo,
+								propagationTol_,
+								td_
+							)
+						)
+						{
+							propagate = true;
+						}
+					}
+				}
+
+				if (propagate)
+				{
+					changed.append(facei);
+				}
+
+				if (!wasValid && faceInfo.valid(td_))
+				{
+					nVisited++;
+				}
+			}
+
+			threadNEvals[threadi] = nEvals;
+			threadNVisited[threadi] = nVisited;
+		}
+	);
+
+	// Mark the changed faces in thread order
+	forAll(threadChangedFaces, threadi)
+	{
+		const DynamicList<label>& changed = threadChangedFaces[threadi];
+
+		forAll(changed, i)
+		{
+			if (!changedFace_[changed[i]])
+			{
+				changedFace_[changed[i]] = true;
+				changedFaces_.append(changed[i]);
+			}
+		}
+
+		nEvals_ += threadNEvals[threadi];
+		nUnvisitedFaces_ -= threadNVisited[threadi];
+	}
+
+	// Reset status of the cells
+	forAll(changedCells_, changedCelli)
+	{
+		changedCell_[changedCells_[changedCelli]] = false;
+	}
+}
+
+
 // * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
 
 template<class Type, class TrackingData>
@@ -1117,45 +1401,38 @@ tnbLib::label tnbLib::FaceCellWave<Type, TrackingData>::faceToCell()
 	const labelList& neighbour = mesh_.faceNeighbour();
 	label nInternalFaces = mesh_.nInternalFaces();
 
-	forAll(changedFaces_, changedFacei)
+	const label nThreads =
+		threadedWave<Type>()
+	  ? threadLoop::nThreadsFor(changedFaces_.size(), minThreadSize_)
+	  : 1;
+
+	if (nThreads > 1)
 	{
-		label facei = changedFaces_[changedFacei];
-		if (!changedFace_[facei])
+		threadedFaceToCell(nThreads);
+	}
+	else
+	{
+		forAll(changedFaces_, changedFacei)
 		{
-			FatalErrorInFunction
-				<< "Face " << facei
-				<< " not marked as having been changed"
-				<< abort(FatalError);
-		}
+			label facei = changedFaces_[changedFacei];
+			if (!changedFace_[facei])
+			{
+				FatalErrorInFunction
+					<< "Face " << facei
+					<< " not marked as having been changed"
+					<< abort(FatalError);
+			}
 
 
-		const Type& neighbourWallInfo = allFaceInfo_[facei];
+			const Type& neighbourWallInfo = allFaceInfo_[facei];
 
-		// Evaluate all connected cells
+			// Evaluate all connected cells
 
-		// Owner
-		label celli = owner[facei];
-		Type& currentWallInfo = allCellInfo_[celli];
+			// Owner
+			label celli = owner[facei];
+			Type& currentWallInfo = allCellInfo_[celli];
 
-		if (!currentWallInfo.equal(neighbourWallInfo, td_))
-		{
-			updateCell
-			(
-				celli,
-				facei,
-				neighbourWallInfo,
-				propagationTol_,
-				currentWallInfo
-			);
-		}
-
-		// Neighbour.
-		if (facei < nInternalFaces)
-		{
-			celli = neighbour[facei];
-			Type& currentWallInfo2 = allCellInfo_[celli];
-
-			if (!currentWallInfo2.equal(neighbourWallInfo, td_))
+			if (!currentWallInfo.equal(neighbourWallInfo, td_))
 			{
 				updateCell
 				(
@@ -1163,13 +1440,32 @@ tnbLib::label tnbLib::FaceCellWave<Type, TrackingData>::faceToCell()
 					facei,
 					neighbourWallInfo,
 					propagationTol_,
-					currentWallInfo2
+					currentWallInfo
 				);
 			}
-		}
 
-		// Reset status of face
-		changedFace_[facei] = false;
+			// Neighbour.
+			if (facei < nInternalFaces)
+			{
+				celli = neighbour[facei];
+				Type& currentWallInfo2 = allCellInfo_[celli];
+
+				if (!currentWallInfo2.equal(neighbourWallInfo, td_))
+				{
+					updateCell
+					(
+						celli,
+						facei,
+						neighbourWallInfo,
+						propagationTol_,
+						currentWallInfo2
+					);
+				}
+			}
+
+			// Reset status of face
+			changedFace_[facei] = false;
+		}
 	}
 
 	// Handled all changed faces by now
@@ -1196,41 +1492,53 @@ tnbLib::label tnbLib::FaceCellWave<Type, TrackingData>::cellToFace()
 
 	const cellList& cells = mesh_.cells();
 
-	forAll(changedCells_, changedCelli)
+	const label nThreads =
+		threadedWave<Type>()
+	  ? threadLoop::nThreadsFor(changedCells_.size(), minThreadSize_)
+	  : 1;
+
+	if (nThreads > 1)
 	{
-		label celli = changedCells_[changedCelli];
-		if (!changedCell_[celli])
+		threadedCellToFace(nThreads);
+	}
+	else
+	{
+		forAll(changedCells_, changedCelli)
 		{
-			FatalErrorInFunction
-				<< "Cell " << celli << " not marked as having been changed"
-				<< abort(FatalError);
-		}
-
-		const Type& neighbourWallInfo = allCellInfo_[celli];
+			label celli = changedCells_[changedCelli];
+			if (!changedCell_[celli])
+			{
+				FatalErrorInFunction
+					<< "Cell " << celli << " not marked as having been changed"
+					<< abort(FatalError);
+			}
 
-		// Evaluate all connected faces
+			const Type& neighbourWallInfo = allCellInfo_[celli];
 
-		const labelList& faceLabels = cells[celli];
-		forAll(faceLabels, faceLabelI)
-		{
-			label facei = faceLabels[faceLabelI];
-			Type& currentWallInfo = allFaceInfo_[facei];
+			// Evaluate all connected faces
 
-			if (!currentWallInfo.equal(neighbourWallInfo, td_))
+			const labelList& faceLabels = cells[celli];
+			forAll(faceLabels, faceLabelI)
 			{
-				updateFace
-				(
-					facei,
-					celli,
-					neighbourWallInfo,
-					propagationTol_,
-					currentWallInfo
-				);
+				label facei = faceLabels[faceLabelI];
+				Type& currentWallInfo = allFaceInfo_[facei];
+
+				if (!currentWallInfo.equal(neighbourWallInfo, td_))
+				{
+					updateFace
+					(
+						facei,
+						celli,
+						neighbourWallInfo,
+						propagationTol_,
+						currentWallInfo
+					);
+				}
 			}
-		}
 
-		// Reset status of cell
-		changedCell_[celli] = false;
+			// Reset status of cell
+			changedCell_[celli] = false;
+		}
 	}
 
 	// Handled all changed cells by now
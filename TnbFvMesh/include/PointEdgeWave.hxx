@@ -54,6 +54,12 @@ Description
 	(it probably is more efficient to calculate a point-point
 	correspondence at the start and then reuse this; task to be done)
 
+	Note: with the nThreads optimisation switch greater than 1 the edge to
+	point and point to edge propagation of large fronts is split between
+	threads, each point or edge being updated by a single thread from all
+	its changed neighbours, for the types for which threadedWave is
+	specialised to return true.
+
 SourceFiles
 	PointEdgeWave.C
 
@@ -62,6 +68,7 @@ SourceFiles
 #include <boolList.hxx>
 #include <scalarField.hxx>
 #include <tensorField.hxx>
+#include <threadedWave.hxx>
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
@@ -105,6 +112,9 @@ namespace tnbLib
 			  //  up to Type implementation)
 		static scalar propagationTol_;
 
+		//- Minimum number of changed points or edges per thread
+		static label minThreadSize_;
+
 		//- Used as default trackdata value to satisfy default template
 		//  argument.
 		static int dummyTrackData_;
@@ -204,6 +214,16 @@ namespace tnbLib
 			Type& edgeInfo
 		);
 
+
+		// Threading
+
+			//- Propagate the changed edges to their points on nThreads threads
+		void threadedEdgeToPoint(const label nThreads);
+
+		//- Propagate the changed points to their edges on nThreads threads
+		void threadedPointToEdge(const label nThreads);
+
+
 		// Parallel, cyclic
 
 			//- Has patches of certain type?
@@ -235,6 +235,13 @@ namespace tnbLib
 			const bool useTreeSearch = true
 		) const;
 
+		//- Find the cells containing a set of locations with the octree,
+		//  in parallel. Returns -1 for the locations not in the domain.
+		FoamFvMesh_EXPORT labelList findCells
+		(
+			const UList<point>& locations
+		) const;
+
 		//- Find nearest boundary face
 		//  If seed provided walks but then does not pass local minima
 		//  in distance. Also does not jump from one connected region to
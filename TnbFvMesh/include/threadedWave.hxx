@@ -0,0 +1,57 @@
+#pragma once
+#ifndef _threadedWave_Header
+#define _threadedWave_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+InClass
+	tnbLib::threadedWave
+
+Description
+	Template function to specify if FaceCellWave and PointEdgeWave may
+	propagate the data of a type on several threads.
+
+	The default function specifies that they may not. It is specialised for
+	the types whose update functions only read the data they are given and
+	the mesh geometry and addressing calculated before the threads start:
+	the points, edges, cell and face centres. Types which construct mesh
+	data on demand, e.g. the face edges, or which modify the tracking data
+	must not be specialised.
+
+\*---------------------------------------------------------------------------*/
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	//- Assume the updates of type T are not thread-safe
+	template<class T>
+	inline bool threadedWave() { return false; }
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_threadedWave_Header
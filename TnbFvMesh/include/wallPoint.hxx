@@ -42,6 +42,7 @@ SourceFiles
 #include <label.hxx>
 #include <scalar.hxx>
 #include <tensor.hxx>
+#include <threadedWave.hxx>
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
@@ -223,6 +224,14 @@ namespace tnbLib
 	}
 
 
+	//- The updates of wallPoint only read the cell and face centres
+	template<>
+	inline bool threadedWave<wallPoint>()
+	{
+		return true;
+	}
+
+
 	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
 } // End namespace tnbLib
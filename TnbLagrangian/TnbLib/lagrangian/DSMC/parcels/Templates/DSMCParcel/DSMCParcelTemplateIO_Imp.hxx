@@ -108,9 +108,9 @@ void tnbLib::DSMCParcel<ParcelType>::writeFields
 		i++;
 	}
 
-	U.write(np > 0);
-	Ei.write(np > 0);
-	typeId.write(np > 0);
+	c.writeField(U, np > 0);
+	c.writeField(Ei, np > 0);
+	c.writeField(typeId, np > 0);
 }
 
 
@@ -31,6 +31,34 @@ Class
 Description
 	Base cloud calls templated on particle type
 
+	The particles can be sorted by cell, and with particle pooling enabled
+	moved into contiguous storage in that order, every cloudSortInterval
+	time steps (optimisation switch, default 0 for no sorting) to improve
+	the memory locality of the tracking. See particlePool. Compaction
+	invalidates pointers to the particles, e.g. the cell occupancy of the
+	KinematicCloud, which is rebuilt after the move.
+
+	Clouds which return true from threadedTracking() are tracked by
+	threadLoop::nThreads threads, each moving a contiguous range of the
+	particles with its own tracking data and deferring the deletion and
+	processor transfer of its particles to the end of the sweep. These are
+	then carried out serially in the order of the threads so that the
+	result is independent of the scheduling. The derived clouds provide the
+	per-thread tracking data and accumulators through the threadTrackingData,
+	beginThreadedMove and endThreadedMove hooks and serialise access to
+	other shared state with threadLock().
+
+	In parallel the particles crossing processor patches are exchanged in
+	rounds until none are left in transit. The message sizes of a round
+	are only exchanged with the neighbour processors and the end of the
+	transfers is detected by a single logical reduction.
+
+	With the optimisation switch cloudColumns the fields written through
+	writeField are collected into a single cloudColumns file per time
+	rather than one file per field. The fields are read from the columns
+	file, if present, through fieldIOobject and checkFieldIOobject so the
+	parcels read either layout.
+
 SourceFiles
 	Cloud.C
 	CloudIO.C
@@ -43,6 +71,11 @@ SourceFiles
 #include <CompactIOField.hxx>
 #include <polyMesh.hxx>
 #include <PackedBoolList.hxx>
+#include <particlePool.hxx>
+#include <cloudColumns.hxx>
+#include <threadLoop.hxx>
+
+#include <mutex>
 
 #ifdef FoamLagrangian_EXPORT_DEFINE
 #define FoamCloud_EXPORT __declspec(dllexport)
@@ -92,10 +125,54 @@ namespace tnbLib
 		//- Temporary storage for the global particle positions
 		mutable autoPtr<vectorField> globalPositionsPtr_;
 
+		//- Particles held back during a redistribution of the mesh
+		IDLList<ParticleType> distributedParticles_;
+
+		//- Time index of the last sorting of the particles
+		label sortTimeIndex_;
+
+		//- Is a threaded move in progress
+		bool threadedMove_;
+
+		//- Mutex serialising access to shared data during a threaded move
+		mutable std::recursive_mutex threadMutex_;
+
+		//- Columns file being written or read
+		mutable autoPtr<cloudColumns> columnsPtr_;
+
+
+		// Private Classes
+
+			//- Read-construct particles of this type from the transfer
+		//  stream. Not all particle types provide their own iNew.
+		class readParticle
+		{
+			const polyMesh& mesh_;
+
+		public:
+
+			readParticle(const polyMesh& mesh)
+				:
+				mesh_(mesh)
+			{}
+
+			autoPtr<ParticleType> operator()(Istream& is) const
+			{
+				return autoPtr<ParticleType>
+				(
+					new ParticleType(mesh_, is, true)
+				);
+			}
+		};
+
 
 		// Private Member Functions
 
-			//- Check patches
+			//- Return the columns file of the current time for reading
+		cloudColumns& readColumns() const;
+
+		//- Check that the patches and the numbering of the mesh are
+		//  supported
 		void checkPatches() const;
 
 		//- Initialise cloud on IO constructor
@@ -107,6 +184,20 @@ namespace tnbLib
 		//- Write cloud properties dictionary
 		void writeCloudUniformProperties() const;
 
+		//- Track the particles with the given number of threads, appending
+		//  the particles to be transferred to the transfer lists
+		template<class TrackCloudType>
+		void moveThreaded
+		(
+			TrackCloudType& cloud,
+			typename ParticleType::trackingData& td,
+			const scalar trackTime,
+			const label nThreads,
+			const labelList& neighbourProcIndices,
+			List<IDLList<ParticleType>>& particleTransferLists,
+			List<DynamicList<label>>& patchIndexTransferLists
+		);
+
 
 	public:
 
@@ -132,6 +223,9 @@ namespace tnbLib
 			//- Name of cloud properties dictionary
 		static word cloudPropertiesName;
 
+		//- Minimum number of particles per thread for threaded tracking
+		static const label minThreadSize = 1000;
+
 
 		// Constructors
 
@@ -222,6 +316,60 @@ namespace tnbLib
 		//- Reset the particles
 		void cloudReset(const Cloud<ParticleType>& c);
 
+		//- Sort the particles by cell and, if the particles are pooled,
+		//  compact them into contiguous storage in that order
+		void sortByCell();
+
+		// Threaded tracking
+
+			//- Return true if the particles may be tracked by several
+			//  threads. False by default.
+		bool threadedTracking() const
+		{
+			return false;
+		}
+
+		//- Return the tracking data for a thread other than the first
+		//  constructed from the tracking data of the move
+		template<class TrackCloudType>
+		autoPtr<typename ParticleType::trackingData> threadTrackingData
+		(
+			TrackCloudType& cloud,
+			const typename ParticleType::trackingData& td
+		) const
+		{
+			NotImplemented;
+			return autoPtr<typename ParticleType::trackingData>();
+		}
+
+		//- Prepare for a threaded move with the given number of threads
+		void beginThreadedMove(const label nThreads)
+		{
+			threadedMove_ = true;
+		}
+
+		//- Finish a threaded move
+		void endThreadedMove()
+		{
+			threadedMove_ = false;
+		}
+
+		//- Return true during a threaded move
+		bool threadedMove() const
+		{
+			return threadedMove_;
+		}
+
+		//- Return a lock on the cloud during a threaded move and an
+		//  empty lock otherwise
+		std::unique_lock<std::recursive_mutex> threadLock() const
+		{
+			return
+				threadedMove_
+			  ? std::unique_lock<std::recursive_mutex>(threadMutex_)
+			  : std::unique_lock<std::recursive_mutex>();
+		}
+
 		//- Move the particles
 		template<class TrackCloudType>
 		void move
@@ -235,6 +383,17 @@ namespace tnbLib
 		//  mesh topology change
 		void autoMap(const mapPolyMesh&);
 
+		//- Hold back the particles ahead of a redistribution of the mesh
+		//  so that they are left untouched by its topology changes
+		virtual void beginDistribute();
+
+		//- Send the held back particles to the processors their cells
+		//  have been distributed to and add them back to the cloud
+		virtual void distribute(const mapDistributePolyMesh&);
+
+		//- Add the number of particles in each cell to nParticles
+		virtual void countParticles(labelList& nParticles) const;
+
 
 		// Read
 
@@ -245,12 +404,13 @@ namespace tnbLib
 			const IOobject::readOption r
 		) const;
 
-		//- Check lagrangian data field
+		//- Check lagrangian data field, reading it from the columns file
+		//  if it is there
 		template<class DataType>
 		void checkFieldIOobject
 		(
 			const Cloud<ParticleType>& c,
-			const IOField<DataType>& data
+			IOField<DataType>& data
 		) const;
 
 		//- Check lagrangian data fieldfield
@@ -268,6 +428,11 @@ namespace tnbLib
 			//  this level.
 		virtual void writeFields() const;
 
+		//- Write a field of the particles, into the columns file if
+		//  the optimisation switch cloudColumns is on
+		template<class Type>
+		void writeField(const IOField<Type>& fld, const bool valid) const;
+
 		//- Write using given format, version and compression.
 		//  Only writes the cloud file if the Cloud isn't empty
 		virtual bool writeObject
@@ -0,0 +1,197 @@
+#include <cloudColumns.hxx>
+
+#include <tnbDebug.hxx>
+#include <registerSwitch.hxx>
+
+// * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+	defineTypeNameAndDebug(cloudColumns, 0);
+}
+
+bool tnbLib::cloudColumns::active
+(
+	tnbLib::debug::optimisationSwitch("cloudColumns", 0)
+);
+registerOptSwitch
+(
+	"cloudColumns",
+	bool,
+	tnbLib::cloudColumns::active
+);
+
+int tnbLib::cloudColumns::defaultChunkSize
+(
+	tnbLib::debug::optimisationSwitch("cloudColumnsChunkSize", 65536)
+);
+registerOptSwitch
+(
+	"cloudColumnsChunkSize",
+	int,
+	tnbLib::cloudColumns::defaultChunkSize
+);
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+void tnbLib::cloudColumns::readTOC()
+{
+	Istream& is = readStream(typeName);
+
+	wordList names(0);
+	wordList types(0);
+	labelList sizes(0);
+
+	is >> nRows_ >> chunkSize_ >> names >> types >> sizes;
+
+	is.check(FUNCTION_NAME);
+
+	names_ = names;
+	types_ = types;
+	sizes_ = sizes;
+	nextColumn_ = 0;
+}
+
+
+void tnbLib::cloudColumns::readChunks(const label columni, char* buf)
+{
+	if (columni < nextColumn_)
+	{
+		// The stream is past the column so read it again from the start
+		close();
+		readTOC();
+	}
+
+	Istream& is = readStream(typeName);
+
+	List<char> skipped;
+
+	for (; nextColumn_ <= columni; nextColumn_++)
+	{
+		const label size = sizes_[nextColumn_];
+		const bool skip = nextColumn_ != columni;
+
+		if (skip)
+		{
+			skipped.setSize(min(chunkSize_, nRows_)*size);
+		}
+
+		for (label start = 0; start < nRows_; start += chunkSize_)
+		{
+			const label n = min(chunkSize_, nRows_ - start);
+
+			is.read(skip ? skipped.begin() : buf + start*size, n*size);
+		}
+	}
+
+	is.check(FUNCTION_NAME);
+
+	// Release the file once the last column has been read
+	if (nextColumn_ == names_.size())
+	{
+		close();
+	}
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+tnbLib::cloudColumns::cloudColumns(const IOobject& io)
+	:
+	regIOobject(io),
+	nRows_(0),
+	chunkSize_(max(defaultChunkSize, 1)),
+	names_(),
+	types_(),
+	sizes_(),
+	data_(),
+	nextColumn_(0)
+{
+	if
+	(
+		readOpt() == IOobject::MUST_READ
+	 || (readOpt() == IOobject::READ_IF_PRESENT && headerOk())
+	)
+	{
+		readTOC();
+	}
+}
+
+
+// * * * * * * * * * * * * * * * * Selectors * * * * * * * * * * * * * * * //
+
+tnbLib::autoPtr<tnbLib::cloudColumns> tnbLib::cloudColumns::New
+(
+	const IOobjectList& cloudObjects
+)
+{
+	const IOobject* ioPtr = cloudObjects.lookup(typeName);
+
+	if (!ioPtr)
+	{
+		return autoPtr<cloudColumns>();
+	}
+
+	IOobject io(*ioPtr);
+	io.readOpt() = IOobject::MUST_READ;
+	io.registerObject() = false;
+
+	return autoPtr<cloudColumns>(new cloudColumns(io));
+}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+tnbLib::cloudColumns::~cloudColumns()
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+bool tnbLib::cloudColumns::found(const word& name) const
+{
+	return findIndex(names_, name) != -1;
+}
+
+
+bool tnbLib::cloudColumns::writeData(Ostream& os) const
+{
+	os << nRows_ << token::SPACE << chunkSize_ << nl
+		<< names_ << nl
+		<< types_ << nl
+		<< sizes_ << nl;
+
+	forAll(data_, columni)
+	{
+		const label size = sizes_[columni];
+		const char* data = data_[columni].begin();
+
+		for (label start = 0; start < nRows_; start += chunkSize_)
+		{
+			const label n = min(chunkSize_, nRows_ - start);
+
+			os.write(data + start*size, n*size);
+		}
+
+		os << nl;
+	}
+
+	return os.good();
+}
+
+
+bool tnbLib::cloudColumns::writeObject
+(
+	IOstream::streamFormat,
+	IOstream::versionNumber ver,
+	IOstream::compressionType cmp,
+	const bool write
+) const
+{
+	// The chunks are raw binary blocks
+	return regIOobject::writeObject(IOstream::BINARY, ver, cmp, write);
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,131 @@
+#pragma once
+#include <ListOps.hxx>
+#include <contiguous.hxx>
+
+#include <cstring>
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+template<class Type>
+tnbLib::wordList tnbLib::cloudColumns::columnNames
+(
+	const IOobjectList& cloudObjects
+) const
+{
+	DynamicList<word> names(names_.size());
+
+	forAll(names_, columni)
+	{
+		if
+		(
+			types_[columni] == pTraits<Type>::typeName
+		 && !cloudObjects.lookup(names_[columni])
+		)
+		{
+			names.append(names_[columni]);
+		}
+	}
+
+	wordList result;
+	result.transfer(names);
+	return result;
+}
+
+
+template<class Type>
+void tnbLib::cloudColumns::add(const word& name, const UList<Type>& fld)
+{
+	if (!contiguous<Type>())
+	{
+		FatalErrorInFunction
+			<< "Column " << name << " of non-contiguous type "
+			<< pTraits<Type>::typeName << " cannot be written to "
+			<< objectPath() << exit(FatalError);
+	}
+
+	if (names_.empty())
+	{
+		nRows_ = fld.size();
+	}
+	else if (fld.size() != nRows_)
+	{
+		FatalErrorInFunction
+			<< "Size of column " << name << " " << fld.size()
+			<< " does not match the number of rows " << nRows_
+			<< " of " << objectPath() << exit(FatalError);
+	}
+
+	names_.append(name);
+	types_.append(pTraits<Type>::typeName);
+	sizes_.append(sizeof(Type));
+
+	List<char>* dataPtr = new List<char>(fld.size()*sizeof(Type));
+	if (fld.size())
+	{
+		std::memcpy(dataPtr->begin(), fld.begin(), dataPtr->size());
+	}
+	data_.append(dataPtr);
+}
+
+
+template<class Type>
+tnbLib::tmp<tnbLib::Field<Type>>
+tnbLib::cloudColumns::readColumn(const word& name)
+{
+	const label columni = findIndex(names_, name);
+
+	if (columni == -1)
+	{
+		FatalErrorInFunction
+			<< "Column " << name << " not found in " << objectPath() << nl
+			<< "Available columns " << names_
+			<< exit(FatalError);
+	}
+
+	if
+	(
+		types_[columni] != pTraits<Type>::typeName
+	 || sizes_[columni] != label(sizeof(Type))
+	)
+	{
+		FatalErrorInFunction
+			<< "Column " << name << " of " << objectPath()
+			<< " is of type " << types_[columni] << " with "
+			<< sizes_[columni] << " bytes per element, not "
+			<< pTraits<Type>::typeName << " with " << label(sizeof(Type))
+			<< exit(FatalError);
+	}
+
+	tmp<Field<Type>> tfld(new Field<Type>(nRows_));
+
+	readChunks(columni, reinterpret_cast<char*>(tfld.ref().begin()));
+
+	return tfld;
+}
+
+
+template<class Type>
+tnbLib::autoPtr<tnbLib::IOField<Type>>
+tnbLib::cloudColumns::readField(const word& name)
+{
+	return autoPtr<IOField<Type>>
+	(
+		new IOField<Type>
+		(
+			IOobject
+			(
+				name,
+				instance(),
+				local(),
+				db(),
+				IOobject::NO_READ,
+				IOobject::NO_WRITE,
+				false
+			),
+			readColumn<Type>(name)
+		)
+	);
+}
+
+
+// ************************************************************************* //
@@ -7,6 +7,9 @@
 #include <mapPolyMesh.hxx>  // added by amir
 #include <meshTools.hxx>  // added by amir
 #include <indexedOctree.hxx>  // added by amir
+#include <polyMeshTetTransforms.hxx>
+#include <tnbDebug.hxx>
+#include <registerSwitch.hxx>
 
 // * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
 
@@ -14,6 +17,17 @@ const tnbLib::label tnbLib::particle::maxNBehind_ = 10;
 
 tnbLib::label tnbLib::particle::particleCount_ = 0;
 
+bool tnbLib::particle::cacheTetTransforms
+(
+	tnbLib::debug::optimisationSwitch("cacheTetTransforms", 0)
+);
+registerOptSwitch
+(
+	"cacheTetTransforms",
+	bool,
+	tnbLib::particle::cacheTetTransforms
+);
+
 namespace tnbLib
 {
 	defineTypeNameAndDebug(particle, 0);
@@ -29,25 +43,23 @@ void tnbLib::particle::stationaryTetReverseTransform
 	barycentricTensor& T
 ) const
 {
-	barycentricTensor A = stationaryTetTransform();
-
-	const vector ab = A.b() - A.a();
-	const vector ac = A.c() - A.a();
-	const vector ad = A.d() - A.a();
-	const vector bc = A.c() - A.b();
-	const vector bd = A.d() - A.b();
+	if (cacheTetTransforms)
+	{
+		const polyMeshTetTransforms::transform& t =
+			mesh_.tetTransforms()(celli_, tetFacei_, tetPti_);
 
-	centre = A.a();
+		centre = mesh_.cellCentres()[celli_];
+		detA = t.detA;
+		T = t.T;
+	}
+	else
+	{
+		const barycentricTensor A = stationaryTetTransform();
 
-	detA = ab & (ac ^ ad);
+		centre = A.a();
 
-	T = barycentricTensor
-	(
-		bd ^ bc,
-		ac ^ ad,
-		ad ^ ab,
-		ab ^ ac
-	);
+		polyMeshTetTransforms::reverseTransform(A, detA, T);
+	}
 }
 
 
@@ -1192,6 +1204,22 @@ void tnbLib::particle::autoMap
 }
 
 
+void tnbLib::particle::autoMap
+(
+	const vector& position,
+	const label celli
+)
+{
+	locate
+	(
+		position,
+		celli,
+		true,
+		"Particle distributed to a location outside of the mesh."
+	);
+}
+
+
 // * * * * * * * * * * * * * * Friend Operators * * * * * * * * * * * * * * //
 
 FoamLagrangian_EXPORT bool tnbLib::operator==(const particle& pA, const particle& pB)
@@ -0,0 +1,277 @@
+#include <particlePool.hxx>
+
+#include <tnbDebug.hxx>
+#include <registerSwitch.hxx>
+#include <error.hxx>
+
+#include <new>
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+// * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
+
+bool tnbLib::particlePool::enabled
+(
+	tnbLib::debug::optimisationSwitch("particlePool", 0)
+);
+registerOptSwitch
+(
+	"particlePool",
+	bool,
+	tnbLib::particlePool::enabled
+);
+
+int tnbLib::particlePool::slabSize
+(
+	tnbLib::debug::optimisationSwitch("particlePoolSlabSize", 4096)
+);
+registerOptSwitch
+(
+	"particlePoolSlabSize",
+	int,
+	tnbLib::particlePool::slabSize
+);
+
+std::atomic<tnbLib::particlePool*>
+tnbLib::particlePool::pools_[maxSlotSize_/slotAlign_] = {};
+
+std::mutex tnbLib::particlePool::poolsMutex_;
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+tnbLib::particlePool& tnbLib::particlePool::pool(const std::size_t size)
+{
+	const std::size_t i = (size - 1)/slotAlign_;
+
+	particlePool* poolPtr = pools_[i].load();
+
+	if (!poolPtr)
+	{
+		std::lock_guard<std::mutex> lock(poolsMutex_);
+
+		poolPtr = pools_[i].load();
+
+		if (!poolPtr)
+		{
+			poolPtr = new particlePool((i + 1)*slotAlign_);
+			pools_[i].store(poolPtr);
+		}
+	}
+
+	return *poolPtr;
+}
+
+
+std::map<char*, tnbLib::particlePool::slab>::iterator
+tnbLib::particlePool::findSlab(void* ptr)
+{
+	char* slot = static_cast<char*>(ptr);
+
+	// The last slab starting at or before the slot
+	std::map<char*, slab>::iterator iter = slabs_.upper_bound(slot);
+
+	if (iter == slabs_.begin())
+	{
+		return slabs_.end();
+	}
+
+	--iter;
+
+	if (slot < iter->first + slotSize_*iter->second.nSlots)
+	{
+		return iter;
+	}
+
+	return slabs_.end();
+}
+
+
+void* tnbLib::particlePool::allocateSlot()
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	if (freeSlots_.size())
+	{
+		void* ptr = freeSlots_.remove();
+		findSlab(ptr)->second.nLive++;
+		return ptr;
+	}
+
+	if (!slab_ || nextSlot_ == slabNSlots_)
+	{
+		slabNSlots_ = max(slabSize, 1);
+		slab_ = static_cast<char*>(::operator new(slabNSlots_*slotSize_));
+		nextSlot_ = 0;
+
+		const slab newSlab = {slabNSlots_, 0, false};
+		slabs_.insert(std::make_pair(slab_, newSlab));
+	}
+
+	slabs_[slab_].nLive++;
+
+	return slab_ + slotSize_*nextSlot_++;
+}
+
+
+bool tnbLib::particlePool::deallocateSlot(void* ptr)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	std::map<char*, slab>::iterator iter = findSlab(ptr);
+
+	if (iter == slabs_.end())
+	{
+		return false;
+	}
+
+	iter->second.nLive--;
+
+	if (!iter->second.old)
+	{
+		freeSlots_.append(ptr);
+	}
+	else if (iter->second.nLive == 0)
+	{
+		// None of the slots of an old slab are in the free list
+		::operator delete(iter->first);
+		slabs_.erase(iter);
+	}
+
+	return true;
+}
+
+
+void tnbLib::particlePool::beginPoolCompaction()
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	// The free slots all belong to the slabs which become old
+	freeSlots_.clear();
+
+	std::map<char*, slab>::iterator iter = slabs_.begin();
+
+	while (iter != slabs_.end())
+	{
+		if (iter->second.nLive == 0)
+		{
+			::operator delete(iter->first);
+			iter = slabs_.erase(iter);
+		}
+		else
+		{
+			iter->second.old = true;
+			++iter;
+		}
+	}
+
+	// Start a new slab for the compacted particles
+	slab_ = nullptr;
+	nextSlot_ = 0;
+	slabNSlots_ = 0;
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+tnbLib::particlePool::particlePool(const std::size_t slotSize)
+	:
+	slotSize_(slotSize),
+	slabs_(),
+	slab_(nullptr),
+	nextSlot_(0),
+	slabNSlots_(0),
+	freeSlots_()
+{}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+tnbLib::particlePool::~particlePool()
+{
+	for
+	(
+		std::map<char*, slab>::iterator iter = slabs_.begin();
+		iter != slabs_.end();
+		++iter
+	)
+	{
+		::operator delete(iter->first);
+	}
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void* tnbLib::particlePool::allocate(const std::size_t size)
+{
+	if (!enabled || size > maxSlotSize_)
+	{
+		return ::operator new(size);
+	}
+
+	return pool(size).allocateSlot();
+}
+
+
+void tnbLib::particlePool::deallocate(void* ptr, const std::size_t size)
+{
+	if (!ptr)
+	{
+		return;
+	}
+
+	// Return the particle to the pool it was allocated from, if any,
+	// whatever the current value of the switch
+	if (size <= maxSlotSize_)
+	{
+		particlePool* poolPtr = pools_[(size - 1)/slotAlign_].load();
+
+		if (poolPtr && poolPtr->deallocateSlot(ptr))
+		{
+			return;
+		}
+	}
+
+	::operator delete(ptr);
+}
+
+
+void tnbLib::particlePool::beginCompaction()
+{
+	std::lock_guard<std::mutex> lock(poolsMutex_);
+
+	for (std::size_t i = 0; i < maxSlotSize_/slotAlign_; i++)
+	{
+		if (pools_[i].load())
+		{
+			pools_[i].load()->beginPoolCompaction();
+		}
+	}
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,83 @@
+#include <spatialHash.hxx>
+
+#include <ListOps.hxx>
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+tnbLib::spatialHash::spatialHash()
+	:
+	binSize_(1),
+	bucketStart_(2, 0),
+	pointOrder_()
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void tnbLib::spatialHash::build
+(
+	const UList<point>& points,
+	const scalar binSize
+)
+{
+	binSize_ = binSize;
+
+	// Counting sort of the points by bucket
+	bucketStart_.setSize(max(2*points.size(), 1) + 1);
+	bucketStart_ = 0;
+
+	labelList pointBucket(points.size());
+
+	forAll(points, pointi)
+	{
+		pointBucket[pointi] = bucket(points[pointi]);
+		bucketStart_[pointBucket[pointi] + 1]++;
+	}
+
+	for (label bucketi = 1; bucketi < bucketStart_.size(); bucketi++)
+	{
+		bucketStart_[bucketi] += bucketStart_[bucketi - 1];
+	}
+
+	pointOrder_.setSize(points.size());
+
+	labelList bucketEnd(SubList<label>(bucketStart_, nBuckets()));
+
+	forAll(points, pointi)
+	{
+		pointOrder_[bucketEnd[pointBucket[pointi]]++] = pointi;
+	}
+}
+
+
+void tnbLib::spatialHash::neighbourBuckets
+(
+	const point& pt,
+	DynamicList<label>& buckets
+) const
+{
+	buckets.clear();
+
+	const int64_t i0 = bin(pt.x());
+	const int64_t j0 = bin(pt.y());
+	const int64_t k0 = bin(pt.z());
+
+	for (int64_t i = i0 - 1; i <= i0 + 1; i++)
+	{
+		for (int64_t j = j0 - 1; j <= j0 + 1; j++)
+		{
+			for (int64_t k = k0 - 1; k <= k0 + 1; k++)
+			{
+				const label bucketi = bucket(i, j, k);
+
+				if (findIndex(buckets, bucketi) == -1)
+				{
+					buckets.append(bucketi);
+				}
+			}
+		}
+	}
+}
+
+
+// ************************************************************************* //
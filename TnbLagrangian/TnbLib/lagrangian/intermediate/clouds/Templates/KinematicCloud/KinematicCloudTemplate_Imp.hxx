@@ -251,6 +251,58 @@ void tnbLib::KinematicCloud<CloudType>::cloudReset(KinematicCloud<CloudType>& c)
 }
 
 
+template<class CloudType>
+template<class Type>
+void tnbLib::KinematicCloud<CloudType>::setThreadFields
+(
+	const DimensionedField<Type, volMesh>& field,
+	PtrList<DimensionedField<Type, volMesh>>& threadFields,
+	const label nThreads
+)
+{
+	threadFields.setSize(nThreads - 1);
+
+	forAll(threadFields, i)
+	{
+		threadFields.set
+		(
+			i,
+			new DimensionedField<Type, volMesh>
+			(
+				IOobject
+				(
+					field.name() + ":thread" + tnbLib::name(i + 1),
+					field.instance(),
+					field.db(),
+					IOobject::NO_READ,
+					IOobject::NO_WRITE,
+					false
+				),
+				field.mesh(),
+				dimensioned<Type>(field.dimensions(), Zero)
+			)
+		);
+	}
+}
+
+
+template<class CloudType>
+template<class Type>
+void tnbLib::KinematicCloud<CloudType>::addThreadFields
+(
+	DimensionedField<Type, volMesh>& field,
+	PtrList<DimensionedField<Type, volMesh>>& threadFields
+)
+{
+	forAll(threadFields, i)
+	{
+		field.field() += threadFields[i].field();
+	}
+
+	threadFields.clear();
+}
+
+
 // * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
 
 template<class CloudType>
@@ -624,6 +676,60 @@ void tnbLib::KinematicCloud<CloudType>::scaleSources()
 }
 
 
+template<class CloudType>
+template<class TrackCloudType>
+tnbLib::autoPtr
+<
+	typename tnbLib::KinematicCloud<CloudType>::parcelType::trackingData
+>
+tnbLib::KinematicCloud<CloudType>::threadTrackingData
+(
+	TrackCloudType& cloud,
+	const typename parcelType::trackingData& td
+) const
+{
+	return autoPtr<typename parcelType::trackingData>
+	(
+		new typename parcelType::trackingData(cloud, td.part())
+	);
+}
+
+
+template<class CloudType>
+void tnbLib::KinematicCloud<CloudType>::beginThreadedMove
+(
+	const label nThreads
+)
+{
+	CloudType::beginThreadedMove(nThreads);
+
+	// Construct the demand-driven data used by the parcels before the
+	// threads start
+	mesh_.V();
+
+	setThreadFields(UTrans_(), threadUTrans_, nThreads);
+	setThreadFields(UCoeff_(), threadUCoeff_, nThreads);
+
+	threadRndGen_.setSize(nThreads - 1);
+	forAll(threadRndGen_, i)
+	{
+		threadRndGen_.set(i, new Random(rndGen_.sampleAB<label>(0, labelMax)));
+	}
+}
+
+
+template<class CloudType>
+void tnbLib::KinematicCloud<CloudType>::endThreadedMove()
+{
+	addThreadFields(UTrans_(), threadUTrans_);
+	addThreadFields(UCoeff_(), threadUCoeff_);
+
+	threadRndGen_.clear();
+
+	CloudType::endThreadedMove();
+}
+
+
 template<class CloudType>
 void tnbLib::KinematicCloud<CloudType>::preEvolve()
 {
@@ -23,6 +23,7 @@ tnbLib::cloudSolution::cloudSolution
 	cellValueSourceCorrection_(false),
 	maxTrackTime_(0),
 	resetSourcesOnStartup_(true),
+	threadedTracking_(false),
 	schemes_()
 {
 	if (active_)
@@ -49,6 +50,7 @@ tnbLib::cloudSolution::cloudSolution
 	cellValueSourceCorrection_(cs.cellValueSourceCorrection_),
 	maxTrackTime_(cs.maxTrackTime_),
 	resetSourcesOnStartup_(cs.resetSourcesOnStartup_),
+	threadedTracking_(cs.threadedTracking_),
 	schemes_(cs.schemes_)
 {}
 
@@ -70,6 +72,7 @@ tnbLib::cloudSolution::cloudSolution
 	cellValueSourceCorrection_(false),
 	maxTrackTime_(0),
 	resetSourcesOnStartup_(false),
+	threadedTracking_(false),
 	schemes_()
 {}
 
@@ -112,6 +115,7 @@ void tnbLib::cloudSolution::read()
 	dict_.lookup("coupled") >> coupled_;
 	dict_.lookup("cellValueSourceCorrection") >> cellValueSourceCorrection_;
 	dict_.readIfPresent("maxCo", maxCo_);
+	dict_.readIfPresent("threadedTracking", threadedTracking_);
 
 	if (steadyState())
 	{
@@ -100,6 +100,9 @@ namespace tnbLib
 		//  reset on start-up/first read
 		Switch resetSourcesOnStartup_;
 
+		//- Flag to track the parcels with threadLoop::nThreads threads
+		Switch threadedTracking_;
+
 		//- List schemes, e.g. U semiImplicit 1
 		List<Tuple2<word, Tuple2<bool, scalar>>> schemes_;
 
@@ -181,6 +184,9 @@ namespace tnbLib
 		//- Return const access to the reset sources flag
 		inline const Switch resetSourcesOnStartup() const;
 
+		//- Return const access to the threaded tracking flag
+		inline const Switch threadedTracking() const;
+
 		//- Source terms dictionary
 		inline const dictionary& sourceTermDict() const;
 
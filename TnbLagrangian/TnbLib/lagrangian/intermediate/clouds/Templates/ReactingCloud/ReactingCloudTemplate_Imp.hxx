@@ -290,6 +290,39 @@ void tnbLib::ReactingCloud<CloudType>::scaleSources()
 }
 
 
+template<class CloudType>
+void tnbLib::ReactingCloud<CloudType>::beginThreadedMove(const label nThreads)
+{
+	CloudType::beginThreadedMove(nThreads);
+
+	threadRhoTrans_.setSize(rhoTrans_.size());
+
+	forAll(rhoTrans_, fieldi)
+	{
+		this->setThreadFields
+		(
+			rhoTrans_[fieldi],
+			threadRhoTrans_[fieldi],
+			nThreads
+		);
+	}
+}
+
+
+template<class CloudType>
+void tnbLib::ReactingCloud<CloudType>::endThreadedMove()
+{
+	forAll(threadRhoTrans_, fieldi)
+	{
+		this->addThreadFields(rhoTrans_[fieldi], threadRhoTrans_[fieldi]);
+	}
+
+	threadRhoTrans_.clear();
+
+	CloudType::endThreadedMove();
+}
+
+
 template<class CloudType>
 void tnbLib::ReactingCloud<CloudType>::evolve()
 {
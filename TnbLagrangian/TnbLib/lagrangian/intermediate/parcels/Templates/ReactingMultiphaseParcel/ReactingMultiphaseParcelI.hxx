@@ -361,6 +361,7 @@ void tnbLib::ReactingMultiphaseParcel<ParcelType>::readFields
 			),
 			valid
 		);
+		c.checkFieldIOobject(c, YGas);
 
 		label i = 0;
 		forAllIter
@@ -386,6 +387,7 @@ void tnbLib::ReactingMultiphaseParcel<ParcelType>::readFields
 			),
 			valid
 		);
+		c.checkFieldIOobject(c, YLiquid);
 
 		label i = 0;
 		forAllIter
@@ -411,6 +413,7 @@ void tnbLib::ReactingMultiphaseParcel<ParcelType>::readFields
 			),
 			valid
 		);
+		c.checkFieldIOobject(c, YSolid);
 
 		label i = 0;
 		forAllIter
@@ -477,7 +480,7 @@ void tnbLib::ReactingMultiphaseParcel<ParcelType>::writeFields
 				YGas[i++] = p0.YGas()[j] * p0.Y()[GAS];
 			}
 
-			YGas.write(np > 0);
+			c.writeField(YGas, np > 0);
 		}
 
 		const label idLiquid = compModel.idLiquid();
@@ -506,7 +509,7 @@ void tnbLib::ReactingMultiphaseParcel<ParcelType>::writeFields
 				YLiquid[i++] = p0.YLiquid()[j] * p0.Y()[LIQ];
 			}
 
-			YLiquid.write(np > 0);
+			c.writeField(YLiquid, np > 0);
 		}
 
 		const label idSolid = compModel.idSolid();
@@ -535,7 +538,7 @@ void tnbLib::ReactingMultiphaseParcel<ParcelType>::writeFields
 				YSolid[i++] = p0.YSolid()[j] * p0.Y()[SLD];
 			}
 
-			YSolid.write(np > 0);
+			c.writeField(YSolid, np > 0);
 		}
 	}
 }
@@ -938,7 +941,10 @@ void tnbLib::ReactingMultiphaseParcel<ParcelType>::calc
 			cloud.hsTrans()[this->cell()] +=
 				dm * HsEff(cloud, td, pc, T0, idG, idL, idS);
 
-			cloud.phaseChange().addToPhaseChangeMass(np0 * mass1);
+			{
+				std::unique_lock<std::recursive_mutex> lock(cloud.threadLock());
+				cloud.phaseChange().addToPhaseChangeMass(np0 * mass1);
+			}
 		}
 
 		return;
@@ -1120,10 +1126,13 @@ void tnbLib::ReactingMultiphaseParcel<ParcelType>::calcDevolatilisation
 
 	scalar dMassTot = sum(dMassDV);
 
-	cloud.devolatilisation().addToDevolatilisationMass
-	(
-		this->nParticle_ * dMassTot
-	);
+	{
+		std::unique_lock<std::recursive_mutex> lock(cloud.threadLock());
+		cloud.devolatilisation().addToDevolatilisationMass
+		(
+			this->nParticle_ * dMassTot
+		);
+	}
 
 	Sh -= dMassTot * cloud.constProps().LDevol() / dt;
 
@@ -1221,11 +1230,14 @@ void tnbLib::ReactingMultiphaseParcel<ParcelType>::calcSurfaceReactions
 		dMassSRCarrier
 	);
 
-	cloud.surfaceReaction().addToSurfaceReactionMass
-	(
-		this->nParticle_
-		* (sum(dMassSRGas) + sum(dMassSRLiquid) + sum(dMassSRSolid))
-	);
+	{
+		std::unique_lock<std::recursive_mutex> lock(cloud.threadLock());
+		cloud.surfaceReaction().addToSurfaceReactionMass
+		(
+			this->nParticle_
+			* (sum(dMassSRGas) + sum(dMassSRLiquid) + sum(dMassSRSolid))
+		);
+	}
 
 	const scalar xsi = min(T / cloud.constProps().TMax(), 1.0);
 	const scalar coeff =
@@ -308,6 +308,7 @@ void tnbLib::ReactingParcel<ParcelType>::readFields
 			),
 			valid
 		);
+		c.checkFieldIOobject(c, Y);
 
 		label i = 0;
 		forAllIter(typename Cloud<ReactingParcel<ParcelType>>, c, iter)
@@ -348,7 +349,7 @@ void tnbLib::ReactingParcel<ParcelType>::writeFields
 			const ReactingParcel<ParcelType>& p = iter();
 			mass0[i++] = p.mass0_;
 		}
-		mass0.write(np > 0);
+		c.writeField(mass0, np > 0);
 
 		// Write the composition fractions
 		const wordList& phaseTypes = compModel.phaseTypes();
@@ -381,7 +382,7 @@ void tnbLib::ReactingParcel<ParcelType>::writeFields
 				Y[i++] = p.Y()[j];
 			}
 
-			Y.write(np > 0);
+			c.writeField(Y, np > 0);
 		}
 	}
 }
@@ -506,8 +507,12 @@ void tnbLib::ReactingParcel<ParcelType>::calcPhaseChange
 
 	const scalar dMassTot = sum(dMassPC);
 
-	// Add to cumulative phase change mass
-	phaseChange.addToPhaseChangeMass(this->nParticle_ * dMassTot);
+	// Add to cumulative phase change mass, shared by the threads of a
+	// threaded move
+	{
+		std::unique_lock<std::recursive_mutex> lock(cloud.threadLock());
+		phaseChange.addToPhaseChangeMass(this->nParticle_ * dMassTot);
+	}
 
 	forAll(dMassPC, i)
 	{
@@ -911,7 +916,10 @@ void tnbLib::ReactingParcel<ParcelType>::calc
 			}
 			cloud.UTrans()[this->cell()] += dm * U0;
 
-			cloud.phaseChange().addToPhaseChangeMass(np0 * mass1);
+			{
+				std::unique_lock<std::recursive_mutex> lock(cloud.threadLock());
+				cloud.phaseChange().addToPhaseChangeMass(np0 * mass1);
+			}
 		}
 
 		return;
@@ -4,6 +4,8 @@
 #include <volFields.hxx>
 
 #include <PstreamReduceOps.hxx>  // added by amir
+#include <PstreamCombineReduceOps.hxx>
+#include <UIndirectList.hxx>
 
 using namespace tnbLib::constant::mathematical;
 
@@ -158,6 +160,127 @@ bool tnbLib::InjectionModel<CloudType>::findCellAtPosition
 }
 
 
+template<class CloudType>
+tnbLib::PackedBoolList tnbLib::InjectionModel<CloudType>::findCellsAtPositions
+(
+	labelList& cells,
+	labelList& tetFaces,
+	labelList& tetPts,
+	UList<vector>& positions,
+	bool errorOnNotFound
+)
+{
+	const polyMesh& mesh = this->owner().mesh();
+	const volVectorField& cellCentres = this->owner().mesh().C();
+
+	mesh.findCells(positions, cells, tetFaces, tetPts);
+
+	// Highest processor which found each position
+	labelList procs(positions.size(), -1);
+	forAll(cells, i)
+	{
+		if (cells[i] >= 0)
+		{
+			procs[i] = Pstream::myProcNo();
+		}
+	}
+
+	Pstream::listCombineGather(procs, maxEqOp<label>());
+	Pstream::listCombineScatter(procs);
+
+	// Last chance for the positions not found - move them towards the
+	// nearest cell centre and try again - the point is probably on an edge
+	DynamicList<label> missing;
+	forAll(procs, i)
+	{
+		if (procs[i] == -1)
+		{
+			missing.append(i);
+		}
+	}
+
+	if (missing.size())
+	{
+		const labelList nearest
+		(
+			mesh.findNearestCells
+			(
+				pointField(UIndirectList<vector>(positions, missing))
+			)
+		);
+
+		pointField missingPositions(missing.size());
+		forAll(missing, missingi)
+		{
+			vector& position = positions[missing[missingi]];
+
+			if (nearest[missingi] >= 0)
+			{
+				position += small*(cellCentres[nearest[missingi]] - position);
+			}
+
+			missingPositions[missingi] = position;
+		}
+
+		labelList missingCells, missingTetFaces, missingTetPts;
+		mesh.findCells
+		(
+			missingPositions,
+			missingCells,
+			missingTetFaces,
+			missingTetPts
+		);
+
+		forAll(missing, missingi)
+		{
+			const label i = missing[missingi];
+
+			cells[i] = missingCells[missingi];
+			tetFaces[i] = missingTetFaces[missingi];
+			tetPts[i] = missingTetPts[missingi];
+
+			if (cells[i] >= 0)
+			{
+				procs[i] = Pstream::myProcNo();
+			}
+		}
+
+		Pstream::listCombineGather(procs, maxEqOp<label>());
+		Pstream::listCombineScatter(procs);
+	}
+
+	// Ensure that only one processor attempts to insert each parcel
+	PackedBoolList found(positions.size());
+
+	forAll(procs, i)
+	{
+		if (procs[i] != Pstream::myProcNo())
+		{
+			cells[i] = -1;
+			tetFaces[i] = -1;
+			tetPts[i] = -1;
+		}
+
+		if (procs[i] == -1)
+		{
+			if (errorOnNotFound)
+			{
+				FatalErrorInFunction
+					<< "Cannot find parcel injection cell. "
+					<< "Parcel position = " << positions[i] << nl
+					<< exit(FatalError);
+			}
+		}
+		else
+		{
+			found[i] = true;
+		}
+	}
+
+	return found;
+}
+
+
 template<class CloudType>
 tnbLib::scalar tnbLib::InjectionModel<CloudType>::setNumberOfParticles
 (
@@ -86,15 +86,23 @@ template<class CloudType>
 void tnbLib::KinematicLookupTableInjection<CloudType>::updateMesh()
 {
 	// Set/cache the injector cells
+	pointField positions(injectors_.size());
 	forAll(injectors_, i)
 	{
-		this->findCellAtPosition
-		(
-			injectorCells_[i],
-			injectorTetFaces_[i],
-			injectorTetPts_[i],
-			injectors_[i].x()
-		);
+		positions[i] = injectors_[i].x();
+	}
+
+	this->findCellsAtPositions
+	(
+		injectorCells_,
+		injectorTetFaces_,
+		injectorTetPts_,
+		positions
+	);
+
+	forAll(injectors_, i)
+	{
+		injectors_[i].x() = positions[i];
 	}
 }
 
@@ -89,28 +89,19 @@ tnbLib::ManualInjection<CloudType>::~ManualInjection()
 template<class CloudType>
 void tnbLib::ManualInjection<CloudType>::updateMesh()
 {
-	label nRejected = 0;
-
-	PackedBoolList keep(positions_.size(), true);
+	const PackedBoolList keep
+	(
+		this->findCellsAtPositions
+		(
+			injectorCells_,
+			injectorTetFaces_,
+			injectorTetPts_,
+			positions_,
+			!ignoreOutOfBounds_
+		)
+	);
 
-	forAll(positions_, pI)
-	{
-		if
-			(
-				!this->findCellAtPosition
-				(
-					injectorCells_[pI],
-					injectorTetFaces_[pI],
-					injectorTetPts_[pI],
-					positions_[pI],
-					!ignoreOutOfBounds_
-				)
-				)
-		{
-			keep[pI] = false;
-			nRejected++;
-		}
-	}
+	const label nRejected = positions_.size() - keep.count();
 
 	if (nRejected > 0)
 	{
@@ -43,6 +43,7 @@ SourceFiles
 #include <runTimeSelectionTables.hxx>
 
 #include <tmp.hxx>  // added by amir
+#include <UList.hxx>
 #include <FieldField.hxx> // added by amir
 #include <vector.hxx>  // added by amir
 #include <fvPatchFields.hxx>  // added by amir
@@ -99,6 +100,16 @@ namespace tnbLib
 			//- Update the gradient calculation
 		virtual void updateGrad();
 
+		//- Add point value to the given sums of the interpolation, which
+		//  have the layout of this average
+		virtual void addTo
+		(
+			FieldField<Field, Type>& sums,
+			const barycentric& coordinates,
+			const tetIndices& tetIs,
+			const Type& value
+		) const = 0;
+
 
 	public:
 
@@ -216,7 +227,17 @@ namespace tnbLib
 			const barycentric& coordinates,
 			const tetIndices& tetIs,
 			const Type& value
-		) = 0;
+		);
+
+		//- Add the point values of a set of parcels to the interpolation.
+		//  The parcels are shared between the threads, each of which sums
+		//  into its own copy of the data, and the copies are then reduced.
+		void add
+		(
+			const UList<barycentric>& coordinates,
+			const UList<tetIndices>& tetIs,
+			const UList<Type>& values
+		);
 
 		//- Interpolate
 		virtual Type interpolate
@@ -8,6 +8,9 @@
 #include <Time.hxx>  // added by amir
 #include <polyMeshTetDecomposition.hxx>  // added by amir
 #include <volMesh.hxx>  // added by amir
+#include <tetIndices.hxx>
+#include <PtrList.hxx>
+#include <threadLoop.hxx>
 
 // * * * * * * * * * * * * Protected Member Functions  * * * * * * * * * * * //
 
@@ -97,6 +100,105 @@ tnbLib::AveragingMethod<Type>::~AveragingMethod()
 
 // * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
 
+template<class Type>
+void tnbLib::AveragingMethod<Type>::add
+(
+	const barycentric& coordinates,
+	const tetIndices& tetIs,
+	const Type& value
+)
+{
+	addTo(*this, coordinates, tetIs, value);
+}
+
+
+template<class Type>
+void tnbLib::AveragingMethod<Type>::add
+(
+	const UList<barycentric>& coordinates,
+	const UList<tetIndices>& tetIs,
+	const UList<Type>& values
+)
+{
+	const label nThreads = threadLoop::nThreadsFor(values.size(), 1000);
+
+	if (nThreads <= 1)
+	{
+		forAll(values, i)
+		{
+			addTo(*this, coordinates[i], tetIs[i], values[i]);
+		}
+
+		return;
+	}
+
+	// Construct the demand-driven mesh data used by the deposition before
+	// the threads start
+	mesh_.tetBasePtIs();
+	mesh_.C();
+	mesh_.V();
+
+	// Private sums of the threads other than the first, which sums into
+	// this average directly
+	PtrList<FieldField<Field, Type>> threadSums(nThreads);
+	for (label threadi = 1; threadi < nThreads; threadi++)
+	{
+		threadSums.set(threadi, new FieldField<Field, Type>(this->size()));
+
+		forAll(*this, fieldi)
+		{
+			threadSums[threadi].set
+			(
+				fieldi,
+				new Field<Type>(this->operator[](fieldi).size(), Zero)
+			);
+		}
+	}
+
+	threadLoop::run
+	(
+		values.size(),
+		nThreads,
+		[&](const label threadi, const label start, const label end)
+		{
+			FieldField<Field, Type>& sums =
+				threadi == 0
+			  ? static_cast<FieldField<Field, Type>&>(*this)
+			  : threadSums[threadi];
+
+			for (label i = start; i < end; i++)
+			{
+				addTo(sums, coordinates[i], tetIs[i], values[i]);
+			}
+		}
+	);
+
+	// Reduce the private sums, the entries being shared between the threads
+	forAll(*this, fieldi)
+	{
+		Field<Type>& f = this->operator[](fieldi);
+
+		threadLoop::run
+		(
+			f.size(),
+			[&](const label, const label start, const label end)
+			{
+				for (label threadi = 1; threadi < nThreads; threadi++)
+				{
+					const Field<Type>& tf = threadSums[threadi][fieldi];
+
+					for (label i = start; i < end; i++)
+					{
+						f[i] += tf[i];
+					}
+				}
+			},
+			1000
+		);
+	}
+}
+
+
 template<class Type>
 void tnbLib::AveragingMethod<Type>::average()
 {
@@ -112,7 +214,25 @@ void tnbLib::AveragingMethod<Type>::average
 {
 	updateGrad();
 
-	*this /= max(weight, small);
+	// Divide in place rather than through the max(weight, small) temporary
+	forAll(*this, fieldi)
+	{
+		Field<Type>& f = this->operator[](fieldi);
+		const Field<scalar>& w = weight[fieldi];
+
+		threadLoop::run
+		(
+			f.size(),
+			[&](const label, const label start, const label end)
+			{
+				for (label i = start; i < end; i++)
+				{
+					f[i] /= max(w[i], small);
+				}
+			},
+			1000
+		);
+	}
 }
 
 
@@ -65,14 +65,15 @@ void tnbLib::AveragingMethods::Basic<Type>::updateGrad()
 // * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
 
 template<class Type>
-void tnbLib::AveragingMethods::Basic<Type>::add
+void tnbLib::AveragingMethods::Basic<Type>::addTo
 (
+	FieldField<Field, Type>& sums,
 	const barycentric& coordinates,
 	const tetIndices& tetIs,
 	const Type& value
-)
+) const
 {
-	data_[tetIs.cell()] += value / this->mesh_.V()[tetIs.cell()];
+	sums[0][tetIs.cell()] += value / this->mesh_.V()[tetIs.cell()];
 }
 
 
@@ -103,12 +103,13 @@ void tnbLib::AveragingMethods::Moment<Type>::updateGrad()
 // * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
 
 template<class Type>
-void tnbLib::AveragingMethods::Moment<Type>::add
+void tnbLib::AveragingMethods::Moment<Type>::addTo
 (
+	FieldField<Field, Type>& sums,
 	const barycentric& coordinates,
 	const tetIndices& tetIs,
 	const Type& value
-)
+) const
 {
 	const label celli = tetIs.cell();
 	const triFace triIs = tetIs.faceTriIs(this->mesh_);
@@ -122,10 +123,10 @@ void tnbLib::AveragingMethods::Moment<Type>::add
 	const Type v = value / this->mesh_.V()[celli];
 	const TypeGrad dv = transform_[celli] & (v*delta / scale_[celli]);
 
-	data_[celli] += v;
-	dataX_[celli] += v + dv.x();
-	dataY_[celli] += v + dv.y();
-	dataZ_[celli] += v + dv.z();
+	sums[0][celli] += v;
+	sums[1][celli] += v + dv.x();
+	sums[2][celli] += v + dv.y();
+	sums[3][celli] += v + dv.z();
 }
 
 
@@ -200,21 +200,21 @@ void tnbLib::molecule::writeFields(const Cloud<molecule>& mC)
 
 	const bool write = np > 0;
 
-	Q.write(write);
-	v.write(write);
-	a.write(write);
-	pi.write(write);
-	tau.write(write);
-	specialPosition.write(write);
-	special.write(write);
-	id.write(write);
-
-	piGlobal.write(write);
-	tauGlobal.write(write);
-
-	orientation1.write(write);
-	orientation2.write(write);
-	orientation3.write(write);
+	mC.writeField(Q, write);
+	mC.writeField(v, write);
+	mC.writeField(a, write);
+	mC.writeField(pi, write);
+	mC.writeField(tau, write);
+	mC.writeField(specialPosition, write);
+	mC.writeField(special, write);
+	mC.writeField(id, write);
+
+	mC.writeField(piGlobal, write);
+	mC.writeField(tauGlobal, write);
+
+	mC.writeField(orientation1, write);
+	mC.writeField(orientation2, write);
+	mC.writeField(orientation3, write);
 
 	Info << "writeFields " << mC.name() << endl;
 
@@ -82,8 +82,8 @@ void tnbLib::solidParticle::writeFields(const Cloud<solidParticle>& c)
 		i++;
 	}
 
-	d.write(np > 0);
-	U.write(np > 0);
+	c.writeField(d, np > 0);
+	c.writeField(U, np > 0);
 }
 
 
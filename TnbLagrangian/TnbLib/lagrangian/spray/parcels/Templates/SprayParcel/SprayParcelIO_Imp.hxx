@@ -261,19 +261,19 @@ void tnbLib::SprayParcel<ParcelType>::writeFields
 
 	const bool write = np > 0;
 
-	d0.write(write);
-	position0.write(write);
-	sigma.write(write);
-	mu.write(write);
-	liquidCore.write(write);
-	KHindex.write(write);
-	y.write(write);
-	yDot.write(write);
-	tc.write(write);
-	ms.write(write);
-	injector.write(write);
-	tMom.write(write);
-	user.write(write);
+	c.writeField(d0, write);
+	c.writeField(position0, write);
+	c.writeField(sigma, write);
+	c.writeField(mu, write);
+	c.writeField(liquidCore, write);
+	c.writeField(KHindex, write);
+	c.writeField(y, write);
+	c.writeField(yDot, write);
+	c.writeField(tc, write);
+	c.writeField(ms, write);
+	c.writeField(injector, write);
+	c.writeField(tMom, write);
+	c.writeField(user, write);
 }
 
 
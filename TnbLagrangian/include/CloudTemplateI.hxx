@@ -3,10 +3,13 @@
 #include <globalMeshData.hxx>
 #include <PstreamCombineReduceOps.hxx>
 #include <mapPolyMesh.hxx>
+#include <mapDistributePolyMesh.hxx>
+#include <polyMeshTetTransforms.hxx>
 #include <Time.hxx>
 #include <OFstream.hxx>
 #include <wallPolyPatch.hxx>
 #include <cyclicAMIPolyPatch.hxx>
+#include <fvMesh.hxx>
 
 #include <UOPstream.hxx>  // added by amir
 
@@ -35,6 +38,161 @@ void tnbLib::Cloud<ParticleType>::checkPatches() const
 			<< "supported for cases where the AMI patches reside on a "
 			<< "single processor" << abort(FatalError);
 	}
+
+	// The particle positions are not renumbered with the mesh
+	if
+	(
+		isA<fvMesh>(polyMesh_)
+	 && refCast<const fvMesh>(polyMesh_).renumbered()
+	)
+	{
+		FatalErrorInFunction
+			<< "Clouds are not supported on the renumbered mesh "
+			<< polyMesh_.name() << nl
+			<< "Remove the renumber sub-dictionary of the controlDict"
+			<< abort(FatalError);
+	}
+}
+
+
+template<class ParticleType>
+template<class TrackCloudType>
+void tnbLib::Cloud<ParticleType>::moveThreaded
+(
+	TrackCloudType& cloud,
+	typename ParticleType::trackingData& td,
+	const scalar trackTime,
+	const label nThreads,
+	const labelList& neighbourProcIndices,
+	List<IDLList<ParticleType>>& particleTransferLists,
+	List<DynamicList<label>>& patchIndexTransferLists
+)
+{
+	const polyBoundaryMesh& pbm = pMesh().boundaryMesh();
+	const labelList& procPatchNeighbours =
+		polyMesh_.globalData().processorPatchNeighbours();
+
+	// Construct the demand-driven mesh data used by the tracking before the
+	// threads start
+	polyMesh_.cells();
+	polyMesh_.cellCentres();
+	polyMesh_.cellVolumes();
+	polyMesh_.faceCentres();
+	polyMesh_.faceAreas();
+	polyMesh_.tetBasePtIs();
+	polyMesh_.oldCellCentres();
+	polyMesh_.geometricD();
+	polyMesh_.solutionD();
+	pbm.patchID();
+	if (ParticleType::cacheTetTransforms)
+	{
+		polyMesh_.tetTransforms();
+	}
+
+	// Tracking data of the threads other than the first, which uses td
+	PtrList<typename ParticleType::trackingData> threadTd(nThreads);
+	for (label threadi = 1; threadi < nThreads; threadi++)
+	{
+		threadTd.set(threadi, cloud.threadTrackingData(cloud, td).ptr());
+	}
+
+	// Particles to be deleted and transferred by each thread and the
+	// patches through which they are transferred
+	List<DynamicList<ParticleType*>> threadDeletions(nThreads);
+	List<DynamicList<ParticleType*>> threadTransfers(nThreads);
+	List<DynamicList<label>> threadTransferPatches(nThreads);
+
+	cloud.beginThreadedMove(nThreads);
+
+	// Particles added during a sweep, e.g. by the patch interactions, are
+	// appended to the cloud and tracked by a further sweep. Particles are
+	// only removed after the last sweep so the position of the untracked
+	// particles in the cloud is known.
+	DynamicList<ParticleType*> particles(this->size());
+	label nTracked = 0;
+
+	while (nTracked < this->size())
+	{
+		particles.clear();
+
+		label particlei = 0;
+		forAllIter(typename Cloud<ParticleType>, *this, pIter)
+		{
+			if (particlei++ >= nTracked)
+			{
+				particles.append(&pIter());
+			}
+		}
+
+		nTracked = this->size();
+
+		// Fewer threads for the few particles added during a sweep
+		const label nSweepThreads = min
+		(
+			nThreads,
+			threadLoop::nThreadsFor(particles.size(), minThreadSize)
+		);
+
+		threadLoop::run
+		(
+			particles.size(),
+			nSweepThreads,
+			[&](const label threadi, const label start, const label end)
+			{
+				typename ParticleType::trackingData& ttd =
+					threadi ? threadTd[threadi] : td;
+
+				for (label i = start; i < end; i++)
+				{
+					ParticleType& p = *particles[i];
+
+					if (!p.move(cloud, ttd, trackTime))
+					{
+						threadDeletions[threadi].append(&p);
+					}
+					else if (ttd.switchProcessor)
+					{
+						threadTransferPatches[threadi].append(p.patch());
+
+						p.prepareForParallelTransfer();
+
+						threadTransfers[threadi].append(&p);
+					}
+				}
+			}
+		);
+	}
+
+	cloud.endThreadedMove();
+
+	// Delete and transfer the particles in the order of the threads
+	forAll(threadDeletions, threadi)
+	{
+		forAll(threadDeletions[threadi], i)
+		{
+			deleteParticle(*threadDeletions[threadi][i]);
+		}
+
+		forAll(threadTransfers[threadi], i)
+		{
+			const label patchi = threadTransferPatches[threadi][i];
+
+			const label n = neighbourProcIndices
+				[
+					refCast<const processorPolyPatch>
+					(
+						pbm[patchi]
+					).neighbProcNo()
+				];
+
+			particleTransferLists[n].append
+			(
+				this->remove(threadTransfers[threadi][i])
+			);
+
+			patchIndexTransferLists[n].append(procPatchNeighbours[patchi]);
+		}
+	}
 }
 
 
@@ -51,7 +209,10 @@ tnbLib::Cloud<ParticleType>::Cloud
 	cloud(pMesh, cloudName),
 	IDLList<ParticleType>(),
 	polyMesh_(pMesh),
-	globalPositionsPtr_()
+	globalPositionsPtr_(),
+	sortTimeIndex_(-1),
+	threadedMove_(false),
+	columnsPtr_()
 {
 	checkPatches();
 
@@ -73,6 +234,8 @@ tnbLib::Cloud<ParticleType>::Cloud
 template<class ParticleType>
 void tnbLib::Cloud<ParticleType>::addParticle(ParticleType* pPtr)
 {
+	std::unique_lock<std::recursive_mutex> lock(threadLock());
+
 	this->append(pPtr);
 }
 
@@ -113,6 +276,59 @@ void tnbLib::Cloud<ParticleType>::cloudReset(const Cloud<ParticleType>& c)
 }
 
 
+template<class ParticleType>
+void tnbLib::Cloud<ParticleType>::sortByCell()
+{
+	const label nParticles = this->size();
+
+	if (!nParticles)
+	{
+		return;
+	}
+
+	// Counting sort by cell, lost particles first
+	labelList cellStart(polyMesh_.nCells() + 2, 0);
+
+	forAllConstIter(typename Cloud<ParticleType>, *this, iter)
+	{
+		cellStart[iter().cell() + 2]++;
+	}
+
+	for (label i = 2; i < cellStart.size(); i++)
+	{
+		cellStart[i] += cellStart[i - 1];
+	}
+
+	List<ParticleType*> sortedParticles(nParticles);
+
+	while (this->size())
+	{
+		ParticleType* pPtr = this->removeHead();
+		sortedParticles[cellStart[pPtr->cell() + 1]++] = pPtr;
+	}
+
+	// Copy the particles into new pool slots in the sorted order
+	if (particlePool::enabled)
+	{
+		particlePool::beginCompaction();
+
+		forAll(sortedParticles, i)
+		{
+			ParticleType* pPtr =
+				static_cast<ParticleType*>(sortedParticles[i]->clone().ptr());
+
+			delete sortedParticles[i];
+			sortedParticles[i] = pPtr;
+		}
+	}
+
+	forAll(sortedParticles, i)
+	{
+		this->append(sortedParticles[i]);
+	}
+}
+
+
 template<class ParticleType>
 template<class TrackCloudType>
 void tnbLib::Cloud<ParticleType>::move
@@ -143,6 +359,20 @@ void tnbLib::Cloud<ParticleType>::move
 		neighbourProcIndices[neighbourProcs[i]] = i;
 	}
 
+	// Sort the particles by cell every sortInterval time steps
+	const label timeIndex = polyMesh_.time().timeIndex();
+
+	if
+	(
+		cloud::sortInterval > 0
+	 && timeIndex != sortTimeIndex_
+	 && timeIndex % cloud::sortInterval == 0
+	)
+	{
+		sortByCell();
+		sortTimeIndex_ = timeIndex;
+	}
+
 	// Initialise the stepFraction moved for the particles
 	forAllIter(typename Cloud<ParticleType>, *this, pIter)
 	{
@@ -178,58 +408,80 @@ void tnbLib::Cloud<ParticleType>::move
 			patchIndexTransferLists[i].clear();
 		}
 
-		// Loop over all particles
-		forAllIter(typename Cloud<ParticleType>, *this, pIter)
+		// Number of tracking threads
+		const label nThreads =
+			cloud.threadedTracking()
+		  ? threadLoop::nThreadsFor(this->size(), minThreadSize)
+		  : 1;
+
+		if (nThreads > 1)
 		{
-			ParticleType& p = pIter();
+			moveThreaded
+			(
+				cloud,
+				td,
+				trackTime,
+				nThreads,
+				neighbourProcIndices,
+				particleTransferLists,
+				patchIndexTransferLists
+			);
+		}
+		else
+		{
+			// Loop over all particles
+			forAllIter(typename Cloud<ParticleType>, *this, pIter)
+			{
+				ParticleType& p = pIter();
 
-			// Move the particle
-			bool keepParticle = p.move(cloud, td, trackTime);
+				// Move the particle
+				bool keepParticle = p.move(cloud, td, trackTime);
 
-			// If the particle is to be kept
-			// (i.e. it hasn't passed through an inlet or outlet)
-			if (keepParticle)
-			{
-				if (td.switchProcessor)
+				// If the particle is to be kept
+				// (i.e. it hasn't passed through an inlet or outlet)
+				if (keepParticle)
 				{
-#ifdef FULLDEBUG
-					if
-						(
-							!Pstream::parRun()
-							|| !p.onBoundaryFace()
-							|| procPatchNeighbours[p.patch()] < 0
-							)
+					if (td.switchProcessor)
 					{
-						FatalErrorInFunction
-							<< "Switch processor flag is true when no parallel "
-							<< "transfer is possible. This is a bug."
-							<< exit(FatalError);
-					}
+#ifdef FULLDEBUG
+						if
+							(
+								!Pstream::parRun()
+								|| !p.onBoundaryFace()
+								|| procPatchNeighbours[p.patch()] < 0
+								)
+						{
+							FatalErrorInFunction
+								<< "Switch processor flag is true when no parallel "
+								<< "transfer is possible. This is a bug."
+								<< exit(FatalError);
+						}
 #endif
 
-					const label patchi = p.patch();
+						const label patchi = p.patch();
 
-					const label n = neighbourProcIndices
-						[
-							refCast<const processorPolyPatch>
-							(
-								pbm[patchi]
-								).neighbProcNo()
-						];
+						const label n = neighbourProcIndices
+							[
+								refCast<const processorPolyPatch>
+								(
+									pbm[patchi]
+									).neighbProcNo()
+							];
 
-					p.prepareForParallelTransfer();
+						p.prepareForParallelTransfer();
 
-					particleTransferLists[n].append(this->remove(&p));
+						particleTransferLists[n].append(this->remove(&p));
 
-					patchIndexTransferLists[n].append
-					(
-						procPatchNeighbours[patchi]
-					);
+						patchIndexTransferLists[n].append
+						(
+							procPatchNeighbours[patchi]
+						);
+					}
+				}
+				else
+				{
+					deleteParticle(p);
 				}
-			}
-			else
-			{
-				deleteParticle(p);
 			}
 		}
 
@@ -239,6 +491,26 @@ void tnbLib::Cloud<ParticleType>::move
 		}
 
 
+		// Stop when no processor has particles to transfer. This is a
+		// single-word reduction rather than an all-to-all of the transfer
+		// sizes, and the last round does not exchange any buffers.
+		bool transferred = false;
+
+		forAll(particleTransferLists, i)
+		{
+			if (particleTransferLists[i].size())
+			{
+				transferred = true;
+				break;
+			}
+		}
+		reduce(transferred, orOp<bool>());
+
+		if (!transferred)
+		{
+			break;
+		}
+
 		// Clear transfer buffers
 		pBufs.clear();
 
@@ -260,27 +532,11 @@ void tnbLib::Cloud<ParticleType>::move
 		}
 
 
-		// Start sending. Sets number of bytes transferred
+		// Start sending. Sets number of bytes transferred. The particles
+		// only go to the neighbour processors so the sizes are exchanged
+		// with the neighbours only.
 		labelList allNTrans(Pstream::nProcs());
-		pBufs.finishedSends(allNTrans);
-
-
-		bool transferred = false;
-
-		forAll(allNTrans, i)
-		{
-			if (allNTrans[i])
-			{
-				transferred = true;
-				break;
-			}
-		}
-		reduce(transferred, orOp<bool>());
-
-		if (!transferred)
-		{
-			break;
-		}
+		pBufs.finishedNeighbourSends(neighbourProcs, allNTrans);
 
 		// Retrieve from receive buffers
 		forAll(neighbourProcs, i)
@@ -347,6 +603,146 @@ void tnbLib::Cloud<ParticleType>::autoMap(const mapPolyMesh& mapper)
 }
 
 
+template<class ParticleType>
+void tnbLib::Cloud<ParticleType>::beginDistribute()
+{
+	// The positions are stored in the order of the held back particles.
+	// The cloud is left empty so the mapping of the topology changes of the
+	// distribution does not touch the particles.
+	storeGlobalPositions();
+
+	distributedParticles_.transfer(*this);
+}
+
+
+template<class ParticleType>
+void tnbLib::Cloud<ParticleType>::distribute(const mapDistributePolyMesh& map)
+{
+	if (!globalPositionsPtr_.valid())
+	{
+		FatalErrorInFunction
+			<< "Global positions are not available. "
+			<< "Cloud::beginDistribute has not been called."
+			<< exit(FatalError);
+	}
+
+	// Ask for the tetBasePtIs to trigger all processors to build
+	// them, otherwise, if some processors have no particles then
+	// there is a comms mismatch.
+	polyMesh_.tetBasePtIs();
+
+	const label nProcs = Pstream::nProcs();
+	const label myProci = Pstream::myProcNo();
+
+	const labelListList& subMap = map.cellMap().subMap();
+	const labelListList& constructMap = map.cellMap().constructMap();
+
+	// Processor and index in the processor's sub-map of the old cells
+	labelList cellProc(map.nOldCells(), -1);
+	labelList cellSubi(map.nOldCells(), -1);
+
+	forAll(subMap, proci)
+	{
+		forAll(subMap[proci], i)
+		{
+			cellProc[subMap[proci][i]] = proci;
+			cellSubi[subMap[proci][i]] = i;
+		}
+	}
+
+	// Sort the held back particles by destination processor
+	List<IDLList<ParticleType>> particleSendLists(nProcs);
+	List<DynamicList<label>> subCellSendLists(nProcs);
+	List<DynamicList<point>> positionSendLists(nProcs);
+
+	const vectorField& positions = globalPositionsPtr_();
+
+	label particlei = 0;
+	while (distributedParticles_.size())
+	{
+		ParticleType* pPtr = distributedParticles_.removeHead();
+
+		const label proci = cellProc[pPtr->cell()];
+
+		particleSendLists[proci].append(pPtr);
+		subCellSendLists[proci].append(cellSubi[pPtr->cell()]);
+		positionSendLists[proci].append(positions[particlei++]);
+	}
+
+	globalPositionsPtr_.clear();
+
+	// Stream the particles to the other processors
+	PstreamBuffers pBufs(Pstream::commsTypes::nonBlocking);
+
+	forAll(particleSendLists, proci)
+	{
+		if (proci != myProci && particleSendLists[proci].size())
+		{
+			UOPstream particleStream(proci, pBufs);
+
+			particleStream
+				<< subCellSendLists[proci]
+				<< positionSendLists[proci]
+				<< particleSendLists[proci];
+		}
+	}
+
+	labelList recvSizes;
+	pBufs.finishedSends(recvSizes);
+
+	// Locate the particles kept by this processor and those received in
+	// the new cells of their old cells
+	forAll(particleSendLists, proci)
+	{
+		labelList subCells;
+		pointField subPositions;
+		IDLList<ParticleType> newParticles;
+
+		if (proci == myProci)
+		{
+			subCells.transfer(subCellSendLists[proci]);
+			subPositions.transfer(positionSendLists[proci]);
+			newParticles.transfer(particleSendLists[proci]);
+		}
+		else if (recvSizes[proci])
+		{
+			UIPstream particleStream(proci, pBufs);
+
+			particleStream >> subCells >> subPositions;
+
+			IDLList<ParticleType> recvParticles
+			(
+				particleStream,
+				readParticle(polyMesh_)
+			);
+
+			newParticles.transfer(recvParticles);
+		}
+
+		label i = 0;
+		while (newParticles.size())
+		{
+			ParticleType* pPtr = newParticles.removeHead();
+
+			pPtr->autoMap(subPositions[i], constructMap[proci][subCells[i]]);
+			i++;
+
+			addParticle(pPtr);
+		}
+	}
+}
+
+
+template<class ParticleType>
+void tnbLib::Cloud<ParticleType>::countParticles(labelList& nParticles) const
+{
+	forAllConstIter(typename Cloud<ParticleType>, *this, iter)
+	{
+		nParticles[iter().cell()]++;
+	}
+}
+
+
 template<class ParticleType>
 void tnbLib::Cloud<ParticleType>::writePositions() const
 {
@@ -83,6 +83,36 @@ void tnbLib::Cloud<ParticleType>::writeCloudUniformProperties() const
 }
 
 
+template<class ParticleType>
+tnbLib::cloudColumns& tnbLib::Cloud<ParticleType>::readColumns() const
+{
+	if
+	(
+		columnsPtr_.empty()
+	 || columnsPtr_->instance() != time().timeName()
+	)
+	{
+		columnsPtr_.reset
+		(
+			new cloudColumns
+			(
+				IOobject
+				(
+					cloudColumns::typeName,
+					time().timeName(),
+					*this,
+					IOobject::READ_IF_PRESENT,
+					IOobject::NO_WRITE,
+					false
+				)
+			)
+		);
+	}
+
+	return columnsPtr_();
+}
+
+
 template<class ParticleType>
 void tnbLib::Cloud<ParticleType>::initCloud(const bool checkClass)
 {
@@ -124,7 +154,10 @@ tnbLib::Cloud<ParticleType>::Cloud
 	:
 	cloud(pMesh, cloudName),
 	polyMesh_(pMesh),
-	globalPositionsPtr_()
+	globalPositionsPtr_(),
+	sortTimeIndex_(-1),
+	threadedMove_(false),
+	columnsPtr_()
 {
 	checkPatches();
 
@@ -144,12 +177,16 @@ tnbLib::IOobject tnbLib::Cloud<ParticleType>::fieldIOobject
 	const IOobject::readOption r
 ) const
 {
+	// Fields in the columns file are read by checkFieldIOobject
+	const bool inColumns =
+		r != IOobject::NO_READ && readColumns().found(fieldName);
+
 	return IOobject
 	(
 		fieldName,
 		time().timeName(),
 		*this,
-		r,
+		inColumns ? IOobject::NO_READ : r,
 		IOobject::NO_WRITE,
 		false
 	);
@@ -161,9 +198,19 @@ template<class DataType>
 void tnbLib::Cloud<ParticleType>::checkFieldIOobject
 (
 	const Cloud<ParticleType>& c,
-	const IOField<DataType>& data
+	IOField<DataType>& data
 ) const
 {
+	if (data.readOpt() == IOobject::NO_READ && c.size())
+	{
+		cloudColumns& columns = readColumns();
+
+		if (columns.found(data.name()))
+		{
+			data = columns.template readColumn<DataType>(data.name());
+		}
+	}
+
 	if (data.size() != c.size())
 	{
 		FatalErrorInFunction
@@ -201,6 +248,25 @@ void tnbLib::Cloud<ParticleType>::writeFields() const
 }
 
 
+template<class ParticleType>
+template<class Type>
+void tnbLib::Cloud<ParticleType>::writeField
+(
+	const IOField<Type>& fld,
+	const bool valid
+) const
+{
+	if (columnsPtr_.valid() && columnsPtr_->writeOpt() == IOobject::AUTO_WRITE)
+	{
+		columnsPtr_->add(fld.name(), fld);
+	}
+	else
+	{
+		fld.write(valid);
+	}
+}
+
+
 template<class ParticleType>
 bool tnbLib::Cloud<ParticleType>::writeObject
 (
@@ -212,7 +278,33 @@ bool tnbLib::Cloud<ParticleType>::writeObject
 {
 	writeCloudUniformProperties();
 
+	if (cloudColumns::active)
+	{
+		columnsPtr_.reset
+		(
+			new cloudColumns
+			(
+				IOobject
+				(
+					cloudColumns::typeName,
+					time().timeName(),
+					*this,
+					IOobject::NO_READ,
+					IOobject::AUTO_WRITE,
+					false
+				)
+			)
+		);
+	}
+
 	writeFields();
+
+	if (columnsPtr_.valid() && columnsPtr_->writeOpt() == IOobject::AUTO_WRITE)
+	{
+		columnsPtr_->write(this->size() > 0);
+		columnsPtr_.clear();
+	}
+
 	return cloud::writeObject(fmt, ver, cmp, this->size());
 }
 
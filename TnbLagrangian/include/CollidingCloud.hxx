@@ -216,6 +216,13 @@ namespace tnbLib
 		//- Evolve the cloud
 		void evolve();
 
+		//- Return false, the parcels are tracked serially as the collision
+		//  model acts on pairs of parcels
+		bool threadedTracking() const
+		{
+			return false;
+		}
+
 		//- Particle motion
 		template<class TrackCloudType>
 		void motion
@@ -470,9 +470,9 @@ void tnbLib::CollidingParcel<ParcelType>::writeFields(const CloudType& c)
 
 	const bool write = (np > 0);
 
-	f.write(write);
-	angularMomentum.write(write);
-	torque.write(write);
+	c.writeField(f, write);
+	c.writeField(angularMomentum, write);
+	c.writeField(torque, write);
 
 	collisionRecordsPairAccessed.write(write);
 	collisionRecordsPairOrigProcOfOther.write(write);
@@ -31,6 +31,13 @@ Class
 Description
 	Templated base class for dsmc cloud
 
+	The parcels are counting-sorted by cell after the move and the binary
+	collisions of the cells are calculated in parallel, the sorted parcels
+	being split evenly between the threads. Each thread other than the first
+	samples from its own random number generator, seeded from that of the
+	cloud, which rndGen() returns within the threads so the collision models
+	are unchanged.
+
 SourceFiles
 	DSMCCloudI.H
 	DSMCCloud.C
@@ -46,6 +53,8 @@ SourceFiles
 #include <volFields.hxx>
 #include <scalarIOField.hxx>
 #include <barycentric.hxx>
+#include <SubList.hxx>
+#include <PtrList.hxx>
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
@@ -94,8 +103,11 @@ namespace tnbLib
 		//- Number of real atoms/molecules represented by a parcel
 		scalar nParticle_;
 
-		//- A data structure holding which particles are in which cell
-		List<DynamicList<ParcelType*>> cellOccupancy_;
+		//- Offsets of the parcels of each cell into cellParcels_
+		labelList cellParcelStart_;
+
+		//- The parcels sorted by cell
+		List<ParcelType*> cellParcels_;
 
 		//- A field holding the value of (sigmaT * cR)max for each
 		//  cell (see Bird p220). Initialised with the parcels,
@@ -138,6 +150,9 @@ namespace tnbLib
 		//- Random number generator
 		Random rndGen_;
 
+		//- Random number generators of the threads other than the first
+		PtrList<Random> threadRndGen_;
+
 
 		// boundary value fields
 
@@ -168,7 +183,7 @@ namespace tnbLib
 			//- Build the constant properties for all of the species
 		void buildConstProps();
 
-		//- Record which particles are in which cell
+		//- Sort the parcels by cell
 		void buildCellOccupancy();
 
 		//- Initialise the system
@@ -242,9 +257,11 @@ namespace tnbLib
 		//  parcel
 		inline scalar nParticle() const;
 
-		//- Return the cell occupancy addressing
-		inline const List<DynamicList<ParcelType*>>&
-			cellOccupancy() const;
+		//- Return the parcels in the given cell
+		inline const SubList<ParcelType*> cellParcels
+		(
+			const label celli
+		) const;
 
 		//- Return the sigmaTcRMax field.  non-const access to allow
 		// updating.
@@ -96,22 +96,26 @@ void tnbLib::AveragingMethods::Dual<Type>::syncDualData()
 // * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
 
 template<class Type>
-void tnbLib::AveragingMethods::Dual<Type>::add
+void tnbLib::AveragingMethods::Dual<Type>::addTo
 (
+	FieldField<Field, Type>& sums,
 	const barycentric& coordinates,
 	const tetIndices& tetIs,
 	const Type& value
-)
+) const
 {
 	const triFace triIs(tetIs.faceTriIs(this->mesh_));
 
-	dataCell_[tetIs.cell()] +=
+	Field<Type>& sumCell = sums[0];
+	Field<Type>& sumDual = sums[1];
+
+	sumCell[tetIs.cell()] +=
 		coordinates[0] * value
 		/ (0.25*volumeCell_[tetIs.cell()]);
 
 	for (label i = 0; i < 3; i++)
 	{
-		dataDual_[triIs[i]] +=
+		sumDual[triIs[i]] +=
 			coordinates[i + 1] * value
 			/ (0.25*volumeDual_[triIs[i]]);
 	}
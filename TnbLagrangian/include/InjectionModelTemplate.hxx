@@ -54,6 +54,7 @@ SourceFiles
 #include <runTimeSelectionTables.hxx>
 #include <CloudSubModelBase.hxx>
 #include <vector.hxx>
+#include <PackedBoolList.hxx>
 #include <TimeFunction1.hxx>
 
 #ifdef FoamLagrangian_EXPORT_DEFINE
@@ -172,6 +173,19 @@ namespace tnbLib
 			bool errorOnNotFound = true
 		);
 
+		//- Find the cells that contain a set of positions as
+		//  findCellAtPosition but searching in parallel with a single
+		//  reduction for the whole set. Returns whether each position was
+		//  found on any processor.
+		PackedBoolList findCellsAtPositions
+		(
+			labelList& cells,
+			labelList& tetFaces,
+			labelList& tetPts,
+			UList<vector>& positions,
+			bool errorOnNotFound = true
+		);
+
 		//- Set number of particles to inject given parcel properties
 		virtual scalar setNumberOfParticles
 		(
@@ -46,6 +46,16 @@ Description
 	  - stochastic collision model
 	  - surface film model
 
+	With the solution entry threadedTracking the parcels are tracked by
+	threadLoop::nThreads threads. Each thread other than the first
+	accumulates the source terms into its own copy of the source fields and
+	draws from its own random number generator, seeded from that of the
+	cloud. The copies are added to the source fields in the order of the
+	threads at the end of the move so that, for a given number of threads,
+	the sources do not depend on the scheduling of the threads. With
+	cellValueSourceCorrection a parcel sees only the sources of its own
+	thread.
+
 SourceFiles
 	KinematicCloudI.H
 	KinematicCloud.C
@@ -231,6 +241,18 @@ namespace tnbLib
 		autoPtr<volScalarField::Internal> UCoeff_;
 
 
+		// Threaded tracking
+
+			//- Momentum sources of the threads other than the first
+		PtrList<volVectorField::Internal> threadUTrans_;
+
+		//- U equation coefficients of the threads other than the first
+		PtrList<volScalarField::Internal> threadUCoeff_;
+
+		//- Random number generators of the threads other than the first
+		mutable PtrList<Random> threadRndGen_;
+
+
 		// Initialisation
 
 			//- Set cloud sub-models
@@ -269,6 +291,38 @@ namespace tnbLib
 		void cloudReset(KinematicCloud<CloudType>& c);
 
 
+		// Threaded tracking
+
+			//- Return the copy of the field of the calling thread, or the
+			//  field itself for the first thread and outside of a
+			//  threaded move
+		template<class Type>
+		static inline DimensionedField<Type, volMesh>& threadField
+		(
+			DimensionedField<Type, volMesh>& field,
+			PtrList<DimensionedField<Type, volMesh>>& threadFields
+		);
+
+		//- Set zero copies of the field for the threads other than the
+		//  first
+		template<class Type>
+		static void setThreadFields
+		(
+			const DimensionedField<Type, volMesh>& field,
+			PtrList<DimensionedField<Type, volMesh>>& threadFields,
+			const label nThreads
+		);
+
+		//- Add the copies of the threads to the field in thread order
+		//  and clear them
+		template<class Type>
+		static void addThreadFields
+		(
+			DimensionedField<Type, volMesh>& field,
+			PtrList<DimensionedField<Type, volMesh>>& threadFields
+		);
+
+
 	public:
 
 		// Constructors
@@ -576,6 +630,30 @@ namespace tnbLib
 		//- Apply scaling to (transient) cloud sources
 		void scaleSources();
 
+
+		// Threaded tracking
+
+			//- Return true if the parcels may be tracked by several threads
+		bool threadedTracking() const
+		{
+			return solution_.threadedTracking();
+		}
+
+		//- Return the tracking data for a thread other than the first
+		template<class TrackCloudType>
+		autoPtr<typename parcelType::trackingData> threadTrackingData
+		(
+			TrackCloudType& cloud,
+			const typename parcelType::trackingData& td
+		) const;
+
+		//- Set the per-thread sources and random number generators
+		void beginThreadedMove(const label nThreads);
+
+		//- Add the per-thread sources to the cloud sources
+		void endThreadedMove();
+
+
 		//- Pre-evolve
 		void preEvolve();
 
@@ -25,6 +25,7 @@ License
 \*---------------------------------------------------------------------------*/
 
 #include <AveragingMethod.hxx>
+#include <threadLoop.hxx>
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
@@ -172,18 +173,49 @@ inline void tnbLib::MPPICParcel<ParcelType>::trackingData::updateAverages
 	);
 	AveragingMethod<scalar>& weightAverage = weightAveragePtr();
 
+	// parcel positions, gathered once and shared by all the sums
+	typedef typename TrackCloudType::parcelType parcelType;
+
+	const label nParcels = cloud.size();
+
+	List<const parcelType*> parcels(nParcels);
+	List<barycentric> coordinates(nParcels);
+	List<tetIndices> tetIs(nParcels);
+	{
+		label parceli = 0;
+		forAllConstIter(typename TrackCloudType, cloud, iter)
+		{
+			parcels[parceli] = &iter();
+			coordinates[parceli] = iter().coordinates();
+			tetIs[parceli] = iter().currentTetIndices();
+			parceli++;
+		}
+	}
+
+	scalarField values(nParcels);
+	scalarField weights(nParcels);
+
 	// averaging sums
-	forAllConstIter(typename TrackCloudType, cloud, iter)
 	{
-		const typename TrackCloudType::parcelType& p = iter();
-		const tetIndices tetIs = p.currentTetIndices();
+		scalarField masses(nParcels);
+		vectorField momenta(nParcels);
+
+		forAll(parcels, parceli)
+		{
+			const parcelType& p = *parcels[parceli];
+
+			const scalar m = p.nParticle()*p.mass();
 
-		const scalar m = p.nParticle()*p.mass();
+			values[parceli] = p.nParticle()*p.volume();
+			weights[parceli] = m*p.rho();
+			momenta[parceli] = m*p.U();
+			masses[parceli] = m;
+		}
 
-		volumeAverage_->add(p.coordinates(), tetIs, p.nParticle()*p.volume());
-		rhoAverage_->add(p.coordinates(), tetIs, m*p.rho());
-		uAverage_->add(p.coordinates(), tetIs, m*p.U());
-		massAverage_->add(p.coordinates(), tetIs, m);
+		volumeAverage_->add(coordinates, tetIs, values);
+		rhoAverage_->add(coordinates, tetIs, weights);
+		uAverage_->add(coordinates, tetIs, momenta);
+		massAverage_->add(coordinates, tetIs, masses);
 	}
 	volumeAverage_->average();
 	massAverage_->average();
@@ -191,57 +223,71 @@ inline void tnbLib::MPPICParcel<ParcelType>::trackingData::updateAverages
 	uAverage_->average(massAverage_);
 
 	// squared velocity deviation
-	forAllConstIter(typename TrackCloudType, cloud, iter)
-	{
-		const typename TrackCloudType::parcelType& p = iter();
-		const tetIndices tetIs = p.currentTetIndices();
+	threadLoop::run
+	(
+		nParcels,
+		[&](const label, const label start, const label end)
+		{
+			for (label parceli = start; parceli < end; parceli++)
+			{
+				const parcelType& p = *parcels[parceli];
 
-		const vector u = uAverage_->interpolate(p.coordinates(), tetIs);
+				const vector u =
+					uAverage_->interpolate
+					(
+						coordinates[parceli],
+						tetIs[parceli]
+					);
 
-		uSqrAverage_->add
-		(
-			p.coordinates(),
-			tetIs,
-			p.nParticle()*p.mass()*magSqr(p.U() - u)
-		);
-	}
+				values[parceli] = p.nParticle()*p.mass()*magSqr(p.U() - u);
+			}
+		},
+		1000
+	);
+	uSqrAverage_->add(coordinates, tetIs, values);
 	uSqrAverage_->average(massAverage_);
 
 	// sauter mean radius
 	radiusAverage_() = volumeAverage_();
 	weightAverage = 0;
-	forAllConstIter(typename TrackCloudType, cloud, iter)
+	forAll(parcels, parceli)
 	{
-		const typename TrackCloudType::parcelType& p = iter();
-		const tetIndices tetIs = p.currentTetIndices();
+		const parcelType& p = *parcels[parceli];
 
-		weightAverage.add
-		(
-			p.coordinates(),
-			tetIs,
-			p.nParticle()*pow(p.volume(), 2.0 / 3.0)
-		);
+		weights[parceli] = p.nParticle()*pow(p.volume(), 2.0 / 3.0);
 	}
+	weightAverage.add(coordinates, tetIs, weights);
 	weightAverage.average();
 	radiusAverage_->average(weightAverage);
 
 	// collision frequency
 	weightAverage = 0;
-	forAllConstIter(typename TrackCloudType, cloud, iter)
-	{
-		const typename TrackCloudType::parcelType& p = iter();
-		const tetIndices tetIs = p.currentTetIndices();
-
-		const scalar a = volumeAverage_->interpolate(p.coordinates(), tetIs);
-		const scalar r = radiusAverage_->interpolate(p.coordinates(), tetIs);
-		const vector u = uAverage_->interpolate(p.coordinates(), tetIs);
+	threadLoop::run
+	(
+		nParcels,
+		[&](const label, const label start, const label end)
+		{
+			for (label parceli = start; parceli < end; parceli++)
+			{
+				const parcelType& p = *parcels[parceli];
+				const barycentric& c = coordinates[parceli];
+				const tetIndices& tet = tetIs[parceli];
 
-		const scalar f = 0.75*a / pow3(r)*sqr(0.5*p.d() + r)*mag(p.U() - u);
+				const scalar a = volumeAverage_->interpolate(c, tet);
+				const scalar r = radiusAverage_->interpolate(c, tet);
+				const vector u = uAverage_->interpolate(c, tet);
 
-		frequencyAverage_->add(p.coordinates(), tetIs, p.nParticle()*f*f);
+				const scalar f =
+					0.75*a / pow3(r)*sqr(0.5*p.d() + r)*mag(p.U() - u);
 
-		weightAverage.add(p.coordinates(), tetIs, p.nParticle()*f);
-	}
+				values[parceli] = p.nParticle()*f*f;
+				weights[parceli] = p.nParticle()*f;
+			}
+		},
+		1000
+	);
+	frequencyAverage_->add(coordinates, tetIs, values);
+	weightAverage.add(coordinates, tetIs, weights);
 	frequencyAverage_->average(weightAverage);
 }
 
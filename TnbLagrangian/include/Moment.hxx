@@ -150,13 +150,14 @@ namespace tnbLib
 
 			//- Member Functions
 
-				//- Add point value to interpolation
-			void add
+				//- Add point value to the given sums of the interpolation
+			void addTo
 			(
+				FieldField<Field, Type>& sums,
 				const barycentric& coordinates,
 				const tetIndices& tetIs,
 				const Type& value
-			);
+			) const;
 
 			//- Interpolate
 			Type interpolate
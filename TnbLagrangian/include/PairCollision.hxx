@@ -29,6 +29,31 @@ Class
 	tnbLib::PairCollision
 
 Description
+	Collision model evaluating the contact forces between pairs of parcels
+	and between parcels and walls with the given PairModel and WallModel.
+
+	The contacts are searched either with the interaction lists of the
+	cells (default), or with a spatial hash of the parcels which is
+	rebuilt every step. The spatial hash search is O(N) in the number of
+	parcels and independent of the mesh resolution, and is suited to
+	dense beds where the parcels far outnumber the cells. Its bins are
+	sized by the largest parcel interaction diameter, or by
+	maxInteractionDistance if that is larger. The parcels within a bin
+	size of the domain of another processor are sent to it as ghost
+	parcels, and the wall faces are searched with an octree which includes
+	the wall faces of the other processors in range. Cyclic patches are
+	not supported by the spatial hash search.
+
+	\verbatim
+	pairCollisionCoeffs
+	{
+		contactSearch          spatialHash; // or interactionLists
+		maxInteractionDistance 0; // Optional for spatialHash
+
+		pairModel              pairSpringSliderDashpot;
+		...
+	}
+	\endverbatim
 
 SourceFiles
 	PairCollision.C
@@ -38,6 +63,9 @@ SourceFiles
 #include <CollisionModel.hxx>
 #include <InteractionLists.hxx>
 #include <WallSiteData.hxx>
+#include <spatialHash.hxx>
+#include <primitiveFacePatch.hxx>
+#include <treeDataPrimitivePatch.hxx>
 
 #ifdef FoamLagrangian_EXPORT_DEFINE
 #define FoamPairCollision_EXPORT __declspec(dllexport)
@@ -93,9 +121,78 @@ namespace tnbLib
 		//- WallModel to calculate the interaction between the parcel and walls
 		autoPtr<WallModel<CloudType>> wallModel_;
 
+		//- Name of the velocity field of the walls
+		const word UName_;
+
+		//- Search the contacts with the spatial hash rather than the
+		//  interaction lists
+		const bool spatialHash_;
+
+		//- Minimum interaction distance of the spatial hash search
+		const scalar maxInteractionDistance_;
+
 		//- Interactions lists determining which cells are in
 		//  interaction range of each other
-		InteractionLists<typename CloudType::parcelType> il_;
+		autoPtr<InteractionLists<typename CloudType::parcelType>> ilPtr_;
+
+
+		// Spatial hash search
+
+			//- Spatial hash of the real and ghost parcels
+		spatialHash parcelHash_;
+
+		//- Ghost parcels from the other processors
+		IDLList<typename CloudType::parcelType> ghostParcels_;
+
+		//- Bounding boxes of the domains of the processors
+		List<boundBox> procBb_;
+
+		//- Distance from the processor domains up to which the wall faces
+		//  have been collected
+		scalar wallRange_;
+
+		//- Points of the local and remote wall faces
+		pointField wallPoints_;
+
+		//- Patch of each wall face
+		labelList wallPatches_;
+
+		//- Velocity of each wall face
+		vectorField wallU_;
+
+		//- Mesh face of each local wall face
+		labelList wallFaceLabels_;
+
+		//- Local wall faces sent to each processor
+		labelListList wallSendFaces_;
+
+		//- Number of wall faces received from each processor
+		labelList wallRecvSizes_;
+
+		//- Local wall faces followed by the remote wall faces
+		autoPtr<primitiveFacePatch> wallPatchPtr_;
+
+		//- Search tree of the wall faces
+		autoPtr<indexedOctree<treeDataPrimitivePatch<primitiveFacePatch>>>
+			wallTreePtr_;
+
+
+		// Wall interaction sites of a parcel
+
+			//- Flat sites
+		DynamicList<point> flatSitePoints_;
+		DynamicList<scalar> flatSiteExclusionDistancesSqr_;
+		DynamicList<WallSiteData<vector>> flatSiteData_;
+
+		//- Sites which are not flat
+		DynamicList<point> otherSitePoints_;
+		DynamicList<scalar> otherSiteDistances_;
+		DynamicList<WallSiteData<vector>> otherSiteData_;
+
+		//- Sharp sites
+		DynamicList<point> sharpSitePoints_;
+		DynamicList<scalar> sharpSiteExclusionDistancesSqr_;
+		DynamicList<WallSiteData<vector>> sharpSiteData_;
 
 
 		// Private Member Functions
@@ -115,6 +212,47 @@ namespace tnbLib
 		//- Interactions with walls
 		void wallInteraction();
 
+		//- Clear the wall interaction sites
+		void clearWallSites();
+
+		//- Add a wall interaction site of a parcel at the given position
+		//  with the given interaction radius if it is in range
+		void addWallSite
+		(
+			const point& pos,
+			const scalar r,
+			const pointHit& nearest,
+			const vector& normal,
+			const WallSiteData<vector>& wSD
+		);
+
+		//- Classify the wall interaction sites of the parcel as flat or
+		//  sharp and evaluate the wall forces
+		void evaluateWallSites
+		(
+			typename CloudType::parcelType& p,
+			const scalar r
+		);
+
+		//- Return the bin size of the spatial hash, the largest parcel
+		//  interaction diameter
+		scalar hashBinSize() const;
+
+		//- Collect the local wall faces and the wall faces of the other
+		//  processors within the given distance of the local domain
+		void buildWallFaces(const scalar range);
+
+		//- Send the parcels within the given distance of the domains of
+		//  the other processors and the velocities of the wall faces and
+		//  receive the ghost parcels and remote wall velocities
+		void exchangeGhosts(const scalar range);
+
+		//- Interactions between parcels using the spatial hash
+		void hashParcelInteraction(const scalar binSize);
+
+		//- Interactions with walls using the wall face tree
+		void hashWallInteraction();
+
 		bool duplicatePointInList
 		(
 			const DynamicList<point>& existingPoints,
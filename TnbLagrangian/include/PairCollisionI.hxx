@@ -3,6 +3,14 @@
 #include <WallModel.hxx>
 
 #include <volFields.hxx>  // added by amir
+#include <wallPolyPatch.hxx>
+#include <uindirectPrimitivePatch.hxx>
+#include <globalMeshData.hxx>
+#include <globalIndexAndTransform.hxx>
+#include <vectorTensorTransform.hxx>
+#include <indexedOctree.hxx>
+#include <PstreamBuffers.hxx>
+#include <SubField.hxx>
 
 // * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
 
@@ -38,11 +46,11 @@ void tnbLib::PairCollision<CloudType>::parcelInteraction()
 
 	label startOfRequests = Pstream::nRequests();
 
-	il_.sendReferredData(this->owner().cellOccupancy(), pBufs);
+	ilPtr_().sendReferredData(this->owner().cellOccupancy(), pBufs);
 
 	realRealInteraction();
 
-	il_.receiveReferredData(pBufs, startOfRequests);
+	ilPtr_().receiveReferredData(pBufs, startOfRequests);
 
 	realReferredInteraction();
 }
@@ -52,7 +60,7 @@ template<class CloudType>
 void tnbLib::PairCollision<CloudType>::realRealInteraction()
 {
 	// Direct interaction list (dil)
-	const labelListList& dil = il_.dil();
+	const labelListList& dil = ilPtr_().dil();
 
 	typename CloudType::parcelType* pA_ptr = nullptr;
 	typename CloudType::parcelType* pB_ptr = nullptr;
@@ -102,10 +110,10 @@ template<class CloudType>
 void tnbLib::PairCollision<CloudType>::realReferredInteraction()
 {
 	// Referred interaction list (ril)
-	const labelListList& ril = il_.ril();
+	const labelListList& ril = ilPtr_().ril();
 
 	List<IDLList<typename CloudType::parcelType>>& referredParticles =
-		il_.referredParticles();
+		ilPtr_().referredParticles();
 
 	List<DynamicList<typename CloudType::parcelType*>>& cellOccupancy =
 		this->owner().cellOccupancy();
@@ -152,30 +160,21 @@ void tnbLib::PairCollision<CloudType>::realReferredInteraction()
 template<class CloudType>
 void tnbLib::PairCollision<CloudType>::wallInteraction()
 {
+	const InteractionLists<typename CloudType::parcelType>& il = ilPtr_();
+
 	const polyMesh& mesh = this->owner().mesh();
 
-	const labelListList& dil = il_.dil();
+	const labelListList& dil = il.dil();
 
-	const labelListList& directWallFaces = il_.dwfil();
+	const labelListList& directWallFaces = il.dwfil();
 
 	const labelList& patchID = mesh.boundaryMesh().patchID();
 
-	const volVectorField& U = mesh.lookupObject<volVectorField>(il_.UName());
+	const volVectorField& U = mesh.lookupObject<volVectorField>(UName_);
 
 	List<DynamicList<typename CloudType::parcelType*>>& cellOccupancy =
 		this->owner().cellOccupancy();
 
-	// Storage for the wall interaction sites
-	DynamicList<point> flatSitePoints;
-	DynamicList<scalar> flatSiteExclusionDistancesSqr;
-	DynamicList<WallSiteData<vector>> flatSiteData;
-	DynamicList<point> otherSitePoints;
-	DynamicList<scalar> otherSiteDistances;
-	DynamicList<WallSiteData<vector>> otherSiteData;
-	DynamicList<point> sharpSitePoints;
-	DynamicList<scalar> sharpSiteExclusionDistancesSqr;
-	DynamicList<WallSiteData<vector>> sharpSiteData;
-
 	forAll(dil, realCelli)
 	{
 		// The real wall faces in range of this real cell
@@ -184,15 +183,7 @@ void tnbLib::PairCollision<CloudType>::wallInteraction()
 		// Loop over all Parcels in cell
 		forAll(cellOccupancy[realCelli], cellParticleI)
 		{
-			flatSitePoints.clear();
-			flatSiteExclusionDistancesSqr.clear();
-			flatSiteData.clear();
-			otherSitePoints.clear();
-			otherSiteDistances.clear();
-			otherSiteData.clear();
-			sharpSitePoints.clear();
-			sharpSiteExclusionDistancesSqr.clear();
-			sharpSiteData.clear();
+			clearWallSites();
 
 			typename CloudType::parcelType& p =
 				*cellOccupancy[realCelli][cellParticleI];
@@ -219,72 +210,38 @@ void tnbLib::PairCollision<CloudType>::wallInteraction()
 
 					normal /= mag(normal);
 
-					const vector& nearPt = nearest.rawPoint();
-
-					vector pW = nearPt - pos;
-
-					scalar normalAlignment = normal & pW / (mag(pW) + small);
-
 					// Find the patchIndex and wallData for WallSiteData object
 					label patchi = patchID[realFacei - mesh.nInternalFaces()];
 
 					label patchFacei =
 						realFacei - mesh.boundaryMesh()[patchi].start();
 
-					WallSiteData<vector> wSD
+					addWallSite
 					(
-						patchi,
-						U.boundaryField()[patchi][patchFacei]
+						pos,
+						r,
+						nearest,
+						normal,
+						WallSiteData<vector>
+						(
+							patchi,
+							U.boundaryField()[patchi][patchFacei]
+						)
 					);
-
-					if (normalAlignment > cosPhiMinFlatWall)
-					{
-						// Guard against a flat interaction being
-						// present on the boundary of two or more
-						// faces, which would create duplicate contact
-						// points. Duplicates are discarded.
-						if
-							(
-								!duplicatePointInList
-								(
-									flatSitePoints,
-									nearPt,
-									sqr(r*flatWallDuplicateExclusion)
-								)
-								)
-						{
-							flatSitePoints.append(nearPt);
-
-							flatSiteExclusionDistancesSqr.append
-							(
-								sqr(r) - sqr(nearest.distance())
-							);
-
-							flatSiteData.append(wSD);
-						}
-					}
-					else
-					{
-						otherSitePoints.append(nearPt);
-
-						otherSiteDistances.append(nearest.distance());
-
-						otherSiteData.append(wSD);
-					}
 				}
 			}
 
 			// referred wallFace interactions
 
 			// The labels of referred wall faces in range of this real cell
-			const labelList& cellRefWallFaces = il_.rwfilInverse()[realCelli];
+			const labelList& cellRefWallFaces = il.rwfilInverse()[realCelli];
 
 			forAll(cellRefWallFaces, rWFI)
 			{
 				label refWallFacei = cellRefWallFaces[rWFI];
 
 				const referredWallFace& rwf =
-					il_.referredWallFaces()[refWallFacei];
+					il.referredWallFaces()[refWallFacei];
 
 				const pointField& pts = rwf.points();
 
@@ -292,125 +249,654 @@ void tnbLib::PairCollision<CloudType>::wallInteraction()
 
 				if (nearest.distance() < r)
 				{
-					const vector normal = rwf.normal(pts);
-					const vector& nearPt = nearest.rawPoint();
+					addWallSite
+					(
+						pos,
+						r,
+						nearest,
+						rwf.normal(pts),
+						WallSiteData<vector>
+						(
+							rwf.patchIndex(),
+							il.referredWallData()[refWallFacei]
+						)
+					);
+				}
+			}
 
-					vector pW = nearPt - pos;
+			evaluateWallSites(p, r);
+		}
+	}
+}
 
-					scalar normalAlignment = normal & pW / mag(pW);
 
-					// Find the patchIndex and wallData for WallSiteData object
+template<class CloudType>
+void tnbLib::PairCollision<CloudType>::clearWallSites()
+{
+	flatSitePoints_.clear();
+	flatSiteExclusionDistancesSqr_.clear();
+	flatSiteData_.clear();
+	otherSitePoints_.clear();
+	otherSiteDistances_.clear();
+	otherSiteData_.clear();
+	sharpSitePoints_.clear();
+	sharpSiteExclusionDistancesSqr_.clear();
+	sharpSiteData_.clear();
+}
+
+
+template<class CloudType>
+void tnbLib::PairCollision<CloudType>::addWallSite
+(
+	const point& pos,
+	const scalar r,
+	const pointHit& nearest,
+	const vector& normal,
+	const WallSiteData<vector>& wSD
+)
+{
+	const vector& nearPt = nearest.rawPoint();
+
+	vector pW = nearPt - pos;
+
+	scalar normalAlignment = normal & pW / (mag(pW) + small);
+
+	if (normalAlignment > cosPhiMinFlatWall)
+	{
+		// Guard against a flat interaction being
+		// present on the boundary of two or more
+		// faces, which would create duplicate contact
+		// points. Duplicates are discarded.
+		if
+			(
+				!duplicatePointInList
+				(
+					flatSitePoints_,
+					nearPt,
+					sqr(r*flatWallDuplicateExclusion)
+				)
+				)
+		{
+			flatSitePoints_.append(nearPt);
+
+			flatSiteExclusionDistancesSqr_.append
+			(
+				sqr(r) - sqr(nearest.distance())
+			);
+
+			flatSiteData_.append(wSD);
+		}
+	}
+	else
+	{
+		otherSitePoints_.append(nearPt);
+
+		otherSiteDistances_.append(nearest.distance());
+
+		otherSiteData_.append(wSD);
+	}
+}
+
+
+template<class CloudType>
+void tnbLib::PairCollision<CloudType>::evaluateWallSites
+(
+	typename CloudType::parcelType& p,
+	const scalar r
+)
+{
+	// All flat interaction sites found, now classify the
+	// other sites as being in range of a flat interaction, or
+	// a sharp interaction, being aware of not duplicating the
+	// sharp interaction sites.
+
+	// The "other" sites need to evaluated in order of
+	// ascending distance to their nearest point so that
+	// grouping occurs around the closest in any group
+
+	labelList sortedOtherSiteIndices;
 
-					WallSiteData<vector> wSD
+	sortedOrder(otherSiteDistances_, sortedOtherSiteIndices);
+
+	forAll(sortedOtherSiteIndices, siteI)
+	{
+		label orderedIndex = sortedOtherSiteIndices[siteI];
+
+		const point& otherPt = otherSitePoints_[orderedIndex];
+
+		if
+			(
+				!duplicatePointInList
+				(
+					flatSitePoints_,
+					otherPt,
+					flatSiteExclusionDistancesSqr_
+				)
+				)
+		{
+			// Not in range of a flat interaction, must be a
+			// sharp interaction.
+
+			if
+				(
+					!duplicatePointInList
 					(
-						rwf.patchIndex(),
-						il_.referredWallData()[refWallFacei]
-					);
+						sharpSitePoints_,
+						otherPt,
+						sharpSiteExclusionDistancesSqr_
+					)
+					)
+			{
+				sharpSitePoints_.append(otherPt);
+
+				sharpSiteExclusionDistancesSqr_.append
+				(
+					sqr(r) - sqr(otherSiteDistances_[orderedIndex])
+				);
+
+				sharpSiteData_.append(otherSiteData_[orderedIndex]);
+			}
+		}
+	}
+
+	evaluateWall
+	(
+		p,
+		flatSitePoints_,
+		flatSiteData_,
+		sharpSitePoints_,
+		sharpSiteData_
+	);
+}
+
+
+template<class CloudType>
+tnbLib::scalar tnbLib::PairCollision<CloudType>::hashBinSize() const
+{
+	scalar dMax = 0;
+
+	forAllConstIter(typename CloudType, this->owner(), iter)
+	{
+		dMax = max(dMax, 2*wallModel_->pREff(iter()));
+	}
+
+	return max(returnReduce(dMax, maxOp<scalar>()), maxInteractionDistance_);
+}
 
-					if (normalAlignment > cosPhiMinFlatWall)
-					{
-						// Guard against a flat interaction being
-						// present on the boundary of two or more
-						// faces, which would create duplicate contact
-						// points. Duplicates are discarded.
-						if
-							(
-								!duplicatePointInList
-								(
-									flatSitePoints,
-									nearPt,
-									sqr(r*flatWallDuplicateExclusion)
-								)
-								)
-						{
-							flatSitePoints.append(nearPt);
-
-							flatSiteExclusionDistancesSqr.append
-							(
-								sqr(r) - sqr(nearest.distance())
-							);
-
-							flatSiteData.append(wSD);
-						}
-					}
-					else
-					{
-						otherSitePoints.append(nearPt);
-
-						otherSiteDistances.append(nearest.distance());
-
-						otherSiteData.append(wSD);
-					}
+
+template<class CloudType>
+void tnbLib::PairCollision<CloudType>::buildWallFaces(const scalar range)
+{
+	const polyMesh& mesh = this->owner().mesh();
+	const polyBoundaryMesh& pbm = mesh.boundaryMesh();
+
+	const label nProcs = Pstream::nProcs();
+	const label myProci = Pstream::myProcNo();
+
+	// Bounding boxes of the processor domains
+	procBb_.setSize(nProcs);
+	procBb_[myProci] = boundBox(mesh.points(), false);
+	Pstream::gatherList(procBb_);
+	Pstream::scatterList(procBb_);
+
+	// Local wall faces compacted to their own points
+	DynamicList<label> faceLabels;
+	DynamicList<label> facePatches;
+
+	forAll(pbm, patchi)
+	{
+		if (isA<wallPolyPatch>(pbm[patchi]))
+		{
+			const polyPatch& pp = pbm[patchi];
+
+			forAll(pp, i)
+			{
+				faceLabels.append(pp.start() + i);
+				facePatches.append(patchi);
+			}
+		}
+	}
+
+	wallFaceLabels_.transfer(faceLabels);
+
+	const uindirectPrimitivePatch localPatch
+	(
+		UIndirectList<face>(mesh.faces(), wallFaceLabels_),
+		mesh.points()
+	);
+
+	const faceList& localFaces = localPatch.localFaces();
+	const pointField& localPoints = localPatch.localPoints();
+
+	DynamicList<face> allFaces(localFaces);
+	DynamicList<point> allPoints(localPoints);
+
+	// Send the wall faces within range of the domains of the other
+	// processors
+	List<boundBox> faceBb(localFaces.size());
+	forAll(localFaces, facei)
+	{
+		faceBb[facei] =
+			boundBox(pointField(localFaces[facei].points(localPoints)), false);
+	}
+
+	PstreamBuffers pBufs(Pstream::commsTypes::nonBlocking);
+
+	wallSendFaces_.setSize(nProcs);
+
+	labelList pointMap(localPoints.size(), -1);
+
+	for (label proci = 0; proci < nProcs; proci++)
+	{
+		wallSendFaces_[proci].clear();
+
+		if (proci == myProci)
+		{
+			continue;
+		}
+
+		const boundBox bb
+		(
+			procBb_[proci].min() - vector::uniform(range),
+			procBb_[proci].max() + vector::uniform(range)
+		);
+
+		DynamicList<label> sendFaceLabels;
+		DynamicList<face> sendFaces;
+		DynamicList<point> sendPoints;
+		DynamicList<label> usedPoints;
+
+		forAll(localFaces, facei)
+		{
+			if (!bb.overlaps(faceBb[facei]))
+			{
+				continue;
+			}
+
+			const face& f = localFaces[facei];
+			face sendFace(f.size());
+
+			forAll(f, fp)
+			{
+				if (pointMap[f[fp]] == -1)
+				{
+					pointMap[f[fp]] = sendPoints.size();
+					sendPoints.append(localPoints[f[fp]]);
+					usedPoints.append(f[fp]);
 				}
+				sendFace[fp] = pointMap[f[fp]];
 			}
 
-			// All flat interaction sites found, now classify the
-			// other sites as being in range of a flat interaction, or
-			// a sharp interaction, being aware of not duplicating the
-			// sharp interaction sites.
+			sendFaceLabels.append(facei);
+			sendFaces.append(sendFace);
+		}
+
+		forAll(usedPoints, i)
+		{
+			pointMap[usedPoints[i]] = -1;
+		}
+
+		wallSendFaces_[proci].transfer(sendFaceLabels);
+
+		if (sendFaces.size())
+		{
+			UOPstream toProc(proci, pBufs);
+			toProc
+				<< faceList(sendFaces)
+				<< pointField(sendPoints)
+				<< labelList(UIndirectList<label>(facePatches, wallSendFaces_[proci]));
+		}
+	}
+
+	labelList recvSizes;
+	pBufs.finishedSends(recvSizes);
+
+	// Append the wall faces of the other processors, renumbered into the
+	// combined points
+	wallRecvSizes_.setSize(nProcs);
+	wallRecvSizes_ = 0;
 
-			// The "other" sites need to evaluated in order of
-			// ascending distance to their nearest point so that
-			// grouping occurs around the closest in any group
+	for (label proci = 0; proci < nProcs; proci++)
+	{
+		if (proci == myProci || !recvSizes[proci])
+		{
+			continue;
+		}
 
-			labelList sortedOtherSiteIndices;
+		UIPstream fromProc(proci, pBufs);
+		const faceList recvFaces(fromProc);
+		const pointField recvPoints(fromProc);
+		const labelList recvPatches(fromProc);
 
-			sortedOrder(otherSiteDistances, sortedOtherSiteIndices);
+		const label pointOffset = allPoints.size();
+		allPoints.append(recvPoints);
 
-			forAll(sortedOtherSiteIndices, siteI)
+		forAll(recvFaces, facei)
+		{
+			face f(recvFaces[facei]);
+			forAll(f, fp)
 			{
-				label orderedIndex = sortedOtherSiteIndices[siteI];
+				f[fp] += pointOffset;
+			}
+			allFaces.append(f);
+		}
 
-				const point& otherPt = otherSitePoints[orderedIndex];
+		facePatches.append(recvPatches);
+		wallRecvSizes_[proci] = recvFaces.size();
+	}
 
-				if
-					(
-						!duplicatePointInList
-						(
-							flatSitePoints,
-							otherPt,
-							flatSiteExclusionDistancesSqr
-						)
-						)
+	wallTreePtr_.clear();
+	wallPatchPtr_.clear();
+
+	wallPoints_.transfer(allPoints);
+	wallPatches_.transfer(facePatches);
+	wallU_.setSize(wallPatches_.size(), Zero);
+
+	wallPatchPtr_.reset(new primitiveFacePatch(faceList(allFaces), wallPoints_));
+
+	if (wallPatchPtr_().size())
+	{
+		typedef treeDataPrimitivePatch<primitiveFacePatch> treeType;
+
+		wallTreePtr_.reset
+		(
+			new indexedOctree<treeType>
+			(
+				treeType
+				(
+					false,
+					wallPatchPtr_(),
+					indexedOctree<treeType>::perturbTol()
+				),
+				treeBoundBox(wallPoints_).extend(1e-4),
+				8,
+				10,
+				3.0
+			)
+		);
+	}
+
+	wallRange_ = range;
+
+	if (debug)
+	{
+		Pout<< "PairCollision::buildWallFaces : " << wallFaceLabels_.size()
+			<< " local and " << wallPatches_.size() - wallFaceLabels_.size()
+			<< " remote wall faces" << endl;
+	}
+}
+
+
+template<class CloudType>
+void tnbLib::PairCollision<CloudType>::exchangeGhosts(const scalar range)
+{
+	typedef typename CloudType::parcelType parcelType;
+
+	const polyMesh& mesh = this->owner().mesh();
+	const polyBoundaryMesh& pbm = mesh.boundaryMesh();
+
+	const label nProcs = Pstream::nProcs();
+	const label myProci = Pstream::myProcNo();
+
+	// Velocities of the local wall faces
+	const volVectorField& U = mesh.lookupObject<volVectorField>(UName_);
+
+	forAll(wallFaceLabels_, facei)
+	{
+		const label patchi = wallPatches_[facei];
+
+		wallU_[facei] =
+			U.boundaryField()[patchi]
+			[
+				wallFaceLabels_[facei] - pbm[patchi].start()
+			];
+	}
+
+	ghostParcels_.clear();
+
+	if (!Pstream::parRun())
+	{
+		return;
+	}
+
+	// Processors the domains of which are in range of the local domain
+	const boundBox& localBb = procBb_[myProci];
+
+	DynamicList<label> nbrProcs;
+	List<boundBox> nbrBb(nProcs);
+
+	for (label proci = 0; proci < nProcs; proci++)
+	{
+		nbrBb[proci] = boundBox
+		(
+			procBb_[proci].min() - vector::uniform(range),
+			procBb_[proci].max() + vector::uniform(range)
+		);
+
+		if (proci != myProci && nbrBb[proci].overlaps(localBb))
+		{
+			nbrProcs.append(proci);
+		}
+	}
+
+	// Copies of the parcels in range of the domains of the other processors
+	List<IDLList<parcelType>> sendParcels(nProcs);
+
+	if (nbrProcs.size())
+	{
+		forAllConstIter(typename CloudType, this->owner(), iter)
+		{
+			const point pos = iter().position();
+
+			forAll(nbrProcs, i)
+			{
+				const label proci = nbrProcs[i];
+
+				if (nbrBb[proci].contains(pos))
 				{
-					// Not in range of a flat interaction, must be a
-					// sharp interaction.
+					sendParcels[proci].append
+					(
+						static_cast<parcelType*>(iter().clone().ptr())
+					);
 
-					if
-						(
-							!duplicatePointInList
-							(
-								sharpSitePoints,
-								otherPt,
-								sharpSiteExclusionDistancesSqr
-							)
-							)
-					{
-						sharpSitePoints.append(otherPt);
-
-						sharpSiteExclusionDistancesSqr.append
+					sendParcels[proci].last()
+						->prepareForInteractionListReferral
 						(
-							sqr(r) - sqr(otherSiteDistances[orderedIndex])
+							vectorTensorTransform::I
 						);
-
-						sharpSiteData.append(otherSiteData[orderedIndex]);
-					}
 				}
 			}
+		}
+	}
+
+	PstreamBuffers pBufs(Pstream::commsTypes::nonBlocking);
+
+	for (label proci = 0; proci < nProcs; proci++)
+	{
+		const labelList& sendFaces = wallSendFaces_[proci];
+
+		if (sendParcels[proci].size() || sendFaces.size())
+		{
+			UOPstream toProc(proci, pBufs);
+			toProc
+				<< sendParcels[proci]
+				<< vectorField(UIndirectList<vector>(wallU_, sendFaces));
+		}
+	}
+
+	labelList recvSizes;
+	pBufs.finishedSends(recvSizes);
+
+	label wallFacei = wallFaceLabels_.size();
+
+	for (label proci = 0; proci < nProcs; proci++)
+	{
+		if (proci == myProci || !recvSizes[proci])
+		{
+			continue;
+		}
+
+		UIPstream fromProc(proci, pBufs);
+
+		IDLList<parcelType> recvParcels
+		(
+			fromProc,
+			typename parcelType::iNew(mesh)
+		);
+
+		const vectorField recvU(fromProc);
+
+		SubField<vector>(wallU_, recvU.size(), wallFacei) = recvU;
+		wallFacei += recvU.size();
+
+		while (recvParcels.size())
+		{
+			ghostParcels_.append(recvParcels.removeHead());
+		}
+	}
+
+	// Give the ghost parcels the topology of the nearest local cell so that
+	// their positions can be evaluated
+	forAllIter(typename IDLList<parcelType>, ghostParcels_, iter)
+	{
+		const vector pos
+		(
+			iter().coordinates().b(),
+			iter().coordinates().c(),
+			iter().coordinates().d()
+		);
+
+		iter().correctAfterInteractionListReferral
+		(
+			mesh.cellTree().findNearest(pos, sqr(great)).index()
+		);
+	}
+}
+
+
+template<class CloudType>
+void tnbLib::PairCollision<CloudType>::hashParcelInteraction
+(
+	const scalar binSize
+)
+{
+	typedef typename CloudType::parcelType parcelType;
+
+	// The real parcels followed by the ghost parcels
+	DynamicList<parcelType*> parcels
+	(
+		this->owner().size() + ghostParcels_.size()
+	);
+
+	forAllIter(typename CloudType, this->owner(), iter)
+	{
+		parcels.append(&iter());
+	}
+
+	const label nReal = parcels.size();
+
+	forAllIter(typename IDLList<parcelType>, ghostParcels_, iter)
+	{
+		parcels.append(&iter());
+	}
 
-			evaluateWall
+	pointField positions(parcels.size());
+	forAll(parcels, i)
+	{
+		positions[i] = parcels[i]->position();
+	}
+
+	parcelHash_.build(positions, binSize);
+
+	const scalar binSizeSqr = sqr(binSize);
+
+	DynamicList<label> buckets(27);
+
+	// Every pair is evaluated once, by the parcel with the lower index, so
+	// the ghost parcels are only evaluated against the real parcels
+	for (label a = 0; a < nReal; a++)
+	{
+		const point& posA = positions[a];
+
+		parcelHash_.neighbourBuckets(posA, buckets);
+
+		forAll(buckets, bucketi)
+		{
+			const SubList<label> bucketParcels
 			(
-				p,
-				flatSitePoints,
-				flatSiteData,
-				sharpSitePoints,
-				sharpSiteData
+				parcelHash_.bucketPoints(buckets[bucketi])
 			);
+
+			forAll(bucketParcels, i)
+			{
+				const label b = bucketParcels[i];
+
+				if (b > a && magSqr(positions[b] - posA) < binSizeSqr)
+				{
+					evaluatePair(*parcels[a], *parcels[b]);
+				}
+			}
 		}
 	}
 }
 
 
+template<class CloudType>
+void tnbLib::PairCollision<CloudType>::hashWallInteraction()
+{
+	if (!wallTreePtr_.valid())
+	{
+		return;
+	}
+
+	const faceList& wallFaces = wallPatchPtr_();
+	const indexedOctree<treeDataPrimitivePatch<primitiveFacePatch>>&
+		wallTree = wallTreePtr_();
+
+	forAllIter(typename CloudType, this->owner(), iter)
+	{
+		typename CloudType::parcelType& p = iter();
+
+		const point pos = p.position();
+
+		const scalar r = wallModel_->pREff(p);
+
+		const labelList faces(wallTree.findSphere(pos, sqr(r)));
+
+		if (faces.empty())
+		{
+			continue;
+		}
+
+		clearWallSites();
+
+		forAll(faces, i)
+		{
+			const label facei = faces[i];
+			const face& f = wallFaces[facei];
+
+			const pointHit nearest = f.nearestPoint(pos, wallPoints_);
+
+			if (nearest.distance() < r)
+			{
+				const vector a = f.area(wallPoints_);
+
+				addWallSite
+				(
+					pos,
+					r,
+					nearest,
+					a/(mag(a) + vSmall),
+					WallSiteData<vector>(wallPatches_[facei], wallU_[facei])
+				);
+			}
+		}
+
+		evaluateWallSites(p, r);
+	}
+}
+
+
 template<class CloudType>
 bool tnbLib::PairCollision<CloudType>::duplicatePointInList
 (
@@ -523,21 +1009,72 @@ tnbLib::PairCollision<CloudType>::PairCollision
 			this->owner()
 		)
 	),
-	il_
+	UName_(this->coeffDict().lookupOrDefault("U", word("U"))),
+	spatialHash_
+	(
+		this->coeffDict().lookupOrDefault
+		(
+			"contactSearch",
+			word("interactionLists")
+		) == "spatialHash"
+	),
+	maxInteractionDistance_
+	(
+		spatialHash_
+	  ? this->coeffDict().lookupOrDefault("maxInteractionDistance", 0.0)
+	  : readScalar(this->coeffDict().lookup("maxInteractionDistance"))
+	),
+	ilPtr_(nullptr),
+	wallRange_(0)
+{
+	const word contactSearch
 	(
-		owner.mesh(),
-		readScalar(this->coeffDict().lookup("maxInteractionDistance")),
-		Switch
+		this->coeffDict().lookupOrDefault
 		(
-			this->coeffDict().lookupOrDefault
+			"contactSearch",
+			word("interactionLists")
+		)
+	);
+
+	if (contactSearch != "interactionLists" && contactSearch != "spatialHash")
+	{
+		FatalIOErrorInFunction(this->coeffDict())
+			<< "Unknown contactSearch " << contactSearch << nl
+			<< "Valid contactSearch methods are interactionLists and"
+			<< " spatialHash" << exit(FatalIOError);
+	}
+
+	if (!spatialHash_)
+	{
+		ilPtr_.reset
+		(
+			new InteractionLists<typename CloudType::parcelType>
 			(
-				"writeReferredParticleCloud",
-				false
+				owner.mesh(),
+				maxInteractionDistance_,
+				Switch
+				(
+					this->coeffDict().lookupOrDefault
+					(
+						"writeReferredParticleCloud",
+						false
+					)
+				),
+				UName_
 			)
-		),
-		this->coeffDict().lookupOrDefault("U", word("U"))
+		);
+	}
+	else if
+	(
+		owner.mesh().globalData().globalTransforms().nIndependentTransforms()
 	)
-{}
+	{
+		FatalIOErrorInFunction(this->coeffDict())
+			<< "The spatialHash contactSearch does not support cyclic"
+			<< " patches" << nl
+			<< "Use the interactionLists contactSearch" << exit(FatalIOError);
+	}
+}
 
 
 template<class CloudType>
@@ -549,7 +1086,11 @@ tnbLib::PairCollision<CloudType>::PairCollision
 	CollisionModel<CloudType>(cm),
 	pairModel_(nullptr),
 	wallModel_(nullptr),
-	il_(cm.owner().mesh())
+	UName_(cm.UName_),
+	spatialHash_(cm.spatialHash_),
+	maxInteractionDistance_(cm.maxInteractionDistance_),
+	ilPtr_(nullptr),
+	wallRange_(0)
 {
 	// Need to clone to PairModel and WallModel
 	NotImplemented;
@@ -599,9 +1140,37 @@ void tnbLib::PairCollision<CloudType>::collide()
 {
 	preInteraction();
 
-	parcelInteraction();
+	if (spatialHash_)
+	{
+		const scalar binSize = hashBinSize();
 
-	wallInteraction();
+		if (binSize > 0)
+		{
+			if
+			(
+				procBb_.empty()
+			 || this->owner().mesh().changing()
+			 || binSize > wallRange_
+			)
+			{
+				// Collect the wall faces with a margin for the growth of
+				// the parcels
+				buildWallFaces(2*binSize);
+			}
+
+			exchangeGhosts(binSize);
+
+			hashParcelInteraction(binSize);
+
+			hashWallInteraction();
+		}
+	}
+	else
+	{
+		parcelInteraction();
+
+		wallInteraction();
+	}
 
 	postInteraction();
 }
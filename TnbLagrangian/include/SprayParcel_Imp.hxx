@@ -261,7 +261,10 @@ void tnbLib::SprayParcel<ParcelType>::calcBreakup
 
 		// Add child parcel as copy of parent
 		SprayParcel<ParcelType>* child = new SprayParcel<ParcelType>(*this);
-		child->origId() = this->getNewParticleID();
+		{
+			std::unique_lock<std::recursive_mutex> lock(cloud.threadLock());
+			child->origId() = this->getNewParticleID();
+		}
 		child->d() = dChild;
 		child->d0() = dChild;
 		const scalar massChild = child->mass();
@@ -84,7 +84,7 @@ tnbLib::ThermoCloud<CloudType>::radAreaP()
 			<< abort(FatalError);
 	}
 
-	return radAreaP_();
+	return this->threadField(radAreaP_(), threadRadAreaP_);
 }
 
 
@@ -114,7 +114,7 @@ tnbLib::ThermoCloud<CloudType>::radT4()
 			<< abort(FatalError);
 	}
 
-	return radT4_();
+	return this->threadField(radT4_(), threadRadT4_);
 }
 
 
@@ -144,7 +144,7 @@ tnbLib::ThermoCloud<CloudType>::radAreaPT4()
 			<< abort(FatalError);
 	}
 
-	return radAreaPT4_();
+	return this->threadField(radAreaPT4_(), threadRadAreaPT4_);
 }
 
 
@@ -167,7 +167,7 @@ template<class CloudType>
 inline tnbLib::DimensionedField<tnbLib::scalar, tnbLib::volMesh>&
 tnbLib::ThermoCloud<CloudType>::hsTrans()
 {
-	return hsTrans_();
+	return this->threadField(hsTrans_(), threadHsTrans_);
 }
 
 
@@ -183,7 +183,7 @@ template<class CloudType>
 inline tnbLib::DimensionedField<tnbLib::scalar, tnbLib::volMesh>&
 tnbLib::ThermoCloud<CloudType>::hsCoeff()
 {
-	return hsCoeff_();
+	return this->threadField(hsCoeff_(), threadHsCoeff_);
 }
 
 
@@ -132,4 +132,10 @@ inline const tnbLib::Switch tnbLib::cloudSolution::resetSourcesOnStartup() const
 }
 
 
+inline const tnbLib::Switch tnbLib::cloudSolution::threadedTracking() const
+{
+	return threadedTracking_;
+}
+
+
 // ************************************************************************* //
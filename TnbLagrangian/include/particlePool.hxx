@@ -0,0 +1,210 @@
+#pragma once
+#ifndef _particlePool_Header
+#define _particlePool_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+	tnbLib::particlePool
+
+Description
+	Pooled storage of particles.
+
+	Particles are allocated in fixed-size slots of large contiguous slabs,
+	one pool per slot size, instead of individually on the heap. Freed slots
+	are reused by later allocations. A compaction, started by
+	Cloud::sortByCell, marks all the slabs as old and the particles of the
+	cloud are then copied into new slabs in cell order, so that particles
+	which are tracked one after the other are also next to each other in
+	memory. The slots of the old slabs are not reused and every old slab is
+	released as soon as its last particle is deleted. The slabs shared with
+	the particles of other clouds are therefore released when those clouds
+	are compacted or their particles deleted, so that the memory of the
+	pools stays bounded by that of the live particles of the slabs.
+
+	Pooling is selected by the particlePool optimisation switch. A particle
+	is returned to the pool it was allocated from whatever the switch, so it
+	may be changed at run time:
+
+	\verbatim
+	OptimisationSwitches
+	{
+		particlePool         1;
+		particlePoolSlabSize 4096;
+	}
+	\endverbatim
+
+	The pools are shared by all clouds and are thread-safe.
+
+SourceFiles
+	particlePool.C
+
+\*---------------------------------------------------------------------------*/
+
+#include <DynamicList.hxx>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	/*---------------------------------------------------------------------------*\
+							  Class particlePool Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class particlePool
+	{
+		// Private Static Data
+
+			//- Granularity of the slot sizes in bytes
+		static const std::size_t slotAlign_ = 16;
+
+		//- Size in bytes of the largest pooled particle. Larger particles
+		//  are allocated on the heap.
+		static const std::size_t maxSlotSize_ = 2048;
+
+		//- Pools by slot size, created on first use and kept to the end of
+		//  the run
+		static FoamLagrangian_EXPORT std::atomic<particlePool*>
+			pools_[maxSlotSize_/slotAlign_];
+
+		//- Lock on the creation of the pools and on the compaction
+		static FoamLagrangian_EXPORT std::mutex poolsMutex_;
+
+
+		// Private Data
+
+			//- Number of slots, number of slots in use and generation of a
+			//  slab
+		struct slab
+		{
+			label nSlots;
+			label nLive;
+			bool old;
+		};
+
+		//- Size of the slots in bytes
+		const std::size_t slotSize_;
+
+		//- Slabs by their address
+		std::map<char*, slab> slabs_;
+
+		//- Slab in which unused slots are allocated
+		char* slab_;
+
+		//- Index of the next unused slot of slab_
+		label nextSlot_;
+
+		//- Number of slots of slab_
+		label slabNSlots_;
+
+		//- Freed slots of the slabs which are not old
+		DynamicList<void*> freeSlots_;
+
+		//- Lock on the slots
+		std::mutex mutex_;
+
+
+		// Private Member Functions
+
+			//- Return the pool for particles of the given size
+		static FoamLagrangian_EXPORT particlePool& pool(const std::size_t size);
+
+		//- Return the slab containing the given slot or slabs_.end()
+		FoamLagrangian_EXPORT std::map<char*, slab>::iterator findSlab
+		(
+			void* ptr
+		);
+
+		//- Allocate a slot
+		FoamLagrangian_EXPORT void* allocateSlot();
+
+		//- Return a slot to the pool. Returns false if the slot is not from
+		//  this pool.
+		FoamLagrangian_EXPORT bool deallocateSlot(void* ptr);
+
+		//- Mark the slabs as old and allocate all further slots in new
+		//  slabs
+		FoamLagrangian_EXPORT void beginPoolCompaction();
+
+
+	public:
+
+		// Static Data
+
+			//- Are the particles pooled?
+		static FoamLagrangian_EXPORT bool enabled;
+
+		//- Number of slots per new slab
+		static FoamLagrangian_EXPORT int slabSize;
+
+
+		// Constructors
+
+			//- Construct for the given slot size
+		FoamLagrangian_EXPORT particlePool(const std::size_t slotSize);
+
+		//- Disallow default bitwise copy construction
+		particlePool(const particlePool&) = delete;
+
+
+		//- Destructor
+		FoamLagrangian_EXPORT ~particlePool();
+
+
+		// Static Member Functions
+
+			//- Allocate storage for a particle of the given size
+		static FoamLagrangian_EXPORT void* allocate(const std::size_t size);
+
+		//- Release the storage of a particle of the given size
+		static FoamLagrangian_EXPORT void deallocate
+		(
+			void* ptr,
+			const std::size_t size
+		);
+
+		//- Start a compaction of all the pools. The particles allocated
+		//  until the next compaction are stored in new slabs.
+		static FoamLagrangian_EXPORT void beginCompaction();
+
+
+		// Member Operators
+
+			//- Disallow default bitwise assignment
+		void operator=(const particlePool&) = delete;
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_particlePool_Header
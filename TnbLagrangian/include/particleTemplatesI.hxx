@@ -70,8 +70,8 @@ void tnbLib::particle::writeFields(const TrackCloudType& c)
 		i++;
 	}
 
-	origProc.write(np > 0);
-	origId.write(np > 0);
+	c.writeField(origProc, np > 0);
+	c.writeField(origId, np > 0);
 }
 
 
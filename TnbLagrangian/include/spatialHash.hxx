@@ -0,0 +1,143 @@
+#pragma once
+#ifndef _spatialHash_Header
+#define _spatialHash_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+	tnbLib::spatialHash
+
+Description
+	Linked-cell spatial hash of a set of points.
+
+	Space is divided into cubic bins of the given size which are hashed
+	into a table of about twice as many buckets as points, so that the
+	memory is independent of the extent of the points. The points are
+	sorted into the buckets by a counting sort, so that the hash is
+	rebuilt in O(N) and the points of a bucket are contiguous.
+
+	The points within a bin size of a location are in the buckets of the
+	27 bins around it, which are returned without duplicates. Points of
+	other bins which hash to the same buckets are also returned so the
+	caller has to check the distance.
+
+SourceFiles
+	spatialHash.cxx
+
+\*---------------------------------------------------------------------------*/
+
+#include <pointField.hxx>
+#include <labelList.hxx>
+#include <DynamicList.hxx>
+#include <SubList.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	/*---------------------------------------------------------------------------*\
+							  Class spatialHash Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class spatialHash
+	{
+		// Private Data
+
+			//- Size of the bins
+		scalar binSize_;
+
+		//- Start of the points of each bucket in pointOrder_
+		labelList bucketStart_;
+
+		//- Point labels sorted by bucket
+		labelList pointOrder_;
+
+
+		// Private Member Functions
+
+			//- Return the bucket of the bin with the given integer coordinates
+		inline label bucket
+		(
+			const int64_t i,
+			const int64_t j,
+			const int64_t k
+		) const;
+
+		//- Return the integer coordinate of the bin of a coordinate
+		inline int64_t bin(const scalar x) const;
+
+
+	public:
+
+		// Constructors
+
+			//- Construct null
+		FoamLagrangian_EXPORT spatialHash();
+
+
+		// Member Functions
+
+			//- Sort the points into the buckets of bins of the given size
+		FoamLagrangian_EXPORT void build(const UList<point>& points, const scalar binSize);
+
+		//- Return the bin size
+		scalar binSize() const
+		{
+			return binSize_;
+		}
+
+		//- Return the number of buckets
+		label nBuckets() const
+		{
+			return bucketStart_.size() - 1;
+		}
+
+		//- Return the bucket of a point
+		inline label bucket(const point& pt) const;
+
+		//- Set the buckets of the 27 bins around a point, without
+		//  duplicates
+		FoamLagrangian_EXPORT void neighbourBuckets
+		(
+			const point& pt,
+			DynamicList<label>& buckets
+		) const;
+
+		//- Return the labels of the points in a bucket
+		inline const SubList<label> bucketPoints(const label bucketi) const;
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#include <spatialHashI.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_spatialHash_Header
@@ -0,0 +1,48 @@
+#pragma once
+#include <cmath>
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+inline tnbLib::label tnbLib::spatialHash::bucket
+(
+	const int64_t i,
+	const int64_t j,
+	const int64_t k
+) const
+{
+	const uint64_t h =
+		(uint64_t(i)*73856093u)
+	  ^ (uint64_t(j)*19349663u)
+	  ^ (uint64_t(k)*83492791u);
+
+	return label(h % uint64_t(nBuckets()));
+}
+
+
+inline int64_t tnbLib::spatialHash::bin(const scalar x) const
+{
+	return int64_t(std::floor(x/binSize_));
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+inline tnbLib::label tnbLib::spatialHash::bucket(const point& pt) const
+{
+	return bucket(bin(pt.x()), bin(pt.y()), bin(pt.z()));
+}
+
+
+inline const tnbLib::SubList<tnbLib::label>
+tnbLib::spatialHash::bucketPoints(const label bucketi) const
+{
+	return SubList<label>
+	(
+		pointOrder_,
+		bucketStart_[bucketi + 1] - bucketStart_[bucketi],
+		bucketStart_[bucketi]
+	);
+}
+
+
+// ************************************************************************* //
@@ -59,7 +59,7 @@ tnbLib::scalar tnbLib::EulerSI::solve
 	scalarField& y
 ) const
 {
-	odes_.jacobian(x0, y0, dfdx_, dfdy_);
+	jacobian(x0, y0, dfdx_, dfdy_);
 
 	for (label i = 0; i < n_; i++)
 	{
@@ -71,7 +71,7 @@ tnbLib::scalar tnbLib::EulerSI::solve
 		a_(i, i) += 1.0 / dx;
 	}
 
-	LUDecompose(a_, pivotIndices_);
+	decomposeLU(a_, pivotIndices_);
 
 	// Calculate error estimate from the change in state:
 	forAll(err_, i)
@@ -79,7 +79,7 @@ tnbLib::scalar tnbLib::EulerSI::solve
 		err_[i] = dydx0[i] + dx * dfdx_[i];
 	}
 
-	LUBacksubstitute(a_, pivotIndices_, err_);
+	backSubstituteLU(a_, pivotIndices_, err_);
 
 	forAll(y, i)
 	{
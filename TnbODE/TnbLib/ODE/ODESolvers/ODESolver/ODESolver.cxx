@@ -1,6 +1,8 @@
 #include <ODESolver.hxx>
 
 #include <dictionary.hxx>  // added by amir
+#include <Switch.hxx>
+#include <clockTime.hxx>
 
 // * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
 
@@ -32,6 +34,87 @@ tnbLib::scalar tnbLib::ODESolver::normalizeError
 }
 
 
+void tnbLib::ODESolver::jacobian
+(
+	const scalar x,
+	const scalarField& y,
+	scalarField& dfdx,
+	scalarSquareMatrix& dfdy
+) const
+{
+	stats_.nJacobians++;
+
+	odes_.jacobian(x, y, dfdx, dfdy);
+}
+
+
+void tnbLib::ODESolver::decomposeLU
+(
+	scalarSquareMatrix& a,
+	labelList& pivotIndices
+) const
+{
+	const clockTime timer;
+
+	if (sparse_ && !sparseLUPtr_.valid())
+	{
+		const labelListList pattern(odes_.jacobianPattern());
+
+		if (pattern.size() == maxN_)
+		{
+			sparseLUPtr_.reset(new sparseLU(pattern));
+
+			if (debug)
+			{
+				Info << typeName << ": sparse LU of " << maxN_
+					<< " equations with " << sparseLUPtr_->nNonZero()
+					<< " non-zero coefficients" << endl;
+			}
+		}
+		else
+		{
+			// The ODESystem does not provide a pattern
+			sparse_ = false;
+		}
+	}
+
+	denseLU_ =
+		!sparse_
+	 || sparseLUPtr_->n() != n_
+	 || !sparseLUPtr_->decompose(a);
+
+	if (denseLU_)
+	{
+		LUDecompose(a, pivotIndices);
+	}
+
+	stats_.nLU++;
+	stats_.LUTime += timer.elapsedTime();
+}
+
+
+void tnbLib::ODESolver::backSubstituteLU
+(
+	const scalarSquareMatrix& a,
+	const labelList& pivotIndices,
+	scalarField& source
+) const
+{
+	const clockTime timer;
+
+	if (denseLU_)
+	{
+		LUBacksubstitute(a, pivotIndices, source);
+	}
+	else
+	{
+		sparseLUPtr_->solve(source);
+	}
+
+	stats_.LUTime += timer.elapsedTime();
+}
+
+
 // * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
 
 tnbLib::ODESolver::ODESolver(const ODESystem& ode, const dictionary& dict)
@@ -41,7 +124,9 @@ tnbLib::ODESolver::ODESolver(const ODESystem& ode, const dictionary& dict)
 	n_(ode.nEqns()),
 	absTol_(n_, dict.lookupOrDefault<scalar>("absTol", small)),
 	relTol_(n_, dict.lookupOrDefault<scalar>("relTol", 1e-4)),
-	maxSteps_(dict.lookupOrDefault<scalar>("maxSteps", 10000))
+	maxSteps_(dict.lookupOrDefault<scalar>("maxSteps", 10000)),
+	sparse_(dict.lookupOrDefault<Switch>("sparseLU", false)),
+	denseLU_(true)
 {}
 
 
@@ -57,7 +142,9 @@ tnbLib::ODESolver::ODESolver
 	n_(ode.nEqns()),
 	absTol_(absTol),
 	relTol_(relTol),
-	maxSteps_(10000)
+	maxSteps_(10000),
+	sparse_(false),
+	denseLU_(true)
 {}
 
 
@@ -128,6 +215,8 @@ void tnbLib::ODESolver::solve
 
 	for (label nStep = 0; nStep < maxSteps_; nStep++)
 	{
+		stats_.nSteps++;
+
 		// Store previous iteration dxTry
 		scalar dxTry0 = step.dxTry;
 
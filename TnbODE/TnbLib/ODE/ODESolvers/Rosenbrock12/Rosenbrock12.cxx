@@ -75,7 +75,7 @@ tnbLib::scalar tnbLib::Rosenbrock12::solve
 	scalarField& y
 ) const
 {
-	odes_.jacobian(x0, y0, dfdx_, dfdy_);
+	jacobian(x0, y0, dfdx_, dfdy_);
 
 	for (label i = 0; i < n_; i++)
 	{
@@ -87,7 +87,7 @@ tnbLib::scalar tnbLib::Rosenbrock12::solve
 		a_(i, i) += 1.0 / (gamma*dx);
 	}
 
-	LUDecompose(a_, pivotIndices_);
+	decomposeLU(a_, pivotIndices_);
 
 	// Calculate k1:
 	forAll(k1_, i)
@@ -95,7 +95,7 @@ tnbLib::scalar tnbLib::Rosenbrock12::solve
 		k1_[i] = dydx0[i] + dx * d1*dfdx_[i];
 	}
 
-	LUBacksubstitute(a_, pivotIndices_, k1_);
+	backSubstituteLU(a_, pivotIndices_, k1_);
 
 	// Calculate k2:
 	forAll(y, i)
@@ -110,7 +110,7 @@ tnbLib::scalar tnbLib::Rosenbrock12::solve
 		k2_[i] = dydx_[i] + dx * d2*dfdx_[i] + c21 * k1_[i] / dx;
 	}
 
-	LUBacksubstitute(a_, pivotIndices_, k2_);
+	backSubstituteLU(a_, pivotIndices_, k2_);
 
 	// Calculate error and update state:
 	forAll(y, i)
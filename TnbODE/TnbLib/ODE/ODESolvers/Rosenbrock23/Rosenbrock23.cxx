@@ -89,7 +89,7 @@ tnbLib::scalar tnbLib::Rosenbrock23::solve
 	scalarField& y
 ) const
 {
-	odes_.jacobian(x0, y0, dfdx_, dfdy_);
+	jacobian(x0, y0, dfdx_, dfdy_);
 
 	for (label i = 0; i < n_; i++)
 	{
@@ -101,7 +101,7 @@ tnbLib::scalar tnbLib::Rosenbrock23::solve
 		a_(i, i) += 1.0 / (gamma*dx);
 	}
 
-	LUDecompose(a_, pivotIndices_);
+	decomposeLU(a_, pivotIndices_);
 
 	// Calculate k1:
 	forAll(k1_, i)
@@ -109,7 +109,7 @@ tnbLib::scalar tnbLib::Rosenbrock23::solve
 		k1_[i] = dydx0[i] + dx * d1*dfdx_[i];
 	}
 
-	LUBacksubstitute(a_, pivotIndices_, k1_);
+	backSubstituteLU(a_, pivotIndices_, k1_);
 
 	// Calculate k2:
 	forAll(y, i)
@@ -124,7 +124,7 @@ tnbLib::scalar tnbLib::Rosenbrock23::solve
 		k2_[i] = dydx_[i] + dx * d2*dfdx_[i] + c21 * k1_[i] / dx;
 	}
 
-	LUBacksubstitute(a_, pivotIndices_, k2_);
+	backSubstituteLU(a_, pivotIndices_, k2_);
 
 	// Calculate k3:
 	forAll(k3_, i)
@@ -133,7 +133,7 @@ tnbLib::scalar tnbLib::Rosenbrock23::solve
 			+ (c31*k1_[i] + c32 * k2_[i]) / dx;
 	}
 
-	LUBacksubstitute(a_, pivotIndices_, k3_);
+	backSubstituteLU(a_, pivotIndices_, k3_);
 
 	// Calculate error and update state:
 	forAll(y, i)
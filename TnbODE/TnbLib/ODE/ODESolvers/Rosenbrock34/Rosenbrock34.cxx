@@ -135,7 +135,7 @@ tnbLib::scalar tnbLib::Rosenbrock34::solve
 	scalarField& y
 ) const
 {
-	odes_.jacobian(x0, y0, dfdx_, dfdy_);
+	jacobian(x0, y0, dfdx_, dfdy_);
 
 	for (label i = 0; i < n_; i++)
 	{
@@ -147,7 +147,7 @@ tnbLib::scalar tnbLib::Rosenbrock34::solve
 		a_(i, i) += 1.0 / (gamma*dx);
 	}
 
-	LUDecompose(a_, pivotIndices_);
+	decomposeLU(a_, pivotIndices_);
 
 	// Calculate k1:
 	forAll(k1_, i)
@@ -155,7 +155,7 @@ tnbLib::scalar tnbLib::Rosenbrock34::solve
 		k1_[i] = dydx0[i] + dx * d1*dfdx_[i];
 	}
 
-	LUBacksubstitute(a_, pivotIndices_, k1_);
+	backSubstituteLU(a_, pivotIndices_, k1_);
 
 	// Calculate k2:
 	forAll(y, i)
@@ -170,7 +170,7 @@ tnbLib::scalar tnbLib::Rosenbrock34::solve
 		k2_[i] = dydx_[i] + dx * d2*dfdx_[i] + c21 * k1_[i] / dx;
 	}
 
-	LUBacksubstitute(a_, pivotIndices_, k2_);
+	backSubstituteLU(a_, pivotIndices_, k2_);
 
 	// Calculate k3:
 	forAll(y, i)
@@ -185,7 +185,7 @@ tnbLib::scalar tnbLib::Rosenbrock34::solve
 		k3_[i] = dydx_[i] + dx * d3*dfdx_[i] + (c31*k1_[i] + c32 * k2_[i]) / dx;
 	}
 
-	LUBacksubstitute(a_, pivotIndices_, k3_);
+	backSubstituteLU(a_, pivotIndices_, k3_);
 
 	// Calculate k4:
 	forAll(k4_, i)
@@ -194,7 +194,7 @@ tnbLib::scalar tnbLib::Rosenbrock34::solve
 			+ (c41*k1_[i] + c42 * k2_[i] + c43 * k3_[i]) / dx;
 	}
 
-	LUBacksubstitute(a_, pivotIndices_, k4_);
+	backSubstituteLU(a_, pivotIndices_, k4_);
 
 	// Calculate error and update state:
 	forAll(y, i)
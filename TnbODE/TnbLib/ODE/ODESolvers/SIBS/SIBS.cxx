@@ -119,7 +119,7 @@ void tnbLib::SIBS::solve
 	label k = 0;
 	yTemp_ = y;
 
-	odes_.jacobian(x, y, dfdx_, dfdy_);
+	jacobian(x, y, dfdx_, dfdy_);
 
 	if (x != xNew_ || h != dxTry)
 	{
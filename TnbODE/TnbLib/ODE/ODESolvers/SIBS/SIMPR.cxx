@@ -27,14 +27,14 @@ void tnbLib::SIBS::SIMPR
 	}
 
 	labelList pivotIndices(n_);
-	LUDecompose(a, pivotIndices);
+	decomposeLU(a, pivotIndices);
 
 	for (label i = 0; i < n_; i++)
 	{
 		yEnd[i] = h * (dydx[i] + h * dfdx[i]);
 	}
 
-	LUBacksubstitute(a, pivotIndices, yEnd);
+	backSubstituteLU(a, pivotIndices, yEnd);
 
 	scalarField del(yEnd);
 	scalarField ytemp(n_);
@@ -55,7 +55,7 @@ void tnbLib::SIBS::SIMPR
 			yEnd[i] = h * yEnd[i] - del[i];
 		}
 
-		LUBacksubstitute(a, pivotIndices, yEnd);
+		backSubstituteLU(a, pivotIndices, yEnd);
 
 		for (label i = 0; i < n_; i++)
 		{
@@ -71,7 +71,7 @@ void tnbLib::SIBS::SIMPR
 		yEnd[i] = h * yEnd[i] - del[i];
 	}
 
-	LUBacksubstitute(a, pivotIndices, yEnd);
+	backSubstituteLU(a, pivotIndices, yEnd);
 
 	for (label i = 0; i < n_; i++)
 	{
@@ -81,7 +81,7 @@ tnbLib::scalar tnbLib::rodas23::solve
 	scalarField& y
 ) const
 {
-	odes_.jacobian(x0, y0, dfdx_, dfdy_);
+	jacobian(x0, y0, dfdx_, dfdy_);
 
 	for (label i = 0; i < n_; i++)
 	{
@@ -93,7 +93,7 @@ tnbLib::scalar tnbLib::rodas23::solve
 		a_(i, i) += 1.0 / (gamma*dx);
 	}
 
-	LUDecompose(a_, pivotIndices_);
+	decomposeLU(a_, pivotIndices_);
 
 	// Calculate k1:
 	forAll(k1_, i)
@@ -101,7 +101,7 @@ tnbLib::scalar tnbLib::rodas23::solve
 		k1_[i] = dydx0[i] + dx * d1*dfdx_[i];
 	}
 
-	LUBacksubstitute(a_, pivotIndices_, k1_);
+	backSubstituteLU(a_, pivotIndices_, k1_);
 
 	// Calculate k2:
 	forAll(k2_, i)
@@ -109,7 +109,7 @@ tnbLib::scalar tnbLib::rodas23::solve
 		k2_[i] = dydx0[i] + dx * d2*dfdx_[i] + c21 * k1_[i] / dx;
 	}
 
-	LUBacksubstitute(a_, pivotIndices_, k2_);
+	backSubstituteLU(a_, pivotIndices_, k2_);
 
 	// Calculate k3:
 	forAll(y, i)
@@ -125,7 +125,7 @@ tnbLib::scalar tnbLib::rodas23::solve
 		k3_[i] = dydx_[i] + (c31*k1_[i] + c32 * k2_[i]) / dx;
 	}
 
-	LUBacksubstitute(a_, pivotIndices_, k3_);
+	backSubstituteLU(a_, pivotIndices_, k3_);
 
 	// Calculate new state and error
 	forAll(y, i)
@@ -141,7 +141,7 @@ tnbLib::scalar tnbLib::rodas23::solve
 		err_[i] = dydx_[i] + (c41*k1_[i] + c42 * k2_[i] + c43 * k3_[i]) / dx;
 	}
 
-	LUBacksubstitute(a_, pivotIndices_, err_);
+	backSubstituteLU(a_, pivotIndices_, err_);
 
 	forAll(y, i)
 	{
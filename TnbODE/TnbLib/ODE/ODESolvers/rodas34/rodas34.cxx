@@ -106,7 +106,7 @@ tnbLib::scalar tnbLib::rodas34::solve
 	scalarField& y
 ) const
 {
-	odes_.jacobian(x0, y0, dfdx_, dfdy_);
+	jacobian(x0, y0, dfdx_, dfdy_);
 
 	for (label i = 0; i < n_; i++)
 	{
@@ -118,7 +118,7 @@ tnbLib::scalar tnbLib::rodas34::solve
 		a_(i, i) += 1.0 / (gamma*dx);
 	}
 
-	LUDecompose(a_, pivotIndices_);
+	decomposeLU(a_, pivotIndices_);
 
 	// Calculate k1:
 	forAll(k1_, i)
@@ -126,7 +126,7 @@ tnbLib::scalar tnbLib::rodas34::solve
 		k1_[i] = dydx0[i] + dx * d1*dfdx_[i];
 	}
 
-	LUBacksubstitute(a_, pivotIndices_, k1_);
+	backSubstituteLU(a_, pivotIndices_, k1_);
 
 	// Calculate k2:
 	forAll(y, i)
@@ -141,7 +141,7 @@ tnbLib::scalar tnbLib::rodas34::solve
 		k2_[i] = dydx_[i] + dx * d2*dfdx_[i] + c21 * k1_[i] / dx;
 	}
 
-	LUBacksubstitute(a_, pivotIndices_, k2_);
+	backSubstituteLU(a_, pivotIndices_, k2_);
 
 	// Calculate k3:
 	forAll(y, i)
@@ -156,7 +156,7 @@ tnbLib::scalar tnbLib::rodas34::solve
 		k3_[i] = dydx_[i] + dx * d3*dfdx_[i] + (c31*k1_[i] + c32 * k2_[i]) / dx;
 	}
 
-	LUBacksubstitute(a_, pivotIndices_, k3_);
+	backSubstituteLU(a_, pivotIndices_, k3_);
 
 	// Calculate k4:
 	forAll(y, i)
@@ -172,7 +172,7 @@ tnbLib::scalar tnbLib::rodas34::solve
 			+ (c41*k1_[i] + c42 * k2_[i] + c43 * k3_[i]) / dx;
 	}
 
-	LUBacksubstitute(a_, pivotIndices_, k4_);
+	backSubstituteLU(a_, pivotIndices_, k4_);
 
 	// Calculate k5:
 	forAll(y, i)
@@ -189,7 +189,7 @@ tnbLib::scalar tnbLib::rodas34::solve
 			+ (c51*k1_[i] + c52 * k2_[i] + c53 * k3_[i] + c54 * k4_[i]) / dx;
 	}
 
-	LUBacksubstitute(a_, pivotIndices_, k5_);
+	backSubstituteLU(a_, pivotIndices_, k5_);
 
 	// Calculate new state and error
 	forAll(y, i)
@@ -206,7 +206,7 @@ tnbLib::scalar tnbLib::rodas34::solve
 			+ (c61*k1_[i] + c62 * k2_[i] + c63 * k3_[i] + c64 * k4_[i] + c65 * k5_[i]) / dx;
 	}
 
-	LUBacksubstitute(a_, pivotIndices_, err_);
+	backSubstituteLU(a_, pivotIndices_, err_);
 
 	forAll(y, i)
 	{
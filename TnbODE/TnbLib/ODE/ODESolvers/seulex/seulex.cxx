@@ -99,11 +99,11 @@ bool tnbLib::seulex::seul
 		a_(i, i) += 1 / dx;
 	}
 
-	LUDecompose(a_, pivotIndices_);
+	decomposeLU(a_, pivotIndices_);
 
 	scalar xnew = x0 + dx;
 	odes_.derivatives(xnew, y0, dy_);
-	LUBacksubstitute(a_, pivotIndices_, dy_);
+	backSubstituteLU(a_, pivotIndices_, dy_);
 
 	yTemp_ = y0;
 
@@ -127,7 +127,7 @@ bool tnbLib::seulex::seul
 				dy_[i] = dydx_[i] - dy_[i] / dx;
 			}
 
-			LUBacksubstitute(a_, pivotIndices_, dy_);
+			backSubstituteLU(a_, pivotIndices_, dy_);
 
 			// This form from the original paper is unreliable
 			// step size underflow for some cases
@@ -158,7 +158,7 @@ bool tnbLib::seulex::seul
 		}
 
 		odes_.derivatives(xnew, yTemp_, dy_);
-		LUBacksubstitute(a_, pivotIndices_, dy_);
+		backSubstituteLU(a_, pivotIndices_, dy_);
 	}
 
 	for (label i = 0; i < n_; i++)
@@ -251,7 +251,7 @@ void tnbLib::seulex::solve
 
 	if (theta_ > jacRedo_)
 	{
-		odes_.jacobian(x, y, dfdx_, dfdy_);
+		jacobian(x, y, dfdx_, dfdy_);
 		jacUpdated = true;
 	}
 
@@ -403,7 +403,7 @@ void tnbLib::seulex::solve
 
 				if (theta_ > jacRedo_ && !jacUpdated)
 				{
-					odes_.jacobian(x, y, dfdx_, dfdy_);
+					jacobian(x, y, dfdx_, dfdy_);
 					jacUpdated = true;
 				}
 			}
@@ -1,2 +1,11 @@
 #include <ODESystem.hxx>
 
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+tnbLib::labelListList tnbLib::ODESystem::jacobianPattern() const
+{
+	return labelListList();
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,245 @@
+#include <sparseLU.hxx>
+
+#include <HashSet.hxx>
+#include <DynamicList.hxx>
+#include <boolList.hxx>
+#include <error.hxx>
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+void tnbLib::sparseLU::minimumDegreeOrder(const labelListList& pattern)
+{
+	// Symmetrised graph of the pattern without the diagonal
+	List<labelHashSet> graph(n_);
+
+	forAll(pattern, i)
+	{
+		forAll(pattern[i], pi)
+		{
+			const label j = pattern[i][pi];
+
+			if (j < 0 || j >= n_)
+			{
+				FatalErrorInFunction
+					<< "Column " << j << " of row " << i
+					<< " out of range 0.." << n_ - 1
+					<< exit(FatalError);
+			}
+
+			if (j != i)
+			{
+				graph[i].insert(j);
+				graph[j].insert(i);
+			}
+		}
+	}
+
+	boolList eliminated(n_, false);
+
+	for (label k = 0; k < n_; k++)
+	{
+		// Select the first of the remaining rows of minimum degree
+		label mini = -1;
+
+		forAll(graph, i)
+		{
+			if
+			(
+				!eliminated[i]
+			 && (mini == -1 || graph[i].size() < graph[mini].size())
+			)
+			{
+				mini = i;
+			}
+		}
+
+		order_[k] = mini;
+		eliminated[mini] = true;
+
+		// Eliminating the row connects its neighbours to each other
+		const labelList nbrs(graph[mini].toc());
+
+		forAll(nbrs, ni)
+		{
+			labelHashSet& nbrGraph = graph[nbrs[ni]];
+
+			nbrGraph.erase(mini);
+
+			forAll(nbrs, nj)
+			{
+				if (nj != ni)
+				{
+					nbrGraph.insert(nbrs[nj]);
+				}
+			}
+		}
+
+		graph[mini].clear();
+	}
+}
+
+
+void tnbLib::sparseLU::symbolicFactorise(const labelListList& pattern)
+{
+	labelList position(n_);
+	forAll(order_, k)
+	{
+		position[order_[k]] = k;
+	}
+
+	boolList marked(n_, false);
+	DynamicList<label> columns;
+
+	rowStart_[0] = 0;
+
+	for (label i = 0; i < n_; i++)
+	{
+		const labelList& row = pattern[order_[i]];
+
+		marked[i] = true;
+		forAll(row, pi)
+		{
+			marked[position[row[pi]]] = true;
+		}
+
+		// Fill-in from the rows of the upper factor of the columns which
+		// are eliminated, including those introduced by the fill-in itself
+		for (label k = 0; k < i; k++)
+		{
+			if (marked[k])
+			{
+				for (label pk = diag_[k] + 1; pk < rowStart_[k + 1]; pk++)
+				{
+					marked[columns[pk]] = true;
+				}
+			}
+		}
+
+		for (label j = 0; j < n_; j++)
+		{
+			if (marked[j])
+			{
+				if (j == i)
+				{
+					diag_[i] = columns.size();
+				}
+
+				columns.append(j);
+				marked[j] = false;
+			}
+		}
+
+		rowStart_[i + 1] = columns.size();
+	}
+
+	column_.transfer(columns);
+	coeffs_.setSize(column_.size());
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+tnbLib::sparseLU::sparseLU(const labelListList& pattern)
+	:
+	n_(pattern.size()),
+	order_(n_),
+	rowStart_(n_ + 1),
+	column_(),
+	diag_(n_),
+	coeffs_(),
+	work_(n_)
+{
+	minimumDegreeOrder(pattern);
+	symbolicFactorise(pattern);
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+bool tnbLib::sparseLU::decompose(const scalarSquareMatrix& a)
+{
+	for (label i = 0; i < n_; i++)
+	{
+		const label rowi = order_[i];
+		const label start = rowStart_[i];
+		const label end = rowStart_[i + 1];
+
+		scalar rowMax = 0;
+
+		for (label pi = start; pi < end; pi++)
+		{
+			const scalar aij = a(rowi, order_[column_[pi]]);
+
+			work_[column_[pi]] = aij;
+			rowMax = max(rowMax, mag(aij));
+		}
+
+		for (label pi = start; pi < diag_[i]; pi++)
+		{
+			const label k = column_[pi];
+			const scalar lik = work_[k]/coeffs_[diag_[k]];
+
+			work_[k] = lik;
+
+			for (label pk = diag_[k] + 1; pk < rowStart_[k + 1]; pk++)
+			{
+				work_[column_[pk]] -= lik*coeffs_[pk];
+			}
+		}
+
+		for (label pi = start; pi < end; pi++)
+		{
+			coeffs_[pi] = work_[column_[pi]];
+		}
+
+		if (mag(coeffs_[diag_[i]]) <= rootSmall*rowMax)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+void tnbLib::sparseLU::solve(UList<scalar>& source) const
+{
+	for (label i = 0; i < n_; i++)
+	{
+		work_[i] = source[order_[i]];
+	}
+
+	// Forward substitution with the unit lower factor
+	for (label i = 0; i < n_; i++)
+	{
+		scalar sum = work_[i];
+
+		for (label pi = rowStart_[i]; pi < diag_[i]; pi++)
+		{
+			sum -= coeffs_[pi]*work_[column_[pi]];
+		}
+
+		work_[i] = sum;
+	}
+
+	// Back substitution with the upper factor
+	for (label i = n_ - 1; i >= 0; i--)
+	{
+		scalar sum = work_[i];
+
+		for (label pi = diag_[i] + 1; pi < rowStart_[i + 1]; pi++)
+		{
+			sum -= coeffs_[pi]*work_[column_[pi]];
+		}
+
+		work_[i] = sum/coeffs_[diag_[i]];
+	}
+
+	for (label i = 0; i < n_; i++)
+	{
+		source[order_[i]] = work_[i];
+	}
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,137 @@
+#pragma once
+#ifndef _sparseLU_Header
+#define _sparseLU_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+	tnbLib::sparseLU
+
+Description
+	LU decomposition of a square matrix with a fixed sparsity pattern.
+
+	The analysis is done once on construction from the pattern: a fill
+	reducing elimination order is chosen by the minimum degree heuristic on
+	the symmetrised pattern and the pattern of the factors, including the
+	fill-in, is computed symbolically and stored in compressed row form.
+	Every decomposition then only computes the coefficients of the factors,
+	without pivoting, from the coefficients of the matrix on this pattern.
+
+	Since the pivots are not chosen numerically, decompose() returns false
+	if a pivot is small relative to its row, in which case the matrix should
+	be decomposed by the dense LUDecompose with partial pivoting instead.
+
+SourceFiles
+	sparseLU.cxx
+
+\*---------------------------------------------------------------------------*/
+
+#include <scalarMatrices.hxx>
+#include <labelList.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	/*---------------------------------------------------------------------------*\
+							   Class sparseLU Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class sparseLU
+	{
+		// Private Data
+
+			//- Number of rows
+		label n_;
+
+		//- Rows in the order of elimination
+		labelList order_;
+
+		//- Start of the rows of the factors in column_ and coeffs_
+		labelList rowStart_;
+
+		//- Columns of the coefficients of the factors in the order of
+		//  elimination, ascending in each row
+		labelList column_;
+
+		//- Position of the diagonal coefficient of each row of the factors
+		labelList diag_;
+
+		//- Coefficients of the factors, the strictly lower triangle of the
+		//  unit lower factor followed by the upper factor
+		scalarField coeffs_;
+
+		//- Row work array
+		mutable scalarField work_;
+
+
+		// Private Member Functions
+
+			//- Set order_ by the minimum degree heuristic
+		void minimumDegreeOrder(const labelListList& pattern);
+
+		//- Set the pattern of the factors for the elimination order
+		void symbolicFactorise(const labelListList& pattern);
+
+
+	public:
+
+		// Constructors
+
+			//- Construct and analyse for the columns of the non-zero
+			//  coefficients of each row. The diagonal is always included.
+		FoamODE_EXPORT explicit sparseLU(const labelListList& pattern);
+
+
+		// Member Functions
+
+			//- Return the number of rows
+		label n() const
+		{
+			return n_;
+		}
+
+		//- Return the number of non-zero coefficients of the factors
+		label nNonZero() const
+		{
+			return coeffs_.size();
+		}
+
+		//- Decompose the given matrix, only reading the coefficients on the
+		//  pattern. Returns false if a pivot is too small.
+		FoamODE_EXPORT bool decompose(const scalarSquareMatrix& a);
+
+		//- Solve the decomposed system in place of the source
+		FoamODE_EXPORT void solve(UList<scalar>& source) const;
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_sparseLU_Header
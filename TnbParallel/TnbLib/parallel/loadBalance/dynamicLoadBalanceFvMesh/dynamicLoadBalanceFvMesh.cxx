@@ -0,0 +1,245 @@
+#include <dynamicLoadBalanceFvMesh.hxx>
+
+#include <addToRunTimeSelectionTable.hxx>
+#include <fvMeshDistribute.hxx>
+#include <mapDistributePolyMesh.hxx>
+#include <cloud.hxx>
+#include <wordRe.hxx>
+#include <Time.hxx>
+#include <PstreamReduceOps.hxx>
+
+// * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+	defineTypeNameAndDebug(dynamicLoadBalanceFvMesh, 0);
+	addToRunTimeSelectionTable
+	(
+		dynamicFvMesh,
+		dynamicLoadBalanceFvMesh,
+		IOobject
+	);
+}
+
+
+// * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * * //
+
+tnbLib::tmp<tnbLib::scalarField>
+tnbLib::dynamicLoadBalanceFvMesh::cellWeights() const
+{
+	tmp<scalarField> tweights(new scalarField(nCells(), 1.0));
+	scalarField& weights = tweights.ref();
+
+	// Parcels of all the clouds
+	if (parcelWeight_ > 0)
+	{
+		labelList nParcels(nCells(), 0);
+
+		HashTable<const cloud*> clouds(lookupClass<cloud>());
+
+		forAllConstIter(HashTable<const cloud*>, clouds, iter)
+		{
+			iter()->countParticles(nParcels);
+		}
+
+		forAll(weights, celli)
+		{
+			weights[celli] += parcelWeight_*nParcels[celli];
+		}
+	}
+
+	// Chemistry sub-steps estimated from the chemical time steps of the
+	// chemistry models of all the phases
+	if (chemistryWeight_ > 0)
+	{
+		const scalar deltaT = time().deltaTValue();
+
+		const wordList names
+		(
+			this->names<volScalarField::Internal>
+			(
+				wordRe("deltaTChem.*", wordRe::compOption::regExp)
+			)
+		);
+
+		forAll(names, i)
+		{
+			const scalarField& deltaTChem =
+				lookupObject<volScalarField::Internal>(names[i]);
+
+			forAll(weights, celli)
+			{
+				weights[celli] +=
+					chemistryWeight_*deltaT
+				   /max(deltaTChem[celli], small*deltaT);
+			}
+		}
+	}
+
+	return tweights;
+}
+
+
+tnbLib::scalar tnbLib::dynamicLoadBalanceFvMesh::imbalance
+(
+	const scalarField& cellWeights
+)
+{
+	const scalar cost = sum(cellWeights);
+
+	const scalar maxCost = returnReduce(cost, maxOp<scalar>());
+	const scalar avgCost =
+		returnReduce(cost, sumOp<scalar>())/Pstream::nProcs();
+
+	return maxCost/max(avgCost, vSmall) - 1;
+}
+
+
+void tnbLib::dynamicLoadBalanceFvMesh::distribute
+(
+	const labelList& distribution
+)
+{
+	// Hold back the particles of the clouds
+	HashTable<cloud*> clouds(lookupClass<cloud>());
+
+	forAllIter(HashTable<cloud*>, clouds, iter)
+	{
+		iter()->beginDistribute();
+	}
+
+	// Store the volume internal fields as volume fields which are
+	// distributed with the mesh
+	PtrList<volScalarField> vsFlds;
+	storeInternalFields(vsFlds);
+	PtrList<volVectorField> vvFlds;
+	storeInternalFields(vvFlds);
+	PtrList<volSphericalTensorField> vsptFlds;
+	storeInternalFields(vsptFlds);
+	PtrList<volSymmTensorField> vsytFlds;
+	storeInternalFields(vsytFlds);
+	PtrList<volTensorField> vtFlds;
+	storeInternalFields(vtFlds);
+
+	fvMeshDistribute distributor(*this, mergeTol_*bounds().mag());
+
+	const autoPtr<mapDistributePolyMesh> map
+	(
+		distributor.distribute(distribution)
+	);
+
+	restoreInternalFields(vsFlds);
+	restoreInternalFields(vvFlds);
+	restoreInternalFields(vsptFlds);
+	restoreInternalFields(vsytFlds);
+	restoreInternalFields(vtFlds);
+
+	// Send the particles to the processors of their cells
+	forAllIter(HashTable<cloud*>, clouds, iter)
+	{
+		iter()->distribute(map());
+	}
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+tnbLib::dynamicLoadBalanceFvMesh::dynamicLoadBalanceFvMesh(const IOobject& io)
+	:
+	dynamicFvMesh(io),
+	decompositionDict_(dynamicMeshDict().optionalSubDict(typeName + "Coeffs")),
+	balanceInterval_
+	(
+		decompositionDict_.lookupOrDefault<label>("balanceInterval", 10)
+	),
+	maxImbalance_
+	(
+		decompositionDict_.lookupOrDefault<scalar>("maxImbalance", 0.2)
+	),
+	parcelWeight_
+	(
+		decompositionDict_.lookupOrDefault<scalar>("parcelWeight", 1)
+	),
+	chemistryWeight_
+	(
+		decompositionDict_.lookupOrDefault<scalar>("chemistryWeight", 0)
+	),
+	mergeTol_(decompositionDict_.lookupOrDefault<scalar>("mergeTol", 1e-6))
+{
+	if (balanceInterval_ < 1)
+	{
+		FatalIOErrorInFunction(decompositionDict_)
+			<< "Illegal balanceInterval " << balanceInterval_ << nl
+			<< "The balanceInterval setting in the dynamicMeshDict should"
+			<< " be >= 1." << nl
+			<< exit(FatalIOError);
+	}
+
+	decompositionDict_.set("numberOfSubdomains", Pstream::nProcs());
+
+	decomposer_.reset(decompositionMethod::New(decompositionDict_).ptr());
+
+	if (Pstream::parRun() && !decomposer_().parallelAware())
+	{
+		FatalIOErrorInFunction(decompositionDict_)
+			<< "Decomposition method "
+			<< word(decompositionDict_.lookup("method"))
+			<< " is not parallel aware" << nl
+			<< "A parallel aware method, e.g. ptscotch or hierarchical,"
+			<< " is required to redistribute the mesh"
+			<< exit(FatalIOError);
+	}
+}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+tnbLib::dynamicLoadBalanceFvMesh::~dynamicLoadBalanceFvMesh()
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+tnbLib::scalar tnbLib::dynamicLoadBalanceFvMesh::imbalance() const
+{
+	return imbalance(cellWeights());
+}
+
+
+bool tnbLib::dynamicLoadBalanceFvMesh::update()
+{
+	if
+	(
+		!Pstream::parRun()
+	 || time().timeIndex() == 0
+	 || time().timeIndex() % balanceInterval_ != 0
+	)
+	{
+		return false;
+	}
+
+	const scalarField weights(cellWeights());
+	const scalar oldImbalance = imbalance(weights);
+
+	if (oldImbalance <= maxImbalance_)
+	{
+		if (debug)
+		{
+			Info << typeName << " : imbalance " << oldImbalance << endl;
+		}
+
+		return false;
+	}
+
+	const labelList distribution(decomposer_().decompose(*this, weights));
+
+	distribute(distribution);
+
+	Info << typeName << " : redistributed the mesh, imbalance "
+		<< oldImbalance << " -> " << imbalance() << nl << endl;
+
+	return true;
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,191 @@
+#pragma once
+#ifndef _dynamicLoadBalanceFvMesh_Header
+#define _dynamicLoadBalanceFvMesh_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+	tnbLib::dynamicLoadBalanceFvMesh
+
+Description
+	A fvMesh which redistributes itself between the processors of a
+	parallel run when the computational load becomes unbalanced.
+
+	The cost of every cell is estimated as one plus the number of parcels
+	of all the clouds in the cell times parcelWeight plus, if a chemistry
+	model is present, the number of chemistry sub-steps estimated from its
+	deltaTChem field times chemistryWeight. Every balanceInterval time steps
+	the imbalance, the maximum over the average processor cost minus one,
+	is evaluated and if it exceeds maxImbalance the mesh is decomposed with
+	these cell weights by the given decompositionMethod, which has to be
+	parallel aware, and distributed by fvMeshDistribute.
+
+	The volume and surface fields are distributed with the mesh, the
+	volume internal fields (e.g. the cloud source terms) are distributed as
+	volume fields, and the particles of the clouds are held back during the
+	distribution and sent to the processors of their cells afterwards.
+
+	Example of the dynamicMeshDict specification:
+	\verbatim
+	dynamicFvMesh   dynamicLoadBalanceFvMesh;
+
+	dynamicLoadBalanceFvMeshCoeffs
+	{
+		balanceInterval 10;
+		maxImbalance    0.2;
+		parcelWeight    1;
+		chemistryWeight 0;
+
+		method          ptscotch;
+	}
+	\endverbatim
+
+SourceFiles
+	dynamicLoadBalanceFvMesh.cxx
+
+\*---------------------------------------------------------------------------*/
+
+#include <dynamicFvMesh.hxx>
+#include <decompositionMethod.hxx>
+#include <volFields.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	/*---------------------------------------------------------------------------*\
+					  Class dynamicLoadBalanceFvMesh Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class dynamicLoadBalanceFvMesh
+		:
+		public dynamicFvMesh
+	{
+		// Private Data
+
+			//- Decomposition dictionary, the coefficients dictionary with the
+			//  number of processors. Kept for the decomposition method which
+			//  holds a reference to it.
+		dictionary decompositionDict_;
+
+		//- Number of time steps between the evaluations of the imbalance
+		label balanceInterval_;
+
+		//- Imbalance above which the mesh is redistributed
+		scalar maxImbalance_;
+
+		//- Cost of a parcel relative to that of a cell
+		scalar parcelWeight_;
+
+		//- Cost of a chemistry sub-step relative to that of a cell
+		scalar chemistryWeight_;
+
+		//- Tolerance for merging the points of the processors relative to
+		//  the size of the mesh
+		scalar mergeTol_;
+
+		//- Decomposition method
+		autoPtr<decompositionMethod> decomposer_;
+
+
+		// Private Member Functions
+
+			//- Return the estimated cost of the cells
+		tmp<scalarField> cellWeights() const;
+
+		//- Return the imbalance of the processor costs for the given cell
+		//  costs
+		static scalar imbalance(const scalarField& cellWeights);
+
+		//- Store the volume internal fields of the given type as
+		//  registered volume fields so that they are distributed
+		template<class Type>
+		void storeInternalFields
+		(
+			PtrList<GeometricField<Type, fvPatchField, volMesh>>& flds
+		) const;
+
+		//- Copy the distributed volume fields back into the volume internal
+		//  fields
+		template<class Type>
+		void restoreInternalFields
+		(
+			PtrList<GeometricField<Type, fvPatchField, volMesh>>& flds
+		);
+
+		//- Distribute the mesh, fields and clouds
+		void distribute(const labelList& distribution);
+
+
+	public:
+
+		//- Runtime type information
+		//TypeName("dynamicLoadBalanceFvMesh");
+		static const char* typeName_() { return "dynamicLoadBalanceFvMesh"; }
+		static FoamParallel_EXPORT const ::tnbLib::word typeName;
+		static FoamParallel_EXPORT int debug;
+		virtual const word& type() const { return typeName; };
+
+
+		// Constructors
+
+			//- Construct from IOobject
+		FoamParallel_EXPORT explicit dynamicLoadBalanceFvMesh(const IOobject& io);
+
+		//- Disallow default bitwise copy construction
+		FoamParallel_EXPORT dynamicLoadBalanceFvMesh(const dynamicLoadBalanceFvMesh&) = delete;
+
+
+		//- Destructor
+		FoamParallel_EXPORT virtual ~dynamicLoadBalanceFvMesh();
+
+
+		// Member Functions
+
+			//- Return the imbalance of the processor costs
+		FoamParallel_EXPORT scalar imbalance() const;
+
+		//- Redistribute the mesh if the imbalance exceeds maxImbalance
+		FoamParallel_EXPORT virtual bool update();
+
+
+		// Member Operators
+
+			//- Disallow default bitwise assignment
+		void operator=(const dynamicLoadBalanceFvMesh&) = delete;
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#include <dynamicLoadBalanceFvMeshI.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_dynamicLoadBalanceFvMesh_Header
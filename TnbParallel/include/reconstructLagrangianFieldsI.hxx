@@ -2,6 +2,7 @@
 #include <IOField.hxx>
 #include <CompactIOField.hxx>
 #include <Time.hxx>
+#include <cloudColumns.hxx>
 
 // * * * * * * * * * * * * * * * Global Functions  * * * * * * * * * * * * * //
 
@@ -46,9 +47,38 @@ tnbLib::tmp<tnbLib::IOField<Type>> tnbLib::reconstructLagrangianField
 			IOobject::NO_WRITE
 		);
 
+		tmp<Field<Type>> tfieldi;
+
 		if (localIOobject.typeHeaderOk<IOField<Type>>(true))
 		{
-			IOField<Type> fieldi(localIOobject);
+			tfieldi = new IOField<Type>(localIOobject);
+		}
+		else
+		{
+			// The field may be held in the columns file of the processor
+			cloudColumns columns
+			(
+				IOobject
+				(
+					cloudColumns::typeName,
+					meshes[i].time().timeName(),
+					cloud::prefix / cloudName,
+					meshes[i],
+					IOobject::READ_IF_PRESENT,
+					IOobject::NO_WRITE,
+					false
+				)
+			);
+
+			if (columns.found(fieldName))
+			{
+				tfieldi = columns.readColumn<Type>(fieldName);
+			}
+		}
+
+		if (tfieldi.valid())
+		{
+			const Field<Type>& fieldi = tfieldi();
 
 			label offset = field.size();
 			field.setSize(offset + fieldi.size());
@@ -144,28 +174,37 @@ void tnbLib::reconstructLagrangianFields
 {
 	const word fieldClassName(IOField<Type>::typeName);
 
-	IOobjectList fields = objects.lookupClass(fieldClassName);
+	// Fields in files of their own and in the columns file
+	wordList fieldNames(objects.names(fieldClassName));
+	{
+		autoPtr<cloudColumns> columnsPtr(cloudColumns::New(objects));
+
+		if (columnsPtr.valid())
+		{
+			fieldNames.append(columnsPtr->columnNames<Type>(objects));
+		}
+	}
 
-	if (fields.size())
+	if (fieldNames.size())
 	{
 		Info << "    Reconstructing lagrangian "
 			<< fieldClassName << "s\n" << endl;
 
-		forAllConstIter(IOobjectList, fields, fieldIter)
+		forAll(fieldNames, fieldi)
 		{
 			if
 				(
 					selectedFields.empty()
-					|| selectedFields.found(fieldIter()->name())
+					|| selectedFields.found(fieldNames[fieldi])
 					)
 			{
-				Info << "        " << fieldIter()->name() << endl;
+				Info << "        " << fieldNames[fieldi] << endl;
 				reconstructLagrangianField<Type>
 					(
 						cloudName,
 						mesh,
 						meshes,
-						fieldIter()->name()
+						fieldNames[fieldi]
 						)().write();
 			}
 		}
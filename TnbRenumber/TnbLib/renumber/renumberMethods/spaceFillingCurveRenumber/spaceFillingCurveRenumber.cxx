@@ -0,0 +1,96 @@
+#include <spaceFillingCurveRenumber.hxx>
+
+#include <addToRunTimeSelectionTable.hxx>
+#include <spaceFillingCurve.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+	defineTypeNameAndDebug(spaceFillingCurveRenumber, 0);
+
+	addToRunTimeSelectionTable
+	(
+		renumberMethod,
+		spaceFillingCurveRenumber,
+		dictionary
+	);
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+tnbLib::spaceFillingCurveRenumber::spaceFillingCurveRenumber
+(
+	const dictionary& renumberDict
+)
+	:
+	renumberMethod(renumberDict),
+	curve_
+	(
+		renumberDict.optionalSubDict
+		(
+			typeName + "Coeffs"
+		).lookupOrDefault<word>("curve", "hilbert")
+	),
+	reverse_
+	(
+		renumberDict.optionalSubDict
+		(
+			typeName + "Coeffs"
+		).lookupOrDefault<Switch>("reverse", false)
+	)
+{
+	if (curve_ != "hilbert" && curve_ != "morton")
+	{
+		FatalIOErrorInFunction(renumberDict)
+			<< "Unknown curve " << curve_ << nl
+			<< "Valid curves are :" << nl
+			<< "(hilbert morton)"
+			<< exit(FatalIOError);
+	}
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+tnbLib::labelList tnbLib::spaceFillingCurveRenumber::renumber
+(
+	const pointField& points
+) const
+{
+	labelList orderedToOld
+	(
+		curve_ == "hilbert" ? hilbertOrder(points) : mortonOrder(points)
+	);
+
+	if (reverse_)
+	{
+		reverse(orderedToOld);
+	}
+
+	return orderedToOld;
+}
+
+
+tnbLib::labelList tnbLib::spaceFillingCurveRenumber::renumber
+(
+	const polyMesh& mesh,
+	const pointField& points
+) const
+{
+	return renumber(points);
+}
+
+
+tnbLib::labelList tnbLib::spaceFillingCurveRenumber::renumber
+(
+	const labelListList& cellCells,
+	const pointField& points
+) const
+{
+	return renumber(points);
+}
+
+
+// ************************************************************************* //
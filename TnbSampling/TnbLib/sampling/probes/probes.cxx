@@ -8,6 +8,7 @@
 #include <addToRunTimeSelectionTable.hxx>
 
 #include <PstreamReduceOps.hxx>  // added by amir
+#include <PstreamCombineReduceOps.hxx>
 
 // * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
 
@@ -39,13 +40,18 @@ void tnbLib::probes::findElements(const fvMesh& mesh)
 	faceList_.clear();
 	faceList_.setSize(size());
 
+	// Locate all the probes with the cell tree at once
+	{
+		labelList tetFaces;
+		labelList tetPts;
+		mesh.findCells(*this, elementList_, tetFaces, tetPts);
+	}
+
 	forAll(*this, probei)
 	{
 		const vector& location = operator[](probei);
 
-		const label celli = mesh.findCell(location);
-
-		elementList_[probei] = celli;
+		const label celli = elementList_[probei];
 
 		if (celli != -1)
 		{
@@ -79,16 +85,22 @@ void tnbLib::probes::findElements(const fvMesh& mesh)
 	}
 
 
+	// Check at least one processor with cell, reducing all the probes at
+	// once
+	labelList maxCells(elementList_);
+	Pstream::listCombineGather(maxCells, maxEqOp<label>());
+	Pstream::listCombineScatter(maxCells);
+
+	labelList maxFaces(faceList_);
+	Pstream::listCombineGather(maxFaces, maxEqOp<label>());
+	Pstream::listCombineScatter(maxFaces);
+
 	// Check if all probes have been found.
 	forAll(elementList_, probei)
 	{
 		const vector& location = operator[](probei);
-		label celli = elementList_[probei];
-		label facei = faceList_[probei];
-
-		// Check at least one processor with cell.
-		reduce(celli, maxOp<label>());
-		reduce(facei, maxOp<label>());
+		const label celli = maxCells[probei];
+		const label facei = maxFaces[probei];
 
 		if (celli == -1)
 		{
@@ -29,6 +29,9 @@ void tnbLib::sampledSets::boxUniform::calcSamples
 	DynamicList<scalar>& samplingCurveDist
 ) const
 {
+	pointField pts(cmptProduct(nPoints_));
+	label pti = 0;
+
 	for (label k = 0; k < nPoints_.z(); ++k)
 	{
 		for (label j = 0; j < nPoints_.y(); ++j)
@@ -38,11 +41,24 @@ void tnbLib::sampledSets::boxUniform::calcSamples
 				const vector t =
 					cmptDivide(vector(i, j, k), vector(nPoints_) - vector::one);
 
-				const point pt =
+				pts[pti++] =
 					cmptMultiply(vector::one - t, box_.min())
 					+ cmptMultiply(t, box_.max());
+			}
+		}
+	}
+
+	const labelList cells(searchEngine().findCells(pts));
+	pti = 0;
 
-				const label celli = searchEngine().findCell(pt);
+	for (label k = 0; k < nPoints_.z(); ++k)
+	{
+		for (label j = 0; j < nPoints_.y(); ++j)
+		{
+			for (label i = 0; i < nPoints_.x(); ++i)
+			{
+				const point& pt = pts[pti];
+				const label celli = cells[pti++];
 
 				if (celli != -1)
 				{
@@ -27,10 +27,12 @@ void tnbLib::sampledSets::points::calcSamplesUnordered
 	DynamicList<scalar>& samplingCurveDist
 ) const
 {
+	const labelList cells(searchEngine().findCells(points_));
+
 	forAll(points_, i)
 	{
 		const point& pt = points_[i];
-		const label celli = searchEngine().findCell(pt);
+		const label celli = cells[i];
 
 		if (celli != -1)
 		{
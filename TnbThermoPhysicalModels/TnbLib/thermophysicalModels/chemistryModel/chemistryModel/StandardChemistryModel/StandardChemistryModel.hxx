@@ -33,6 +33,52 @@ Description
 	Introduces chemistry equation system and evaluation of chemical source
 	terms.
 
+	The rates of change of the concentrations are evaluated by a
+	reactionKernel from tables of the rates of the reactions built on
+	construction.
+
+	With more than one thread (threadLoop nThreads optimisation switch) the
+	cells are integrated concurrently, each thread taking the next block of
+	cells when it is free so that the variation of the stiffness between
+	the cells is balanced. Every thread has its own concentration work
+	arrays and the chemistry solver its own per-thread state, see
+	setNThreads, and the integration of a cell does not depend on the
+	cells integrated before it so the results are independent of the
+	number of threads.
+
+	With load balancing the clock time of the integration of every cell is
+	measured and, if the imbalance of the processor costs of the last solve
+	exceeds maxImbalance, the most expensive cells of the overloaded
+	processors are integrated by the underloaded ones: the concentrations,
+	temperature, pressure, time step and chemical time step of these cells
+	are sent to them, integrated together with their own cells and the
+	resulting concentrations, chemical time steps and costs returned. The
+	cells are assigned in processor order so that every processor arrives
+	at the same plan, independently of the mesh decomposition.
+
+	\verbatim
+	loadBalancing
+	{
+		active          on;
+		maxImbalance    0.1;
+	}
+	\endverbatim
+
+	With clustering only one representative cell of every group of cells of
+	similar temperature, pressure, time step and composition is integrated
+	and its change of composition is applied to the other cells of the
+	group, see chemistryClustering.
+
+	\verbatim
+	clustering
+	{
+		active          on;
+		TTolerance      1;
+		pTolerance      1e-3;
+		YTolerance      1e-4;
+	}
+	\endverbatim
+
 SourceFiles
 	StandardChemistryModelI.H
 	StandardChemistryModel.C
@@ -41,9 +87,12 @@ SourceFiles
 
 #include <BasicChemistryModelTemplate.hxx>
 #include <Reaction.hxx>
+#include <reactionKernel.hxx>
+#include <chemistryClustering.hxx>
 #include <ODESystem.hxx>
 #include <volFields.hxx>
 #include <simpleMatrix.hxx>
+#include <threadLoop.hxx>
 
 #ifdef FoamThermophysicalModels_EXPORT_DEFINE
 #define FoamStandardChemistryModel_EXPORT __declspec(dllexport)
@@ -75,8 +124,23 @@ namespace tnbLib
 	{
 		// Private Member Functions
 
-			//- Solve the reaction system for the given time step
-			//  of given type and return the characteristic time
+			//- Integrate the concentrations, temperature and pressure of a
+			//  cell over the time step
+		void integrate
+		(
+			scalarField& c,
+			scalar& T,
+			scalar& p,
+			const scalar deltaT,
+			scalar& deltaTChem
+		) const;
+
+		//- Return the cells to send to each processor for integration to
+		//  balance the processor costs of the last solve
+		labelListList balanceCells() const;
+
+		//- Solve the reaction system for the given time step
+		//  of given type and return the characteristic time
 		template<class DeltaTType>
 		scalar solve(const DeltaTType& deltaT);
 
@@ -115,6 +179,27 @@ namespace tnbLib
 		//- Temporary rate-of-change of concentration field
 		mutable scalarField dcdt_;
 
+		//- Temporary concentration fields of the threads other than the
+		//  first
+		mutable PtrList<scalarField> threadC_;
+
+		//- Rate tables of the reactions for the evaluation of omega
+		reactionKernel<ThermoType> reactionKernel_;
+
+		//- Distribute the integration of the cells between the processors
+		//  by their cost
+		Switch loadBalancing_;
+
+		//- Imbalance of the processor costs above which cells are
+		//  integrated by other processors
+		scalar maxImbalance_;
+
+		//- Clock time of the integration of the cells in the last solve
+		scalarField cellCost_;
+
+		//- Clustering of the cells of similar thermochemical state
+		chemistryClustering clustering_;
+
 
 		// Protected Member Functions
 
@@ -122,6 +207,15 @@ namespace tnbLib
 			//  (e.g. for multi-chemistry model)
 		inline PtrList<volScalarField::Internal>& RR();
 
+		//- Return the temporary concentration field of the calling thread
+		inline scalarField& threadC() const;
+
+		//- Construct the per-thread data of the chemistry solver for
+		//  solving the cells on the given number of threads. Returns false
+		//  if the cells cannot be solved concurrently. Chemistry solvers
+		//  with state of their own override this.
+		virtual bool setNThreads(const label nThreads) const;
+
 
 	public:
 
@@ -253,6 +347,10 @@ namespace tnbLib
 			scalarSquareMatrix& J
 		) const;
 
+		//- Return the pattern of the Jacobian from the species of the
+		//  reactions and their third-body efficiencies
+		virtual labelListList jacobianPattern() const;
+
 		virtual void solve
 		(
 			scalarField &c,
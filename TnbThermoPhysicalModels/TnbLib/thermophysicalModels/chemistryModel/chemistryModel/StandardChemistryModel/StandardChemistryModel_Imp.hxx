@@ -2,6 +2,8 @@
 #include <reactingMixture.hxx>
 #include <UniformField.hxx>
 #include <extrapolatedCalculatedFvPatchFields.hxx>
+#include <PstreamBuffers.hxx>
+#include <clockTime.hxx>
 
 // * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
 
@@ -36,7 +38,27 @@ tnbLib::StandardChemistryModel<ReactionThermo, ThermoType>::StandardChemistryMod
 	),
 	RR_(nSpecie_),
 	c_(nSpecie_),
-	dcdt_(nSpecie_)
+	dcdt_(nSpecie_),
+	threadC_(),
+	reactionKernel_(reactions_),
+	loadBalancing_
+	(
+		this->subOrEmptyDict("loadBalancing").lookupOrDefault
+		(
+			"active",
+			Switch(false)
+		)
+	),
+	maxImbalance_
+	(
+		this->subOrEmptyDict("loadBalancing").lookupOrDefault
+		(
+			"maxImbalance",
+			0.1
+		)
+	),
+	cellCost_(this->mesh().nCells(), 0),
+	clustering_(this->subOrEmptyDict("clustering"))
 {
 	// Create the fields for the chemistry sources
 	forAll(RR_, fieldi)
@@ -62,6 +84,159 @@ tnbLib::StandardChemistryModel<ReactionThermo, ThermoType>::StandardChemistryMod
 
 	Info << "StandardChemistryModel: Number of species = " << nSpecie_
 		<< " and reactions = " << nReaction_ << endl;
+
+	if (loadBalancing_)
+	{
+		Info << "    load balancing with maxImbalance " << maxImbalance_
+			<< endl;
+	}
+
+	if (clustering_.active())
+	{
+		Info << "    clustering of the cells" << endl;
+	}
+}
+
+
+// * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * * //
+
+template<class ReactionThermo, class ThermoType>
+void tnbLib::StandardChemistryModel<ReactionThermo, ThermoType>::integrate
+(
+	scalarField& c,
+	scalar& T,
+	scalar& p,
+	const scalar deltaT,
+	scalar& deltaTChem
+) const
+{
+	// Initialise time progress
+	scalar timeLeft = deltaT;
+
+	// Calculate the chemical source terms
+	while (timeLeft > small)
+	{
+		scalar dt = timeLeft;
+		this->solve(c, T, p, dt, deltaTChem);
+		timeLeft -= dt;
+	}
+}
+
+
+template<class ReactionThermo, class ThermoType>
+tnbLib::labelListList
+tnbLib::StandardChemistryModel<ReactionThermo, ThermoType>::balanceCells() const
+{
+	const label nProcs = Pstream::nProcs();
+	const label myProci = Pstream::myProcNo();
+
+	labelListList sendCells(nProcs);
+
+	scalarList procCost(nProcs, scalar(0));
+	procCost[myProci] = sum(cellCost_);
+
+	Pstream::gatherList(procCost);
+	Pstream::scatterList(procCost);
+
+	const scalar avgCost = sum(procCost)/nProcs;
+
+	if (avgCost <= 0 || max(procCost)/avgCost - 1 <= maxImbalance_)
+	{
+		return sendCells;
+	}
+
+	// Match the excess cost of the overloaded processors to the deficit of
+	// the underloaded ones in processor order. Every step zeroes the excess
+	// of one of the pair so the matching terminates.
+	scalarList excess(nProcs);
+	forAll(excess, proci)
+	{
+		excess[proci] = procCost[proci] - avgCost;
+	}
+
+	scalarList sendCost(nProcs, scalar(0));
+
+	label proci = 0;
+	label procj = 0;
+
+	while (true)
+	{
+		while (proci < nProcs && excess[proci] <= 0)
+		{
+			proci++;
+		}
+		while (procj < nProcs && excess[procj] >= 0)
+		{
+			procj++;
+		}
+
+		if (proci == nProcs || procj == nProcs)
+		{
+			break;
+		}
+
+		const scalar cost = min(excess[proci], -excess[procj]);
+
+		if (proci == myProci)
+		{
+			sendCost[procj] += cost;
+		}
+
+		excess[proci] -= cost;
+		excess[procj] += cost;
+	}
+
+	// Send the most expensive cells first so that few cells are sent,
+	// without exceeding the cost to send to each processor
+	labelList order;
+	sortedOrder(cellCost_, order, typename UList<scalar>::greater(cellCost_));
+
+	boolList sent(cellCost_.size(), false);
+
+	forAll(sendCost, procj)
+	{
+		if (sendCost[procj] <= 0)
+		{
+			continue;
+		}
+
+		DynamicList<label> cells;
+		scalar cost = 0;
+
+		forAll(order, i)
+		{
+			const label celli = order[i];
+
+			if
+			(
+				!sent[celli]
+			 && cellCost_[celli] > 0
+			 && cost + cellCost_[celli] <= sendCost[procj]
+			)
+			{
+				cells.append(celli);
+				sent[celli] = true;
+				cost += cellCost_[celli];
+			}
+		}
+
+		sendCells[procj].transfer(cells);
+	}
+
+	if (debug)
+	{
+		label nSent = 0;
+		forAll(sendCells, procj)
+		{
+			nSent += sendCells[procj].size();
+		}
+
+		Pout << "StandardChemistryModel::balanceCells : cost "
+			<< procCost[myProci] << " of average " << avgCost
+			<< ", sending " << nSent << " cells" << endl;
+	}
+
+	return sendCells;
 }
 
 
@@ -87,12 +262,7 @@ void tnbLib::StandardChemistryModel<ReactionThermo, ThermoType>::omega
 
 	dcdt = Zero;
 
-	forAll(reactions_, i)
-	{
-		const Reaction<ThermoType>& R = reactions_[i];
-
-		R.omega(p, T, c, dcdt);
-	}
+	reactionKernel_.omega(p, T, c, dcdt);
 }
 
 
@@ -128,12 +298,14 @@ void tnbLib::StandardChemistryModel<ReactionThermo, ThermoType>::derivatives
 	const scalar T = c[nSpecie_];
 	const scalar p = c[nSpecie_ + 1];
 
-	forAll(c_, i)
+	scalarField& c0 = threadC();
+
+	forAll(c0, i)
 	{
-		c_[i] = max(c[i], 0);
+		c0[i] = max(c[i], 0);
 	}
 
-	omega(c_, T, p, dcdt);
+	omega(c0, T, p, dcdt);
 
 	// Constant pressure
 	// dT/dt = ...
@@ -142,13 +314,13 @@ void tnbLib::StandardChemistryModel<ReactionThermo, ThermoType>::derivatives
 	for (label i = 0; i < nSpecie_; i++)
 	{
 		const scalar W = specieThermo_[i].W();
-		cSum += c_[i];
-		rho += W * c_[i];
+		cSum += c0[i];
+		rho += W * c0[i];
 	}
 	scalar cp = 0;
 	for (label i = 0; i < nSpecie_; i++)
 	{
-		cp += c_[i] * specieThermo_[i].cp(p, T);
+		cp += c0[i] * specieThermo_[i].cp(p, T);
 	}
 	cp /= rho;
 
@@ -179,9 +351,11 @@ void tnbLib::StandardChemistryModel<ReactionThermo, ThermoType>::jacobian
 	const scalar T = c[nSpecie_];
 	const scalar p = c[nSpecie_ + 1];
 
-	forAll(c_, i)
+	scalarField& c0 = threadC();
+
+	forAll(c0, i)
 	{
-		c_[i] = max(c[i], 0);
+		c0[i] = max(c[i], 0);
 	}
 
 	J = Zero;
@@ -202,8 +376,8 @@ void tnbLib::StandardChemistryModel<ReactionThermo, ThermoType>::jacobian
 	{
 		const Reaction<ThermoType>& R = reactions_[ri];
 		scalar kfwd, kbwd;
-		R.dwdc(p, T, c_, J, dcdt, omegaI, kfwd, kbwd, false, dummy);
-		R.dwdT(p, T, c_, omegaI, kfwd, kbwd, J, false, dummy, nSpecie_);
+		R.dwdc(p, T, c0, J, dcdt, omegaI, kfwd, kbwd, false, dummy);
+		R.dwdT(p, T, c0, omegaI, kfwd, kbwd, J, false, dummy, nSpecie_);
 	}
 
 	// The species derivatives of the temperature term are partially computed
@@ -212,8 +386,8 @@ void tnbLib::StandardChemistryModel<ReactionThermo, ThermoType>::jacobian
 	scalar dcpdTMean = 0;
 	for (label i = 0; i < nSpecie_; i++)
 	{
-		cpMean += c_[i] * cpi[i]; // J/(m^3 K)
-		dcpdTMean += c_[i] * specieThermo_[i].dcpdT(p, T);
+		cpMean += c0[i] * cpi[i]; // J/(m^3 K)
+		dcpdTMean += c0[i] * specieThermo_[i].dcpdT(p, T);
 	}
 	scalar dTdt = 0.0;
 	for (label i = 0; i < nSpecie_; i++)
@@ -245,6 +419,59 @@ void tnbLib::StandardChemistryModel<ReactionThermo, ThermoType>::jacobian
 }
 
 
+template<class ReactionThermo, class ThermoType>
+tnbLib::labelListList
+tnbLib::StandardChemistryModel<ReactionThermo, ThermoType>::jacobianPattern() const
+{
+	List<labelHashSet> columns(nEqns());
+
+	forAll(reactions_, ri)
+	{
+		const Reaction<ThermoType>& R = reactions_[ri];
+
+		// The rates of the species of the reaction depend on these species,
+		// on the third-bodies and on the temperature
+		labelHashSet rows;
+		forAll(R.lhs(), i)
+		{
+			rows.insert(R.lhs()[i].index);
+		}
+		forAll(R.rhs(), i)
+		{
+			rows.insert(R.rhs()[i].index);
+		}
+
+		labelHashSet rowColumns(rows);
+		rowColumns.insert(nSpecie_);
+
+		const List<Tuple2<label, scalar>>& beta = R.beta();
+		if (notNull(beta))
+		{
+			forAll(beta, j)
+			{
+				rowColumns.insert(beta[j].first());
+			}
+		}
+
+		forAllConstIter(labelHashSet, rows, iter)
+		{
+			columns[iter.key()] |= rowColumns;
+		}
+	}
+
+	// The temperature depends on all the species and the pressure is fixed
+	columns[nSpecie_] = labelHashSet(identity(nSpecie_ + 1));
+
+	labelListList pattern(columns.size());
+	forAll(columns, i)
+	{
+		pattern[i] = columns[i].sortedToc();
+	}
+
+	return pattern;
+}
+
+
 template<class ReactionThermo, class ThermoType>
 tnbLib::tmp<tnbLib::volScalarField>
 tnbLib::StandardChemistryModel<ReactionThermo, ThermoType>::tc() const
@@ -446,6 +673,16 @@ void tnbLib::StandardChemistryModel<ReactionThermo, ThermoType>::calculate()
 }
 
 
+template<class ReactionThermo, class ThermoType>
+bool tnbLib::StandardChemistryModel<ReactionThermo, ThermoType>::setNThreads
+(
+	const label
+) const
+{
+	return true;
+}
+
+
 template<class ReactionThermo, class ThermoType>
 template<class DeltaTType>
 tnbLib::scalar tnbLib::StandardChemistryModel<ReactionThermo, ThermoType>::solve
@@ -468,55 +705,347 @@ tnbLib::scalar tnbLib::StandardChemistryModel<ReactionThermo, ThermoType>::solve
 	const scalarField& T = this->thermo().T();
 	const scalarField& p = this->thermo().p();
 
-	scalarField c0(nSpecie_);
+	if (cellCost_.size() != rho.size())
+	{
+		cellCost_.setSize(rho.size());
+		cellCost_ = 0;
+	}
 
-	forAll(rho, celli)
+	// Only the representatives of the clusters of cells are integrated
+	if (clustering_.active())
 	{
-		scalar Ti = T[celli];
+		clustering_.cluster(Y_, T, p, deltaT);
+	}
+
+	// States (concentrations, T, p, deltaT and deltaTChem) of the cells
+	// sent and received for integration and results (concentrations,
+	// deltaTChem and cost) of the cells returned
+	const label nState = nSpecie_ + 4;
+	const label nResult = nSpecie_ + 2;
+
+	const bool balance = loadBalancing_ && Pstream::parRun();
+
+	const label nProcs = Pstream::nProcs();
+
+	labelListList sendCells(nProcs);
 
-		if (Ti > Treact_)
+	if (balance)
+	{
+		sendCells = balanceCells();
+
+		// The costs are those of the previous step so cells which have
+		// since cooled below Treact or are no longer cluster
+		// representatives are kept here, where they are not integrated
+		forAll(sendCells, proci)
 		{
-			const scalar rhoi = rho[celli];
-			scalar pi = p[celli];
+			labelList& cells = sendCells[proci];
 
-			for (label i = 0; i < nSpecie_; i++)
+			label n = 0;
+			forAll(cells, i)
 			{
-				c_[i] = rhoi * Y_[i][celli] / specieThermo_[i].W();
-				c0[i] = c_[i];
+				const label celli = cells[i];
+
+				if (T[celli] > Treact_ && clustering_.integrated(celli))
+				{
+					cells[n++] = celli;
+				}
 			}
+			cells.setSize(n);
+		}
+	}
 
-			// Initialise time progress
-			scalar timeLeft = deltaT[celli];
+	// Cells integrated here
+	labelList localCells(rho.size());
+	{
+		boolList sent(rho.size(), false);
+		forAll(sendCells, proci)
+		{
+			UIndirectList<bool>(sent, sendCells[proci]) = true;
+		}
 
-			// Calculate the chemical source terms
-			while (timeLeft > small)
+		label nLocal = 0;
+		forAll(sent, celli)
+		{
+			if (!sent[celli] && clustering_.integrated(celli))
 			{
-				scalar dt = timeLeft;
-				this->solve(c_, Ti, pi, dt, this->deltaTChem_[celli]);
-				timeLeft -= dt;
+				localCells[nLocal++] = celli;
 			}
+		}
+		localCells.setSize(nLocal);
+	}
 
-			deltaTMin = min(this->deltaTChem_[celli], deltaTMin);
+	// Send the states of the cells to be integrated elsewhere and collect
+	// the states of the cells to be integrated here
+	scalarField recvStates;
+	labelList recvStart(nProcs + 1, 0);
 
-			this->deltaTChem_[celli] =
-				min(this->deltaTChem_[celli], this->deltaTChemMax_);
+	if (balance)
+	{
+		PstreamBuffers pBufs(Pstream::commsTypes::nonBlocking);
 
-			for (label i = 0; i < nSpecie_; i++)
+		forAll(sendCells, proci)
+		{
+			const labelList& cells = sendCells[proci];
+
+			if (cells.empty())
+			{
+				continue;
+			}
+
+			scalarField states(nState*cells.size());
+
+			forAll(cells, i)
 			{
-				RR_[i][celli] =
-					(c_[i] - c0[i])*specieThermo_[i].W() / deltaT[celli];
+				const label celli = cells[i];
+				scalar* state = &states[nState*i];
+
+				for (label si = 0; si < nSpecie_; si++)
+				{
+					state[si] =
+						rho[celli]*Y_[si][celli]/specieThermo_[si].W();
+				}
+				state[nSpecie_] = T[celli];
+				state[nSpecie_ + 1] = p[celli];
+				state[nSpecie_ + 2] = deltaT[celli];
+				state[nSpecie_ + 3] = this->deltaTChem_[celli];
 			}
+
+			UOPstream toProc(proci, pBufs);
+			toProc << states;
 		}
-		else
+
+		labelList recvSizes;
+		pBufs.finishedSends(recvSizes);
+
+		List<scalarField> procStates(nProcs);
+
+		forAll(recvSizes, proci)
 		{
-			for (label i = 0; i < nSpecie_; i++)
+			if (recvSizes[proci])
+			{
+				UIPstream fromProc(proci, pBufs);
+				fromProc >> procStates[proci];
+			}
+
+			recvStart[proci + 1] =
+				recvStart[proci] + procStates[proci].size()/nState;
+		}
+
+		recvStates.setSize(nState*recvStart[nProcs]);
+
+		forAll(procStates, proci)
+		{
+			SubField<scalar>
+			(
+				recvStates,
+				procStates[proci].size(),
+				nState*recvStart[proci]
+			) = procStates[proci];
+		}
+	}
+
+	const label nLocal = localCells.size();
+	const label nRecv = recvStart[nProcs];
+
+	scalarField recvResults(nResult*nRecv);
+
+	// Cells are handed out to the threads in small blocks as the cost of
+	// the integration varies strongly with the stiffness
+	const label blockSize = 16;
+	const label nThreads =
+		threadLoop::nThreadsFor(nLocal + nRecv, blockSize);
+
+	// Minimum chemical time step of each thread
+	scalarList threadDeltaTMin(nThreads, great);
+
+	// Integrate the local cells and then the received cells in
+	// [start, end)
+	const auto solveCells = [&]
+	(
+		const label threadi,
+		const label start,
+		const label end
+	)
+	{
+		scalarField c(nSpecie_);
+		scalarField c0(nSpecie_);
+
+		scalar& threadMin = threadDeltaTMin[threadi];
+
+		for (label taski = start; taski < end; taski++)
+		{
+			if (taski >= nLocal)
+			{
+				const label i = taski - nLocal;
+				const scalar* state = &recvStates[nState*i];
+				scalar* result = &recvResults[nResult*i];
+
+				for (label si = 0; si < nSpecie_; si++)
+				{
+					c[si] = state[si];
+				}
+				scalar Ti = state[nSpecie_];
+				scalar pi = state[nSpecie_ + 1];
+				scalar deltaTChem = state[nSpecie_ + 3];
+
+				const clockTime timer;
+
+				integrate(c, Ti, pi, state[nSpecie_ + 2], deltaTChem);
+
+				for (label si = 0; si < nSpecie_; si++)
+				{
+					result[si] = c[si];
+				}
+				result[nSpecie_] = deltaTChem;
+				result[nSpecie_ + 1] = timer.elapsedTime();
+
+				continue;
+			}
+
+			const label celli = localCells[taski];
+
+			scalar Ti = T[celli];
+
+			if (Ti > Treact_)
+			{
+				const scalar rhoi = rho[celli];
+				scalar pi = p[celli];
+
+				for (label i = 0; i < nSpecie_; i++)
+				{
+					c[i] = rhoi * Y_[i][celli] / specieThermo_[i].W();
+					c0[i] = c[i];
+				}
+
+				const clockTime timer;
+
+				integrate(c, Ti, pi, deltaT[celli], this->deltaTChem_[celli]);
+
+				if (loadBalancing_)
+				{
+					cellCost_[celli] = timer.elapsedTime();
+				}
+
+				threadMin = min(this->deltaTChem_[celli], threadMin);
+
+				this->deltaTChem_[celli] =
+					min(this->deltaTChem_[celli], this->deltaTChemMax_);
+
+				for (label i = 0; i < nSpecie_; i++)
+				{
+					RR_[i][celli] =
+						(c[i] - c0[i])*specieThermo_[i].W() / deltaT[celli];
+				}
+			}
+			else
+			{
+				cellCost_[celli] = 0;
+
+				for (label i = 0; i < nSpecie_; i++)
+				{
+					RR_[i][celli] = 0;
+				}
+			}
+		}
+	};
+
+	if (nThreads > 1 && setNThreads(nThreads))
+	{
+		const label nOld = threadC_.size();
+
+		threadC_.setSize(nThreads - 1);
+
+		for (label threadi = nOld; threadi < nThreads - 1; threadi++)
+		{
+			threadC_.set(threadi, new scalarField(nSpecie_));
+		}
+
+		reactionKernel_.setNThreads(nThreads);
+
+		threadLoop::runDynamic(nLocal + nRecv, blockSize, solveCells);
+	}
+	else
+	{
+		solveCells(0, 0, nLocal + nRecv);
+	}
+
+	// Return the results of the received cells and map the results of the
+	// cells sent back into the source terms
+	if (balance)
+	{
+		PstreamBuffers pBufs(Pstream::commsTypes::nonBlocking);
+
+		for (label proci = 0; proci < nProcs; proci++)
+		{
+			const label n = recvStart[proci + 1] - recvStart[proci];
+
+			if (n)
+			{
+				UOPstream toProc(proci, pBufs);
+				toProc
+					<< SubField<scalar>
+					   (
+						   recvResults,
+						   nResult*n,
+						   nResult*recvStart[proci]
+					   );
+			}
+		}
+
+		pBufs.finishedSends();
+
+		forAll(sendCells, proci)
+		{
+			const labelList& cells = sendCells[proci];
+
+			if (cells.empty())
+			{
+				continue;
+			}
+
+			UIPstream fromProc(proci, pBufs);
+			const scalarField results(fromProc);
+
+			forAll(cells, i)
+			{
+				const label celli = cells[i];
+				const scalar* result = &results[nResult*i];
+
+				for (label si = 0; si < nSpecie_; si++)
+				{
+					const scalar W = specieThermo_[si].W();
+					const scalar c0 = rho[celli]*Y_[si][celli]/W;
+
+					RR_[si][celli] = (result[si] - c0)*W/deltaT[celli];
+				}
+
+				this->deltaTChem_[celli] = result[nSpecie_];
+				cellCost_[celli] = result[nSpecie_ + 1];
+
+				threadDeltaTMin[0] =
+					min(this->deltaTChem_[celli], threadDeltaTMin[0]);
+
+				this->deltaTChem_[celli] =
+					min(this->deltaTChem_[celli], this->deltaTChemMax_);
+			}
+		}
+	}
+
+	// Apply the changes of the representatives to the rest of the clusters
+	if (clustering_.active())
+	{
+		clustering_.map(Y_, rho, deltaT, RR_, this->deltaTChem_);
+
+		forAll(cellCost_, celli)
+		{
+			if (!clustering_.integrated(celli))
 			{
-				RR_[i][celli] = 0;
+				cellCost_[celli] = 0;
 			}
 		}
 	}
 
-	return deltaTMin;
+	return min(threadDeltaTMin);
 }
 
 
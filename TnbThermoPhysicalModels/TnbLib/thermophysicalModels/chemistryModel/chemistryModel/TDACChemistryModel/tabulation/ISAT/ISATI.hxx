@@ -1,5 +1,6 @@
 #pragma once
 #include <LUscalarMatrix.hxx>
+#include <Pstream.hxx>
 
 // * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
 
@@ -50,7 +51,9 @@ tnbLib::chemistryTabulationMethods::ISAT<CompType, ThermoType>::ISAT
 	nRetrieved_(0),
 	nGrowth_(0),
 	nAdd_(0),
-	cleaningRequired_(false)
+	cleaningRequired_(false),
+	shareInterval_(this->coeffsDict_.lookupOrDefault("shareInterval", 0)),
+	nSharePoints_(this->coeffsDict_.lookupOrDefault("nSharePoints", 100))
 {
 	if (this->active_)
 	{
@@ -89,6 +92,16 @@ tnbLib::chemistryTabulationMethods::ISAT<CompType, ThermoType>::ISAT
 		nAdditionalEqns_ = 2;
 	}
 
+	if (shareInterval_ > 0 && chemistry.mechRed()->active())
+	{
+		WarningInFunction
+			<< "The exchange of the chemPoints between the processors "
+			<< "requires the mechanism reduction to be inactive, "
+			<< "shareInterval is ignored" << endl;
+
+		shareInterval_ = 0;
+	}
+
 	if (this->log())
 	{
 		nRetrievedFile_ = chemistry.logFile("found_isat.out");
@@ -291,6 +304,9 @@ tnbLib::chemistryTabulationMethods::ISAT<CompType, ThermoType>::cleanAndBalance(
 
 	MRUList_.clear();
 
+	// The chemPoint found by the last search may have been deleted
+	lastSearch_ = nullptr;
+
 	// Check if the tree should be balanced according to criterion:
 	//  -the depth of the tree bigger than a*log2(size), log2(size) being the
 	//      ideal depth (e.g. 4 leafs can be stored in a tree of depth 2)
@@ -311,6 +327,217 @@ tnbLib::chemistryTabulationMethods::ISAT<CompType, ThermoType>::cleanAndBalance(
 }
 
 
+template<class CompType, class ThermoType>
+void tnbLib::chemistryTabulationMethods::ISAT<CompType, ThermoType>::sharePoints()
+{
+	const label n = scaleFactor_.size();
+	const label ASize = this->chemistry_.nEqns() + nAdditionalEqns_ - 2;
+	const label recordSize = 2*n + ASize*ASize;
+
+	// Order the chemPoints retrieved since the last exchange by decreasing
+	// number of retrieves. No processor can contribute more than
+	// nSharePoints_ of them.
+	DynamicList<chemPointISAT<CompType, ThermoType>*> points;
+	DynamicList<label> nRetrieves;
+
+	chemPointISAT<CompType, ThermoType>* x = chemisTree_.treeMin();
+	while (x != nullptr)
+	{
+		if (x->numRetrieve() > 0)
+		{
+			points.append(x);
+			nRetrieves.append(-x->numRetrieve());
+		}
+		x = chemisTree_.treeSuccessor(x);
+	}
+
+	labelList order;
+	sortedOrder(nRetrieves, order);
+	order.setSize(min(order.size(), nSharePoints_));
+
+	chemisTree_.resetNumRetrieve();
+
+	// Gather the numbers of retrieves of the candidates on the master, which
+	// selects the nSharePoints_ chemPoints retrieved most often over all the
+	// processors. Since the candidates of each processor are ordered, the
+	// selection is the first nSends[proci] candidates of each processor.
+	List<labelList> procNRetrieves(Pstream::nProcs());
+	{
+		labelList& myNRetrieves = procNRetrieves[Pstream::myProcNo()];
+		myNRetrieves.setSize(order.size());
+
+		forAll(order, i)
+		{
+			myNRetrieves[i] = -nRetrieves[order[i]];
+		}
+	}
+
+	Pstream::gatherList(procNRetrieves);
+
+	labelList nSends(Pstream::nProcs(), 0);
+
+	if (Pstream::master())
+	{
+		DynamicList<label> allNRetrieves;
+		DynamicList<label> allProcs;
+
+		forAll(procNRetrieves, proci)
+		{
+			forAll(procNRetrieves[proci], i)
+			{
+				allNRetrieves.append(-procNRetrieves[proci][i]);
+				allProcs.append(proci);
+			}
+		}
+
+		labelList allOrder;
+		sortedOrder(allNRetrieves, allOrder);
+
+		const label nSelected = min(allOrder.size(), nSharePoints_);
+
+		for (label i = 0; i < nSelected; i++)
+		{
+			nSends[allProcs[allOrder[i]]]++;
+		}
+	}
+
+	Pstream::scatter(nSends);
+
+	// Offsets of the chemPoints of each processor in the exchanged records
+	labelList offsets(Pstream::nProcs() + 1, 0);
+	forAll(nSends, proci)
+	{
+		offsets[proci + 1] = offsets[proci] + nSends[proci];
+	}
+
+	// Pack the composition, mapping and gradients of the selected chemPoints
+	List<scalarField> procRecords(Pstream::nProcs());
+	{
+		scalarField& sendRecords = procRecords[Pstream::myProcNo()];
+		sendRecords.setSize(nSends[Pstream::myProcNo()]*recordSize);
+
+		label recordi = 0;
+		for (label i = 0; i < nSends[Pstream::myProcNo()]; i++)
+		{
+			const chemPointISAT<CompType, ThermoType>& p = *points[order[i]];
+
+			forAll(p.phi(), j)
+			{
+				sendRecords[recordi++] = p.phi()[j];
+			}
+			forAll(p.Rphi(), j)
+			{
+				sendRecords[recordi++] = p.Rphi()[j];
+			}
+			for (label j = 0; j < ASize; j++)
+			{
+				for (label k = 0; k < ASize; k++)
+				{
+					sendRecords[recordi++] = p.A()(j, k);
+				}
+			}
+		}
+	}
+
+	Pstream::gatherList(procRecords);
+
+	// Combine the selected chemPoints on the master and broadcast them
+	scalarField records;
+
+	if (Pstream::master())
+	{
+		records.setSize(offsets.last()*recordSize);
+
+		forAll(procRecords, proci)
+		{
+			SubField<scalar>
+			(
+				records,
+				procRecords[proci].size(),
+				offsets[proci]*recordSize
+			) = procRecords[proci];
+		}
+	}
+
+	procRecords.clear();
+
+	Pstream::scatter(records);
+
+	// Add the chemPoints of the other processors which are not retrieved
+	// from the tree
+	scalarField phi(n);
+	scalarField Rphi(n);
+	scalarSquareMatrix A(ASize);
+	label nShared = 0;
+
+	for
+	(
+		label pointi = 0;
+		pointi < offsets.last() && !chemisTree_.isFull();
+		pointi++
+	)
+	{
+		if
+		(
+			pointi >= offsets[Pstream::myProcNo()]
+		 && pointi < offsets[Pstream::myProcNo() + 1]
+		)
+		{
+			continue;
+		}
+
+		label recordi = pointi*recordSize;
+
+		forAll(phi, j)
+		{
+			phi[j] = records[recordi++];
+		}
+		forAll(Rphi, j)
+		{
+			Rphi[j] = records[recordi++];
+		}
+		for (label j = 0; j < ASize; j++)
+		{
+			for (label k = 0; k < ASize; k++)
+			{
+				A(j, k) = records[recordi++];
+			}
+		}
+
+		chemPointISAT<CompType, ThermoType>* phi0 = nullptr;
+
+		if (chemisTree_.size())
+		{
+			chemisTree_.binaryTreeSearch(phi, chemisTree_.root(), phi0);
+
+			if (phi0->inEOA(phi))
+			{
+				continue;
+			}
+		}
+
+		chemisTree_.insertNewLeaf
+		(
+			phi,
+			Rphi,
+			A,
+			scaleFactor(),
+			this->tolerance(),
+			n,
+			phi0
+		);
+		nShared++;
+	}
+
+	if (debug)
+	{
+		Info<< "ISAT: exchanged " << offsets.last() << " chemPoints, added "
+			<< returnReduce(nShared, sumOp<label>())
+			<< " to the tables of the other processors" << endl;
+	}
+}
+
+
 template<class CompType, class ThermoType>
 void tnbLib::chemistryTabulationMethods::ISAT<CompType, ThermoType>::computeA
 (
@@ -611,6 +838,25 @@ tnbLib::label tnbLib::chemistryTabulationMethods::ISAT<CompType, ThermoType>::ad
 }
 
 
+template<class CompType, class ThermoType>
+bool tnbLib::chemistryTabulationMethods::ISAT<CompType, ThermoType>::update()
+{
+	const bool treeModified = cleanAndBalance();
+
+	if
+	(
+		shareInterval_ > 0
+	 && Pstream::parRun()
+	 && this->chemistry_.timeSteps() % shareInterval_ == 0
+	)
+	{
+		sharePoints();
+	}
+
+	return treeModified;
+}
+
+
 template<class CompType, class ThermoType>
 void
 tnbLib::chemistryTabulationMethods::ISAT<CompType, ThermoType>::writePerformance()
@@ -0,0 +1,16 @@
+#include <chemistryClustering.hxx>
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+tnbLib::chemistryClustering::chemistryClustering(const dictionary& dict)
+	:
+	active_(dict.lookupOrDefault<Switch>("active", false)),
+	TTolerance_(dict.lookupOrDefault<scalar>("TTolerance", 1)),
+	pTolerance_(dict.lookupOrDefault<scalar>("pTolerance", 1e-3)),
+	YTolerance_(dict.lookupOrDefault<scalar>("YTolerance", 1e-4)),
+	representative_(),
+	nClusters_(0)
+{}
+
+
+// ************************************************************************* //
@@ -0,0 +1,22 @@
+#pragma once
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+inline tnbLib::label tnbLib::chemistryClustering::bin
+(
+	const scalar x,
+	const scalar tolerance
+)
+{
+	return label(floor(x/tolerance));
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+inline bool tnbLib::chemistryClustering::integrated(const label celli) const
+{
+	return representative_.empty() || representative_[celli] == celli;
+}
+
+
+// ************************************************************************* //
@@ -1,6 +1,15 @@
 #include <chemkinReader.hxx>
 
 #include <fstream>
+#include <iterator>
+#include <limits>
+#include <SHA1.hxx>
+#include <IFstream.hxx>
+#include <OFstream.hxx>
+#include <IStringStream.hxx>
+#include <OStringStream.hxx>
+#include <Pstream.hxx>
+#include <OSspecific.hxx>
 #include <atomicWeights.hxx>
 #include <ReactionProxy.hxx>
 //#include <IrreversibleReaction.hxx>
@@ -811,6 +820,305 @@ void tnbLib::chemkinReader::read
 }
 
 
+tnbLib::string tnbLib::chemkinReader::sourceDigest
+(
+	const fileName& CHEMKINFileName,
+	const fileName& thermoFileName,
+	const fileName& transportFileName
+) const
+{
+	SHA1 sha;
+
+	const fileName sourceFileNames[3] =
+	{
+		CHEMKINFileName,
+		thermoFileName,
+		transportFileName
+	};
+
+	for (label i = 0; i < 3; i++)
+	{
+		if (sourceFileNames[i] != fileName::null)
+		{
+			std::ifstream is(sourceFileNames[i].c_str(), std::ios::binary);
+
+			if (!is)
+			{
+				FatalErrorInFunction
+					<< "file " << sourceFileNames[i] << " not found"
+					<< exit(FatalError);
+			}
+
+			sha.append
+			(
+				std::string
+				(
+					std::istreambuf_iterator<char>(is),
+					std::istreambuf_iterator<char>()
+				)
+			);
+		}
+
+		// Separate the files so that moving data between them changes the
+		// digest
+		sha.append("\n");
+	}
+
+	sha.append(newFormat_ ? "newFormat" : "oldFormat");
+
+	return sha.digest().str();
+}
+
+
+tnbLib::dictionary tnbLib::chemkinReader::cacheDict
+(
+	const string& digest
+) const
+{
+	// The mechanism is written in full precision so that the processors
+	// constructing it from the cache get the same coefficients
+	OStringStream os;
+	os.precision(std::numeric_limits<scalar>::digits10 + 2);
+
+	writeEntry(os, "sha1", digest);
+	writeEntry(os, "elements", elementNames());
+	writeEntry(os, "isotopeAtomicWts", isotopeAtomicWts_);
+	writeEntry(os, "species", wordList(speciesTable_));
+
+	HashTable<label> phases;
+	forAllConstIter(HashTable<phase>, speciePhase_, iter)
+	{
+		phases.insert(iter.key(), iter());
+	}
+	writeEntry(os, "speciePhase", phases);
+
+	os << "specieComposition" << nl
+		<< token::BEGIN_BLOCK << incrIndent << nl;
+
+	forAllConstIter(speciesCompositionTable, speciesComposition_, iter)
+	{
+		const List<specieElement>& composition = iter();
+
+		os << indent << iter.key() << nl
+			<< indent << token::BEGIN_BLOCK << incrIndent << nl;
+
+		forAll(composition, ei)
+		{
+			writeEntry(os, composition[ei].name(), composition[ei].nAtoms());
+		}
+
+		os << decrIndent << indent << token::END_BLOCK << nl;
+	}
+
+	os << decrIndent << token::END_BLOCK << nl;
+
+	os << "thermo" << nl
+		<< token::BEGIN_BLOCK << incrIndent << nl;
+
+	forAllConstIter(HashPtrTable<gasHThermoPhysics>, speciesThermo_, iter)
+	{
+		iter()->write(os);
+	}
+
+	os << decrIndent << token::END_BLOCK << nl;
+
+	reactions_.write(os);
+
+	os << "transport" << transportDict_;
+
+	return dictionary(IStringStream(os.str())());
+}
+
+
+void tnbLib::chemkinReader::readCache(const dictionary& cache)
+{
+	Reaction<gasHThermoPhysics>::TlowDefault = 0;
+	Reaction<gasHThermoPhysics>::ThighDefault = great;
+
+	elementNames_ = wordList(cache.lookup("elements"));
+	forAll(elementNames_, ei)
+	{
+		elementIndices_.insert(elementNames_[ei], ei);
+	}
+
+	isotopeAtomicWts_ = HashTable<scalar>(cache.lookup("isotopeAtomicWts"));
+
+	specieNames_ = wordList(cache.lookup("species"));
+	forAll(specieNames_, si)
+	{
+		specieIndices_.insert(specieNames_[si], si);
+	}
+	speciesTable_ = specieNames_;
+
+	const HashTable<label> phases(cache.lookup("speciePhase"));
+	forAllConstIter(HashTable<label>, phases, iter)
+	{
+		speciePhase_.insert(iter.key(), phase(iter()));
+	}
+
+	const dictionary& compositionDict = cache.subDict("specieComposition");
+	forAllConstIter(dictionary, compositionDict, iter)
+	{
+		const dictionary& elementsDict = iter().dict();
+
+		List<specieElement> composition(elementsDict.size());
+
+		label ei = 0;
+		forAllConstIter(dictionary, elementsDict, elementIter)
+		{
+			composition[ei].name() = elementIter().keyword();
+			composition[ei].nAtoms() = readLabel(elementIter().stream());
+			ei++;
+		}
+
+		speciesComposition_.insert(iter().keyword(), composition);
+	}
+
+	const dictionary& thermoDict = cache.subDict("thermo");
+	forAllConstIter(dictionary, thermoDict, iter)
+	{
+		speciesThermo_.insert
+		(
+			iter().keyword(),
+			new gasHThermoPhysics(iter().dict())
+		);
+	}
+
+	const dictionary& reactionsDict = cache.subDict("reactions");
+	forAllConstIter(dictionary, reactionsDict, iter)
+	{
+		reactions_.append
+		(
+			Reaction<gasHThermoPhysics>::New
+			(
+				speciesTable_,
+				speciesThermo_,
+				iter().dict()
+			).ptr()
+		);
+	}
+
+	transportDict_ = cache.subDict("transport");
+}
+
+
+void tnbLib::chemkinReader::readCached
+(
+	const fileName& cacheFileName,
+	const fileName& CHEMKINFileName,
+	const fileName& thermoFileName,
+	const fileName& transportFileName
+)
+{
+	// The cache is distributed as text which every processor parses as
+	// ASCII, whatever the format of the inter-processor streams
+	dictionary cache;
+	string cacheText;
+	bool parsed = false;
+
+	if (Pstream::master())
+	{
+		const string digest
+		(
+			sourceDigest(CHEMKINFileName, thermoFileName, transportFileName)
+		);
+
+		// A cache which cannot be read, e.g. truncated by an interrupted
+		// write, is treated as out of date rather than as an error
+		if (isFile(cacheFileName))
+		{
+			std::ifstream is(cacheFileName.c_str(), std::ios::binary);
+
+			cacheText = std::string
+			(
+				std::istreambuf_iterator<char>(is),
+				std::istreambuf_iterator<char>()
+			);
+
+			FatalError.throwExceptions();
+			FatalIOError.throwExceptions();
+			try
+			{
+				IStringStream cacheStream(cacheText);
+				cache.read(cacheStream);
+			}
+			catch (tnbLib::error&)
+			{
+				cache.clear();
+			}
+			FatalError.dontThrowExceptions();
+			FatalIOError.dontThrowExceptions();
+		}
+
+		if
+		(
+			cache.lookupOrDefault<string>("sha1", string::null) == digest
+		 && cache.found("transport")
+		)
+		{
+			Info << "Reading CHEMKIN mechanism cache " << cacheFileName
+				<< endl;
+		}
+		else
+		{
+			read(CHEMKINFileName, thermoFileName, transportFileName);
+			parsed = true;
+
+			cache = cacheDict(digest);
+
+			{
+				OStringStream cacheStream;
+				cacheStream.precision
+				(
+					std::numeric_limits<scalar>::digits10 + 2
+				);
+				cache.write(cacheStream, false);
+				cacheText = cacheStream.str();
+			}
+
+			Info << "Writing CHEMKIN mechanism cache " << cacheFileName
+				<< endl;
+
+			// Write to a temporary file and rename it so that a partially
+			// written cache is never read
+			const fileName tmpFileName(cacheFileName + ".tmp");
+			{
+				OFstream os(tmpFileName);
+				os.stdStream() << cacheText.c_str();
+			}
+
+			// The rename does not replace an existing file on Windows
+			if (isFile(cacheFileName))
+			{
+				rm(cacheFileName);
+			}
+
+			if (!mv(tmpFileName, cacheFileName))
+			{
+				WarningInFunction
+					<< "Could not rename " << tmpFileName << " to "
+					<< cacheFileName << nl
+					<< "    The CHEMKIN files will be parsed again next time"
+					<< endl;
+			}
+		}
+	}
+
+	Pstream::scatter(cacheText);
+
+	if (!Pstream::master())
+	{
+		IStringStream cacheStream(cacheText);
+		cache.read(cacheStream);
+	}
+
+	if (!parsed)
+	{
+		readCache(cache);
+	}
+}
+
+
 // * * * * * * * * * * * * * * * * Constructor * * * * * * * * * * * * * * * //
 
 tnbLib::chemkinReader::chemkinReader
@@ -885,7 +1193,24 @@ tnbLib::chemkinReader::chemkinReader
 		}
 	}
 
-	read(chemkinFile, thermoFile, transportFile);
+	if (thermoDict.found("CHEMKINCache"))
+	{
+		fileName cacheFile
+		(
+			fileName(thermoDict.lookup("CHEMKINCache")).expand()
+		);
+
+		if (relPath.size() && !cacheFile.isAbsolute())
+		{
+			cacheFile = relPath / cacheFile;
+		}
+
+		readCached(cacheFile, chemkinFile, thermoFile, transportFile);
+	}
+	else
+	{
+		read(chemkinFile, thermoFile, transportFile);
+	}
 }
 
 
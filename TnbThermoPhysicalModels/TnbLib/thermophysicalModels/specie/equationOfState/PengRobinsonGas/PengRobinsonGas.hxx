@@ -31,6 +31,9 @@ Class
 Description
 	PengRobinsonGas gas equation of state.
 
+	The compression factor may be interpolated from the table of
+	PengRobinsonZTable instead of solving the cubic at every evaluation.
+
 SourceFiles
 	PengRobinsonGasI.H
 	PengRobinsonGas.C
@@ -41,6 +44,7 @@ SourceFiles
 #include <scalar.hxx>  // added by amir
 #include <Ostream.hxx>  // added by amir
 #include <word.hxx>  // added by amir
+#include <PengRobinsonZTable.hxx>
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
@@ -0,0 +1,201 @@
+#include <PengRobinsonZTable.hxx>
+
+#include <mathematicalConstants.hxx>
+#include <tnbDebug.hxx>
+#include <registerSwitch.hxx>
+
+// * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
+
+int tnbLib::PengRobinsonZTable::nIntervals
+(
+	tnbLib::debug::optimisationSwitch("PengRobinsonZTable", 0)
+);
+registerOptSwitch
+(
+	"PengRobinsonZTable",
+	int,
+	tnbLib::PengRobinsonZTable::nIntervals
+);
+
+float tnbLib::PengRobinsonZTable::Amax
+(
+	tnbLib::debug::floatOptimisationSwitch("PengRobinsonZTableAmax", 20)
+);
+registerOptSwitch
+(
+	"PengRobinsonZTableAmax",
+	float,
+	tnbLib::PengRobinsonZTable::Amax
+);
+
+float tnbLib::PengRobinsonZTable::Bmax
+(
+	tnbLib::debug::floatOptimisationSwitch("PengRobinsonZTableBmax", 2)
+);
+registerOptSwitch
+(
+	"PengRobinsonZTableBmax",
+	float,
+	tnbLib::PengRobinsonZTable::Bmax
+);
+
+float tnbLib::PengRobinsonZTable::tolerance
+(
+	tnbLib::debug::floatOptimisationSwitch("PengRobinsonZTableTolerance", 1e-4)
+);
+registerOptSwitch
+(
+	"PengRobinsonZTableTolerance",
+	float,
+	tnbLib::PengRobinsonZTable::tolerance
+);
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+tnbLib::PengRobinsonZTable::PengRobinsonZTable
+(
+	const label n,
+	const scalar Amax,
+	const scalar Bmax,
+	const scalar tolerance
+)
+	:
+	n_(n),
+	rDeltaA_(n/Amax),
+	rDeltaB_(n/Bmax),
+	Z_((n + 1)*(n + 1)),
+	accurate_(n*n, true)
+{
+	const scalar deltaA = Amax/n;
+	const scalar deltaB = Bmax/n;
+
+	for (label i = 0; i <= n_; i++)
+	{
+		for (label j = 0; j <= n_; j++)
+		{
+			Z_[i*(n_ + 1) + j] = solve(i*deltaA, j*deltaB);
+		}
+	}
+
+	// Check the interpolation at the centre and edge midpoints of the cells
+	static const scalar checkPoints[5][2] =
+	{
+		{0.5, 0.5}, {0.5, 0}, {0, 0.5}, {1, 0.5}, {0.5, 1}
+	};
+
+	for (label i = 0; i < n_; i++)
+	{
+		for (label j = 0; j < n_; j++)
+		{
+			for (label k = 0; k < 5; k++)
+			{
+				const scalar fa = checkPoints[k][0];
+				const scalar fb = checkPoints[k][1];
+
+				const scalar Z = solve((i + fa)*deltaA, (j + fb)*deltaB);
+
+				if (mag(interpolate(i, j, fa, fb) - Z) > tolerance*mag(Z))
+				{
+					accurate_[i*n_ + j] = false;
+					break;
+				}
+			}
+		}
+	}
+}
+
+
+// * * * * * * * * * * * * * * * Static Member Functions * * * * * * * * * * //
+
+tnbLib::scalar tnbLib::PengRobinsonZTable::solve
+(
+	const scalar A,
+	const scalar B
+)
+{
+	const scalar a2 = B - 1;
+	const scalar a1 = A - 2 * B - 3 * sqr(B);
+	const scalar a0 = -A * B + sqr(B) + pow3(B);
+
+	const scalar Q = (3 * a1 - a2 * a2) / 9.0;
+	const scalar Rl = (9 * a2*a1 - 27 * a0 - 2 * a2*a2*a2) / 54.0;
+
+	const scalar Q3 = Q * Q*Q;
+	const scalar D = Q3 + Rl * Rl;
+
+	scalar root = -1;
+
+	if (D <= 0)
+	{
+		const scalar th = ::acos(Rl / sqrt(-Q3));
+		const scalar qm = 2 * sqrt(-Q);
+		const scalar r1 = qm * cos(th / 3.0) - a2 / 3.0;
+		const scalar r2 =
+			qm * cos((th + 2 * constant::mathematical::pi) / 3.0) - a2 / 3.0;
+		const scalar r3 =
+			qm * cos((th + 4 * constant::mathematical::pi) / 3.0) - a2 / 3.0;
+
+		root = max(r1, max(r2, r3));
+	}
+	else
+	{
+		// One root is real
+		const scalar D05 = sqrt(D);
+		const scalar S = pow(Rl + D05, 1.0 / 3.0);
+		scalar Tl = 0;
+		if (D05 > Rl)
+		{
+			Tl = -pow(mag(Rl - D05), 1.0 / 3.0);
+		}
+		else
+		{
+			Tl = pow(Rl - D05, 1.0 / 3.0);
+		}
+
+		root = S + Tl - a2 / 3.0;
+	}
+
+	return root;
+}
+
+
+const tnbLib::PengRobinsonZTable* tnbLib::PengRobinsonZTable::table()
+{
+	if (nIntervals <= 0)
+	{
+		return nullptr;
+	}
+
+	// Constructed on first use, which is thread-safe
+	static const PengRobinsonZTable zTable
+	(
+		nIntervals,
+		Amax,
+		Bmax,
+		tolerance
+	);
+
+	return &zTable;
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+tnbLib::scalar tnbLib::PengRobinsonZTable::fractionAccurate() const
+{
+	label nAccurate = 0;
+
+	forAll(accurate_, celli)
+	{
+		if (accurate_[celli])
+		{
+			nAccurate++;
+		}
+	}
+
+	return scalar(nAccurate)/max(accurate_.size(), 1);
+}
+
+
+// ************************************************************************* //
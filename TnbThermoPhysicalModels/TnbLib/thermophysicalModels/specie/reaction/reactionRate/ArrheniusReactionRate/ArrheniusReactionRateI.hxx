@@ -29,6 +29,24 @@ inline tnbLib::ArrheniusReactionRate::ArrheniusReactionRate
 
 // * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
 
+inline tnbLib::scalar tnbLib::ArrheniusReactionRate::A() const
+{
+	return A_;
+}
+
+
+inline tnbLib::scalar tnbLib::ArrheniusReactionRate::temperatureExponent() const
+{
+	return beta_;
+}
+
+
+inline tnbLib::scalar tnbLib::ArrheniusReactionRate::Ta() const
+{
+	return Ta_;
+}
+
+
 inline tnbLib::scalar tnbLib::ArrheniusReactionRate::operator()
 (
 	const scalar p,
@@ -52,6 +52,30 @@ FallOffReactionRate
 
 // * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
 
+template<class ReactionRate, class FallOffFunction>
+inline const ReactionRate&
+tnbLib::FallOffReactionRate<ReactionRate, FallOffFunction>::k0() const
+{
+	return k0_;
+}
+
+
+template<class ReactionRate, class FallOffFunction>
+inline const ReactionRate&
+tnbLib::FallOffReactionRate<ReactionRate, FallOffFunction>::kInf() const
+{
+	return kInf_;
+}
+
+
+template<class ReactionRate, class FallOffFunction>
+inline const FallOffFunction&
+tnbLib::FallOffReactionRate<ReactionRate, FallOffFunction>::F() const
+{
+	return F_;
+}
+
+
 template<class ReactionRate, class FallOffFunction>
 inline tnbLib::scalar
 tnbLib::FallOffReactionRate<ReactionRate, FallOffFunction>::operator()
@@ -94,6 +94,10 @@ namespace tnbLib
 			return "thirdBodyArrhenius";
 		}
 
+		//- Return the Arrhenius rate multiplied by the third-body
+		//  concentration
+		inline const ArrheniusReactionRate& k() const;
+
 		inline scalar operator()
 			(
 				const scalar p,
@@ -102,6 +102,15 @@ namespace tnbLib
 			return ReactionRate::type() + FallOffFunction::type() + "FallOff";
 		}
 
+		//- Return the low-pressure limit rate
+		inline const ReactionRate& k0() const;
+
+		//- Return the high-pressure limit rate
+		inline const ReactionRate& kInf() const;
+
+		//- Return the fall-off function
+		inline const FallOffFunction& F() const;
+
 		inline scalar operator()
 			(
 				const scalar p,
@@ -234,49 +234,9 @@ inline tnbLib::scalar tnbLib::PengRobinsonGas<Specie>::Z
 	const scalar A = a * alpha*p / sqr(constant::thermodynamic::RR*T);
 	const scalar B = b * p / (constant::thermodynamic::RR*T);
 
-	const scalar a2 = B - 1;
-	const scalar a1 = A - 2 * B - 3 * sqr(B);
-	const scalar a0 = -A * B + sqr(B) + pow3(B);
+	const PengRobinsonZTable* table = PengRobinsonZTable::table();
 
-	const scalar Q = (3 * a1 - a2 * a2) / 9.0;
-	const scalar Rl = (9 * a2*a1 - 27 * a0 - 2 * a2*a2*a2) / 54.0;
-
-	const scalar Q3 = Q * Q*Q;
-	const scalar D = Q3 + Rl * Rl;
-
-	scalar root = -1;
-
-	if (D <= 0)
-	{
-		const scalar th = ::acos(Rl / sqrt(-Q3));
-		const scalar qm = 2 * sqrt(-Q);
-		const scalar r1 = qm * cos(th / 3.0) - a2 / 3.0;
-		const scalar r2 =
-			qm * cos((th + 2 * constant::mathematical::pi) / 3.0) - a2 / 3.0;
-		const scalar r3 =
-			qm * cos((th + 4 * constant::mathematical::pi) / 3.0) - a2 / 3.0;
-
-		root = max(r1, max(r2, r3));
-	}
-	else
-	{
-		// One root is real
-		const scalar D05 = sqrt(D);
-		const scalar S = pow(Rl + D05, 1.0 / 3.0);
-		scalar Tl = 0;
-		if (D05 > Rl)
-		{
-			Tl = -pow(mag(Rl - D05), 1.0 / 3.0);
-		}
-		else
-		{
-			Tl = pow(Rl - D05, 1.0 / 3.0);
-		}
-
-		root = S + Tl - a2 / 3.0;
-	}
-
-	return root;
+	return table ? table->Z(A, B) : PengRobinsonZTable::solve(A, B);
 }
 
 
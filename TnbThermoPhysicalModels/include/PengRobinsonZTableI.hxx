@@ -0,0 +1,48 @@
+#pragma once
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+inline tnbLib::scalar tnbLib::PengRobinsonZTable::interpolate
+(
+	const label i,
+	const label j,
+	const scalar fa,
+	const scalar fb
+) const
+{
+	const scalar* Z = &Z_[i*(n_ + 1) + j];
+
+	return
+		(1 - fa)*((1 - fb)*Z[0] + fb*Z[1])
+	  + fa*((1 - fb)*Z[n_ + 1] + fb*Z[n_ + 2]);
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+inline tnbLib::scalar tnbLib::PengRobinsonZTable::Z
+(
+	const scalar A,
+	const scalar B
+) const
+{
+	const scalar a = A*rDeltaA_;
+	const scalar b = B*rDeltaB_;
+
+	if (a < 0 || b < 0 || a >= n_ || b >= n_)
+	{
+		return solve(A, B);
+	}
+
+	const label i = label(a);
+	const label j = label(b);
+
+	if (!accurate_[i*n_ + j])
+	{
+		return solve(A, B);
+	}
+
+	return interpolate(i, j, a - i, b - j);
+}
+
+
+// ************************************************************************* //
@@ -21,6 +21,16 @@ tnbLib::StandardChemistryModel<ReactionThermo, ThermoType>::RR()
 }
 
 
+template<class ReactionThermo, class ThermoType>
+inline tnbLib::scalarField&
+tnbLib::StandardChemistryModel<ReactionThermo, ThermoType>::threadC() const
+{
+	const label threadi = threadLoop::threadIndex();
+
+	return threadi && threadC_.size() ? threadC_[threadi - 1] : c_;
+}
+
+
 template<class ReactionThermo, class ThermoType>
 inline const tnbLib::PtrList<tnbLib::Reaction<ThermoType>>&
 tnbLib::StandardChemistryModel<ReactionThermo, ThermoType>::reactions() const
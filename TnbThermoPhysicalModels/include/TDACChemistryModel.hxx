@@ -142,6 +142,30 @@ namespace tnbLib
 		volScalarField tabulationResults_;
 
 
+		// Statistics since the last resetStatistics
+
+			//- Number of cells solved with the reduced mechanism
+		label nReduced_;
+
+		//- Sum of the number of active species of these cells
+		scalar nActiveSpeciesSum_;
+
+		//- Clock time of the mechanism reduction
+		scalar reduceTime_;
+
+		//- Number of cells retrieved from the table
+		label nRetrieved_;
+
+		//- Number of cells which grew a point of the table
+		label nGrown_;
+
+		//- Number of cells added to the table
+		label nAdded_;
+
+		//- Clock time of the successful retrieves
+		scalar retrieveTime_;
+
+
 		// Private Member Functions
 
 			//- Solve the reaction system for the given time step
@@ -224,6 +248,12 @@ namespace tnbLib
 		//  and return the characteristic time
 		virtual scalar solve(const scalarField& deltaT);
 
+		//- Reset the counters of the reduction and tabulation
+		virtual void resetStatistics();
+
+		//- Write the counters of the reduction and tabulation
+		virtual void writeStatistics(Ostream& os) const;
+
 
 		// ODE functions (overriding functions in StandardChemistryModel to take
 		// into account the variable number of species)
@@ -243,6 +273,10 @@ namespace tnbLib
 			scalarSquareMatrix& J
 		) const;
 
+		//- Return the pattern of the Jacobian, dense if the mechanism
+		//  reduction is active since the species then vary between cells
+		virtual labelListList jacobianPattern() const;
+
 		virtual void solve
 		(
 			scalarField& c,
@@ -42,7 +42,14 @@ tnbLib::TDACChemistryModel<ReactionThermo, ThermoType>::TDACChemistryModel
 		),
 		this->mesh(),
 		scalar(0)
-	)
+	),
+	nReduced_(0),
+	nActiveSpeciesSum_(0),
+	reduceTime_(0),
+	nRetrieved_(0),
+	nGrown_(0),
+	nAdded_(0),
+	retrieveTime_(0)
 {
 	basicSpecieMixture& composition = this->thermo().composition();
 
@@ -510,6 +517,22 @@ void tnbLib::TDACChemistryModel<ReactionThermo, ThermoType>::jacobian
 }
 
 
+template<class ReactionThermo, class ThermoType>
+tnbLib::labelListList
+tnbLib::TDACChemistryModel<ReactionThermo, ThermoType>::jacobianPattern() const
+{
+	if (mechRed_->active())
+	{
+		return labelListList();
+	}
+	else
+	{
+		return StandardChemistryModel<ReactionThermo, ThermoType>::
+			jacobianPattern();
+	}
+}
+
+
 template<class ReactionThermo, class ThermoType>
 template<class DeltaTType>
 tnbLib::scalar tnbLib::TDACChemistryModel<ReactionThermo, ThermoType>::solve
@@ -539,7 +562,7 @@ tnbLib::scalar tnbLib::TDACChemistryModel<ReactionThermo, ThermoType>::solve
 
 	// Average number of active species
 	scalar nActiveSpecies = 0;
-	scalar nAvg = 0;
+	label nAvg = 0;
 
 	BasicChemistryModel<ReactionThermo>::correct();
 
@@ -575,8 +598,20 @@ tnbLib::scalar tnbLib::TDACChemistryModel<ReactionThermo, ThermoType>::solve
 
 	scalarField Rphiq(this->nEqns() + nAdditionalEqn);
 
+	// Only the representatives of the clusters of cells are retrieved or
+	// integrated
+	if (this->clustering_.active())
+	{
+		this->clustering_.cluster(this->Y_, T, p, deltaT);
+	}
+
 	forAll(rho, celli)
 	{
+		if (!this->clustering_.integrated(celli))
+		{
+			continue;
+		}
+
 		const scalar rhoi = rho[celli];
 		scalar pi = p[celli];
 		scalar Ti = T[celli];
@@ -615,6 +650,7 @@ tnbLib::scalar tnbLib::TDACChemistryModel<ReactionThermo, ThermoType>::solve
 			}
 
 			searchISATCpuTime_ += clockTime_.timeIncrement();
+			nRetrieved_++;
 		}
 		// This position is reached when tabulation is not used OR
 		// if the solution is not retrieved.
@@ -694,11 +730,13 @@ tnbLib::scalar tnbLib::TDACChemistryModel<ReactionThermo, ThermoType>::solve
 				if (growOrAdd)
 				{
 					this->setTabulationResultsAdd(celli);
+					nAdded_++;
 					addNewLeafCpuTime_ += clockTime_.timeIncrement() + timeTmp;
 				}
 				else
 				{
 					this->setTabulationResultsGrow(celli);
+					nGrown_++;
 					growCpuTime_ += clockTime_.timeIncrement() + timeTmp;
 				}
 			}
@@ -724,6 +762,24 @@ tnbLib::scalar tnbLib::TDACChemistryModel<ReactionThermo, ThermoType>::solve
 		}
 	}
 
+	// Apply the changes of the representatives to the rest of the clusters
+	if (this->clustering_.active())
+	{
+		this->clustering_.map
+		(
+			this->Y_,
+			rho,
+			deltaT,
+			this->RR_,
+			this->deltaTChem_
+		);
+	}
+
+	nReduced_ += nAvg;
+	nActiveSpeciesSum_ += nActiveSpecies;
+	reduceTime_ += reduceMechCpuTime_;
+	retrieveTime_ += searchISATCpuTime_;
+
 	if (mechRed_->log() || tabulation_->log())
 	{
 		cpuSolveFile_()
@@ -822,6 +878,50 @@ tnbLib::scalar tnbLib::TDACChemistryModel<ReactionThermo, ThermoType>::solve
 }
 
 
+template<class ReactionThermo, class ThermoType>
+void tnbLib::TDACChemistryModel<ReactionThermo, ThermoType>::resetStatistics()
+{
+	StandardChemistryModel<ReactionThermo, ThermoType>::resetStatistics();
+
+	nReduced_ = 0;
+	nActiveSpeciesSum_ = 0;
+	reduceTime_ = 0;
+	nRetrieved_ = 0;
+	nGrown_ = 0;
+	nAdded_ = 0;
+	retrieveTime_ = 0;
+}
+
+
+template<class ReactionThermo, class ThermoType>
+void tnbLib::TDACChemistryModel<ReactionThermo, ThermoType>::writeStatistics
+(
+	Ostream& os
+) const
+{
+	StandardChemistryModel<ReactionThermo, ThermoType>::writeStatistics(os);
+
+	if (nReduced_)
+	{
+		os << "    Reduction " << mechRed_->type() << nl
+			<< "        cells             " << nReduced_ << nl
+			<< "        active species    "
+			<< nActiveSpeciesSum_/max(nReduced_, 1)
+			<< " of " << this->Y_.size() << nl
+			<< "        time              " << reduceTime_ << " s" << nl;
+	}
+
+	if (nRetrieved_ + nGrown_ + nAdded_)
+	{
+		os << "    Tabulation " << tabulation_->type() << nl
+			<< "        retrieved         " << nRetrieved_ << nl
+			<< "        grown             " << nGrown_ << nl
+			<< "        added             " << nAdded_ << nl
+			<< "        retrieve time     " << retrieveTime_ << " s" << nl;
+	}
+}
+
+
 template<class ReactionThermo, class ThermoType>
 void tnbLib::TDACChemistryModel<ReactionThermo, ThermoType>::
 setTabulationResultsAdd
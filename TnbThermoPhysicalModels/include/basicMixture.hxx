@@ -37,6 +37,7 @@ SourceFiles
 \*---------------------------------------------------------------------------*/
 
 #include <word.hxx>
+#include <label.hxx>
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
@@ -58,12 +59,24 @@ namespace tnbLib
 		//- The base class of the mixture
 		typedef basicMixture basicMixtureType;
 
+		//- Number of cells of the blocks of setCellBlock
+		static const label cellBlockSize = 256;
+
 
 		// Constructors
 
 			//- Construct from dictionary, mesh and phase name
 		basicMixture(const dictionary&, const fvMesh&, const word&)
 		{}
+
+
+		// Member Functions
+
+			//- Set the block of cells [start, end) of the following
+			//  cellMixture calls, which the mixtures of several species use to
+			//  select the species present in the block. Nothing to do here.
+		void setCellBlock(const label start, const label end) const
+		{}
 	};
 
 
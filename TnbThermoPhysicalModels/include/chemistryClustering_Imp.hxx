@@ -0,0 +1,96 @@
+#pragma once
+#include <HashTable.hxx>
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+template<class DeltaTType>
+void tnbLib::chemistryClustering::cluster
+(
+	const PtrList<volScalarField>& Y,
+	const scalarField& T,
+	const scalarField& p,
+	const DeltaTType& deltaT
+)
+{
+	representative_.setSize(T.size());
+	nClusters_ = 0;
+
+	HashTable<label, labelList, binHash> bins(2*T.size() + 1);
+	labelList key(Y.size() + 3);
+
+	forAll(T, celli)
+	{
+		key[0] = bin(T[celli], TTolerance_);
+		key[1] = bin(log(p[celli]), pTolerance_);
+		key[2] = bin(log(deltaT[celli]), pTolerance_);
+
+		forAll(Y, i)
+		{
+			key[i + 3] = bin(Y[i][celli], YTolerance_);
+		}
+
+		HashTable<label, labelList, binHash>::const_iterator iter =
+			bins.find(key);
+
+		if (iter == bins.end())
+		{
+			bins.insert(key, celli);
+			representative_[celli] = celli;
+			nClusters_++;
+		}
+		else
+		{
+			representative_[celli] = iter();
+		}
+	}
+}
+
+
+template<class DeltaTType>
+void tnbLib::chemistryClustering::map
+(
+	const PtrList<volScalarField>& Y,
+	const scalarField& rho,
+	const DeltaTType& deltaT,
+	PtrList<volScalarField::Internal>& RR,
+	scalarField& deltaTChem
+) const
+{
+	forAll(representative_, celli)
+	{
+		const label repi = representative_[celli];
+
+		if (repi == celli)
+		{
+			continue;
+		}
+
+		// The change of the mass fractions of the representative over its
+		// time step is scaled as a whole so that no mass fraction of the
+		// cell becomes negative. Clipping the species individually would
+		// not conserve the elements.
+		scalar alpha = 1;
+
+		forAll(RR, i)
+		{
+			const scalar dY = RR[i][repi]*deltaT[repi]/rho[repi];
+
+			if (dY < 0)
+			{
+				alpha = min(alpha, max(Y[i][celli], scalar(0))/(-dY));
+			}
+		}
+
+		forAll(RR, i)
+		{
+			const scalar dY = RR[i][repi]*deltaT[repi]/rho[repi];
+
+			RR[i][celli] = rho[celli]*alpha*dY/deltaT[celli];
+		}
+
+		deltaTChem[celli] = deltaTChem[repi];
+	}
+}
+
+
+// ************************************************************************* //
@@ -31,6 +31,23 @@ Class
 Description
 	tnbLib::chemkinReader
 
+	The mechanism read from the CHEMKIN files may be cached in an ASCII file
+	named by the optional CHEMKINCache entry, e.g.
+	\verbatim
+	CHEMKINFile         "<case>/chemkin/chem.inp";
+	CHEMKINThermoFile   "<case>/chemkin/therm.dat";
+	CHEMKINTransportFile "<case>/chemkin/transportProperties";
+	CHEMKINCache        "<case>/chemkin/mechanism.cache";
+	\endverbatim
+	The cache holds the elements, species, species composition and phase,
+	the thermodynamic data, the reactions and the transport dictionary
+	together with the SHA1 digest of the contents of the CHEMKIN files. It
+	is read by the master processor only and its text distributed to the
+	others, so only the master reads any file. If the cache does not exist,
+	cannot be read or its digest differs from that of the CHEMKIN files the
+	master parses the files and writes the cache, via a temporary file which
+	replaces the old cache.
+
 SourceFiles
 	chemkinReader.C
 	chemkinLexer.C
@@ -282,6 +299,34 @@ namespace tnbLib
 			const fileName& transportFileName
 		);
 
+		//- Return the SHA1 digest of the contents of the CHEMKIN files
+		FoamThermophysicalModels_EXPORT string sourceDigest
+		(
+			const fileName& CHEMKINFileName,
+			const fileName& thermoFileName,
+			const fileName& transportFileName
+		) const;
+
+		//- Return the mechanism as a cache dictionary with the given digest
+		FoamThermophysicalModels_EXPORT dictionary cacheDict
+		(
+			const string& digest
+		) const;
+
+		//- Construct the mechanism from a cache dictionary
+		FoamThermophysicalModels_EXPORT void readCache(const dictionary& cache);
+
+		//- Read the mechanism from the cache if it is valid and otherwise
+		//  from the CHEMKIN files, writing the cache, on the master and
+		//  distribute it to the other processors
+		FoamThermophysicalModels_EXPORT void readCached
+		(
+			const fileName& cacheFileName,
+			const fileName& CHEMKINFileName,
+			const fileName& thermoFileName,
+			const fileName& transportFileName
+		);
+
 		//- Disallow default bitwise copy construction
 		FoamThermophysicalModels_EXPORT chemkinReader(const chemkinReader&) = delete;
 
@@ -31,6 +31,12 @@ Class
 Description
 	An ODE solver for chemistry
 
+	The threads other than the first solving cells concurrently have their
+	own ODE solvers and solve vectors.
+
+	The statistics are the number of steps, Jacobian evaluations and LU
+	decompositions and the clock time of the LU of the ODE solvers.
+
 SourceFiles
 	ode.C
 
@@ -38,6 +44,7 @@ SourceFiles
 
 #include <chemistrySolver.hxx>
 #include <ODESolver.hxx>
+#include <threadLoop.hxx>
 
 #ifdef FoamThermophysicalModels_EXPORT_DEFINE
 #define Foamode_EXPORT __declspec(dllexport)
@@ -72,6 +79,20 @@ namespace tnbLib
 		// Solver data
 		mutable scalarField cTp_;
 
+		//- ODE solvers of the threads other than the first
+		mutable PtrList<ODESolver> threadOdeSolvers_;
+
+		//- Solve vectors of the threads other than the first
+		mutable PtrList<scalarField> threadCTp_;
+
+
+	protected:
+
+		// Protected Member Functions
+
+			//- Construct the ODE solvers and solve vectors of the threads
+		virtual bool setNThreads(const label nThreads) const;
+
 
 	public:
 
@@ -104,6 +125,12 @@ namespace tnbLib
 			scalar& deltaT,
 			scalar& subDeltaT
 		) const;
+
+		//- Reset the counters of the ODE solvers
+		virtual void resetStatistics();
+
+		//- Write the counters of the ODE solvers summed over the threads
+		virtual void writeStatistics(Ostream& os) const;
 	};
 
 
@@ -7,7 +7,9 @@ tnbLib::ode<ChemistryModel>::ode(typename ChemistryModel::reactionThermo& thermo
 	chemistrySolver<ChemistryModel>(thermo),
 	coeffsDict_(this->subDict("odeCoeffs")),
 	odeSolver_(ODESolver::New(*this, coeffsDict_)),
-	cTp_(this->nEqns())
+	cTp_(this->nEqns()),
+	threadOdeSolvers_(),
+	threadCTp_()
 {}
 
 
@@ -18,6 +20,26 @@ tnbLib::ode<ChemistryModel>::~ode()
 {}
 
 
+// * * * * * * * * * * * * Protected Member Functions  * * * * * * * * * * //
+
+template<class ChemistryModel>
+bool tnbLib::ode<ChemistryModel>::setNThreads(const label nThreads) const
+{
+	const label nOld = threadOdeSolvers_.size();
+
+	threadOdeSolvers_.setSize(nThreads - 1);
+	threadCTp_.setSize(nThreads - 1);
+
+	for (label threadi = nOld; threadi < nThreads - 1; threadi++)
+	{
+		threadOdeSolvers_.set(threadi, ODESolver::New(*this, coeffsDict_).ptr());
+		threadCTp_.set(threadi, new scalarField(this->nEqns()));
+	}
+
+	return true;
+}
+
+
 // * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
 
 template<class ChemistryModel>
@@ -30,11 +52,22 @@ void tnbLib::ode<ChemistryModel>::solve
 	scalar& subDeltaT
 ) const
 {
+	// Solver and solve vector of the calling thread
+	const label threadi = threadLoop::threadIndex();
+
+	ODESolver& odeSolver =
+		threadi && threadOdeSolvers_.size()
+	  ? threadOdeSolvers_[threadi - 1]
+	  : odeSolver_();
+
+	scalarField& cTp =
+		threadi && threadCTp_.size() ? threadCTp_[threadi - 1] : cTp_;
+
 	// Reset the size of the ODE system to the simplified size when mechanism
 	// reduction is active
-	if (odeSolver_->resize())
+	if (odeSolver.resize())
 	{
-		odeSolver_->resizeField(cTp_);
+		odeSolver.resizeField(cTp);
 	}
 
 	const label nSpecie = this->nSpecie();
@@ -42,19 +75,53 @@ void tnbLib::ode<ChemistryModel>::solve
 	// Copy the concentration, T and P to the total solve-vector
 	for (int i = 0; i < nSpecie; i++)
 	{
-		cTp_[i] = c[i];
+		cTp[i] = c[i];
 	}
-	cTp_[nSpecie] = T;
-	cTp_[nSpecie + 1] = p;
+	cTp[nSpecie] = T;
+	cTp[nSpecie + 1] = p;
 
-	odeSolver_->solve(0, deltaT, cTp_, subDeltaT);
+	odeSolver.solve(0, deltaT, cTp, subDeltaT);
 
 	for (int i = 0; i < nSpecie; i++)
 	{
-		c[i] = max(0.0, cTp_[i]);
+		c[i] = max(0.0, cTp[i]);
 	}
-	T = cTp_[nSpecie];
-	p = cTp_[nSpecie + 1];
+	T = cTp[nSpecie];
+	p = cTp[nSpecie + 1];
+}
+
+
+template<class ChemistryModel>
+void tnbLib::ode<ChemistryModel>::resetStatistics()
+{
+	ChemistryModel::resetStatistics();
+
+	odeSolver_->resetStats();
+
+	forAll(threadOdeSolvers_, threadi)
+	{
+		threadOdeSolvers_[threadi].resetStats();
+	}
+}
+
+
+template<class ChemistryModel>
+void tnbLib::ode<ChemistryModel>::writeStatistics(Ostream& os) const
+{
+	ODESolver::statistics stats(odeSolver_->stats());
+
+	forAll(threadOdeSolvers_, threadi)
+	{
+		stats += threadOdeSolvers_[threadi].stats();
+	}
+
+	os << "    ODE solver " << odeSolver_->type() << nl
+		<< "        steps             " << stats.nSteps << nl
+		<< "        Jacobians         " << stats.nJacobians << nl
+		<< "        LU decompositions " << stats.nLU << nl
+		<< "        LU time           " << stats.LUTime << " s" << nl;
+
+	ChemistryModel::writeStatistics(os);
 }
 
 
@@ -0,0 +1,297 @@
+#pragma once
+#ifndef _reactionKernel_Header
+#define _reactionKernel_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+	tnbLib::reactionKernel
+
+Description
+	Evaluation of the rates of change of the concentrations of a list of
+	reactions from coefficient tables built once from the reactions.
+
+	The irreversible and reversible reactions with Arrhenius,
+	thirdBodyArrhenius and Arrhenius fall-off (Lindemann, Troe and SRI)
+	rates are flattened into tables: the Arrhenius coefficients and
+	temperature limits of all the rates, the third-body efficiencies which
+	differ from one, and the species, stoichiometric coefficients and
+	exponents of the left- and right-hand sides. The Arrhenius rates of all
+	these reactions are evaluated together in a single loop over the tables,
+	followed by the third-body concentrations and then the forward and
+	reverse rates and the reaction rates of every reaction, without a
+	virtual call per reaction. The other reactions are evaluated by their
+	own omega function.
+
+	The rates are the same as those of Reaction::omega. The work arrays are
+	held per thread, see setNThreads.
+
+SourceFiles
+	reactionKernelI.hxx
+	reactionKernel_Imp.hxx
+
+\*---------------------------------------------------------------------------*/
+
+#include <IrreversibleReaction.hxx>
+#include <ReversibleReaction.hxx>
+#include <ArrheniusReactionRate.hxx>
+#include <thirdBodyArrheniusReactionRate.hxx>
+#include <FallOffReactionRate.hxx>
+#include <LindemannFallOffFunction.hxx>
+#include <TroeFallOffFunction.hxx>
+#include <SRIFallOffFunction.hxx>
+#include <DynamicList.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	/*---------------------------------------------------------------------------*\
+							   Class reactionKernel Declaration
+	\*---------------------------------------------------------------------------*/
+
+	template<class ThermoType>
+	class reactionKernel
+	{
+		// Private Data
+
+			//- Reactions
+		const PtrList<Reaction<ThermoType>>& reactions_;
+
+		//- Reactions evaluated from the tables
+		DynamicList<label> kernelReactions_;
+
+		//- Reactions evaluated by their own omega function
+		DynamicList<label> otherReactions_;
+
+
+		// Rates of the reactions of the tables
+
+			//- Whether the reaction is reversible
+		DynamicList<bool> reversible_;
+
+		//- Arrhenius rate of the forward rate or of the low-pressure limit
+		//  of the fall-off rate
+		DynamicList<label> k0_;
+
+		//- Arrhenius rate of the high-pressure limit of the fall-off rate,
+		//  -1 if the rate is not fall-off
+		DynamicList<label> kInf_;
+
+		//- Third-body concentration, -1 if none
+		DynamicList<label> M_;
+
+		//- Fall-off function, -1 for Lindemann, otherwise the index in
+		//  troe_ or sri_
+		DynamicList<label> F_;
+
+		//- Whether the fall-off function is Troe rather than SRI
+		DynamicList<bool> troeF_;
+
+		//- Troe fall-off functions
+		DynamicList<const TroeFallOffFunction*> troe_;
+
+		//- SRI fall-off functions
+		DynamicList<const SRIFallOffFunction*> sri_;
+
+
+		// Arrhenius rates
+
+			//- Pre-exponential factor
+		DynamicList<scalar> A_;
+
+		//- Temperature exponent
+		DynamicList<scalar> beta_;
+
+		//- Activation temperature
+		DynamicList<scalar> Ta_;
+
+		//- Lower temperature limit of the reaction
+		DynamicList<scalar> Tlow_;
+
+		//- Upper temperature limit of the reaction
+		DynamicList<scalar> Thigh_;
+
+
+		// Third-body efficiencies
+
+			//- Start of the efficiencies of each third-body concentration
+		DynamicList<label> MStart_;
+
+		//- Species of the efficiencies which differ from one
+		DynamicList<label> MSpecie_;
+
+		//- Efficiencies minus one
+		DynamicList<scalar> MEfficiency_;
+
+
+		// Reaction sides
+
+			//- Start of the species of the left-hand side of each reaction
+		DynamicList<label> lhsStart_;
+
+		//- Species of the left-hand sides
+		DynamicList<label> lhsSpecie_;
+
+		//- Stoichiometric coefficients of the left-hand sides
+		DynamicList<scalar> lhsStoichCoeff_;
+
+		//- Exponents of the left-hand sides
+		DynamicList<scalar> lhsExponent_;
+
+		//- Start of the species of the right-hand side of each reaction
+		DynamicList<label> rhsStart_;
+
+		//- Species of the right-hand sides
+		DynamicList<label> rhsSpecie_;
+
+		//- Stoichiometric coefficients of the right-hand sides
+		DynamicList<scalar> rhsStoichCoeff_;
+
+		//- Exponents of the right-hand sides
+		DynamicList<scalar> rhsExponent_;
+
+
+		//- Work array of the first thread, the Arrhenius rates followed by
+		//  the third-body concentrations
+		mutable scalarField work_;
+
+		//- Work arrays of the threads other than the first
+		mutable PtrList<scalarField> threadWork_;
+
+
+		// Private Member Functions
+
+			//- Add an Arrhenius rate with the temperature limits of the
+			//  reaction and return its index
+		label addArrhenius
+		(
+			const ArrheniusReactionRate& k,
+			const Reaction<ThermoType>& R
+		);
+
+		//- Add the third-body efficiencies and return the index of the
+		//  third-body concentration
+		label addThirdBody(const List<Tuple2<label, scalar>>& efficiencies);
+
+		//- Add the rate of a reaction
+		void addRate
+		(
+			const ArrheniusReactionRate& k,
+			const Reaction<ThermoType>& R
+		);
+
+		void addRate
+		(
+			const thirdBodyArrheniusReactionRate& k,
+			const Reaction<ThermoType>& R
+		);
+
+		template<class FallOffFunction>
+		void addRate
+		(
+			const FallOffReactionRate<ArrheniusReactionRate, FallOffFunction>& k,
+			const Reaction<ThermoType>& R
+		);
+
+		//- Add the fall-off function of the last rate added
+		void addFallOffFunction(const LindemannFallOffFunction&);
+
+		void addFallOffFunction(const TroeFallOffFunction& F);
+
+		void addFallOffFunction(const SRIFallOffFunction& F);
+
+		//- Add the reaction to the tables if it is irreversible or
+		//  reversible with the given rate type. Returns false otherwise.
+		template<class ReactionRate>
+		bool addReaction(const Reaction<ThermoType>& R);
+
+		//- Return the product of the concentrations of a reaction side to
+		//  the power of their exponents as Reaction::omega
+		inline static scalar concentrationProduct
+		(
+			const label start,
+			const label end,
+			const UList<label>& specie,
+			const UList<scalar>& exponent,
+			const scalarField& c
+		);
+
+		//- Return the work array of the calling thread
+		inline scalarField& work() const;
+
+
+	public:
+
+		// Constructors
+
+			//- Construct from the reactions
+		reactionKernel(const PtrList<Reaction<ThermoType>>& reactions);
+
+		//- Disallow default bitwise copy construction
+		reactionKernel(const reactionKernel&) = delete;
+
+
+		// Member Functions
+
+			//- Return the number of reactions evaluated from the tables
+		label nKernelReactions() const
+		{
+			return kernelReactions_.size();
+		}
+
+		//- Construct the work arrays for the given number of threads
+		void setNThreads(const label nThreads) const;
+
+		//- Add the rates of change of the concentrations of all the
+		//  reactions to dcdt
+		void omega
+		(
+			const scalar p,
+			const scalar T,
+			const scalarField& c,
+			scalarField& dcdt
+		) const;
+
+
+		// Member Operators
+
+			//- Disallow default bitwise assignment
+		void operator=(const reactionKernel&) = delete;
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#include <reactionKernelI.hxx>
+#include <reactionKernel_Imp.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_reactionKernel_Header
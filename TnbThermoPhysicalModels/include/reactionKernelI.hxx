@@ -0,0 +1,53 @@
+#pragma once
+#include <threadLoop.hxx>
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+template<class ThermoType>
+inline tnbLib::scalar
+tnbLib::reactionKernel<ThermoType>::concentrationProduct
+(
+	const label start,
+	const label end,
+	const UList<label>& specie,
+	const UList<scalar>& exponent,
+	const scalarField& c
+)
+{
+	scalar cp = 1;
+	label sRef = start;
+
+	for (label s = start; s < end; s++)
+	{
+		const scalar cs = max(c[specie[s]], 0);
+
+		cp *= exponent[s] == 1 ? cs : pow(cs, exponent[s]);
+
+		if (c[specie[s]] < c[specie[sRef]])
+		{
+			sRef = s;
+		}
+	}
+
+	// The rate of a reaction of order below one in its limiting species is
+	// cut off at a small concentration of this species
+	if (exponent[sRef] < 1 && max(c[specie[sRef]], 0) <= small)
+	{
+		return 0;
+	}
+
+	return cp;
+}
+
+
+template<class ThermoType>
+inline tnbLib::scalarField&
+tnbLib::reactionKernel<ThermoType>::work() const
+{
+	const label threadi = threadLoop::threadIndex();
+
+	return threadi && threadWork_.size() ? threadWork_[threadi - 1] : work_;
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,301 @@
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+    \\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+     \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+    This file is part of OpenFOAM.
+
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+
+Application
+    Test-chemistryBenchmark
+
+Description
+    Batch 0-D reactor benchmark of the chemistry integration.
+
+    The given number of independent cells, each an adiabatic constant
+    pressure reactor, are integrated by the chemistry model and solver of
+    constant/chemistryProperties for the given number of steps. The cells
+    form a single row mesh constructed in memory with one empty patch so
+    that the case only needs system/controlDict,
+    system/chemistryBenchmarkDict, the thermophysical properties and
+    mechanism in constant and the T, p and Ydefault fields in 0 with the
+    boundary type empty. As in chemFoam the energy of the thermophysical
+    properties must be the sensible enthalpy.
+
+    The initial temperature and pressure of every cell are drawn uniformly
+    from the given ranges and its composition is a random mixture of the
+    compositions Y0 and Y1, see the example chemistryBenchmarkDict. The
+    number of cells integrated per second of clock time of the chemistry
+    solution is reported, followed by the statistics of the chemistry model
+    and solver: the steps, Jacobian evaluations and LU time of the ODE
+    solver and the cells reduced and retrieved from the table of TDAC.
+
+\*---------------------------------------------------------------------------*/
+
+#include <includeAllModules.hxx>
+
+#include <fvCFD.hxx>
+#include <emptyPolyPatch.hxx>
+#include <rhoReactionThermo.hxx>
+#include <BasicChemistryModelTemplate.hxx>
+#include <Random.hxx>
+#include <clockTime.hxx>
+
+using namespace tnbLib;
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+// Construct a row of nCells unit hexahedra along x with all the boundary
+// faces in a single empty patch
+autoPtr<fvMesh> createRowMesh(const Time& runTime, const label nCells)
+{
+    pointField points(4*(nCells + 1));
+
+    for (label i = 0; i <= nCells; i++)
+    {
+        points[4*i] = point(i, 0, 0);
+        points[4*i + 1] = point(i, 1, 0);
+        points[4*i + 2] = point(i, 1, 1);
+        points[4*i + 3] = point(i, 0, 1);
+    }
+
+    const label nInternalFaces = nCells - 1;
+
+    faceList faces(nInternalFaces + 4*nCells + 2);
+    labelList owner(faces.size());
+    labelList neighbour(nInternalFaces);
+
+    label facei = 0;
+
+    for (label i = 0; i < nInternalFaces; i++)
+    {
+        const label p = 4*(i + 1);
+
+        faces[facei] = face(labelList({p, p + 1, p + 2, p + 3}));
+        owner[facei] = i;
+        neighbour[facei] = i + 1;
+        facei++;
+    }
+
+    for (label i = 0; i < nCells; i++)
+    {
+        const label p = 4*i;
+        const label q = 4*(i + 1);
+
+        faces[facei] = face(labelList({p, q, q + 3, p + 3}));
+        owner[facei++] = i;
+
+        faces[facei] = face(labelList({p + 1, p + 2, q + 2, q + 1}));
+        owner[facei++] = i;
+
+        faces[facei] = face(labelList({p, p + 1, q + 1, q}));
+        owner[facei++] = i;
+
+        faces[facei] = face(labelList({p + 3, q + 3, q + 2, p + 2}));
+        owner[facei++] = i;
+    }
+
+    faces[facei] = face(labelList({0, 3, 2, 1}));
+    owner[facei++] = 0;
+
+    const label p = 4*nCells;
+    faces[facei] = face(labelList({p, p + 1, p + 2, p + 3}));
+    owner[facei++] = nCells - 1;
+
+    autoPtr<fvMesh> meshPtr
+    (
+        new fvMesh
+        (
+            IOobject
+            (
+                fvMesh::defaultRegion,
+                runTime.timeName(),
+                runTime,
+                IOobject::NO_READ
+            ),
+            move(points),
+            move(faces),
+            move(owner),
+            move(neighbour)
+        )
+    );
+
+    List<polyPatch*> patches(1);
+    patches[0] = new emptyPolyPatch
+    (
+        "boundary",
+        4*nCells + 2,
+        nInternalFaces,
+        0,
+        meshPtr().boundaryMesh(),
+        emptyPolyPatch::typeName
+    );
+    meshPtr().addFvPatches(patches);
+
+    return meshPtr;
+}
+
+
+// Return the range (min max) looked up from the dictionary
+scalarList range(const dictionary& dict, const word& name)
+{
+    const scalarList r(dict.lookup(name));
+
+    if (r.size() != 2)
+    {
+        FatalIOErrorInFunction(dict)
+            << name << " should be a range (min max)" << exit(FatalIOError);
+    }
+
+    return r;
+}
+
+
+int main(int argc, char* argv[])
+{
+    #include <setRootCase.lxx>
+    #include <createTime.lxx>
+
+    const IOdictionary benchmarkDict
+    (
+        IOobject
+        (
+            "chemistryBenchmarkDict",
+            runTime.system(),
+            runTime,
+            IOobject::MUST_READ,
+            IOobject::NO_WRITE
+        )
+    );
+
+    const label nCells(readLabel(benchmarkDict.lookup("nCells")));
+    const label nSteps(readLabel(benchmarkDict.lookup("nSteps")));
+    const scalar deltaT(readScalar(benchmarkDict.lookup("deltaT")));
+    const scalarList Trange(range(benchmarkDict, "T"));
+    const scalarList prange(range(benchmarkDict, "p"));
+    const dictionary& Y0Dict = benchmarkDict.subDict("Y0");
+    const dictionary& Y1Dict = benchmarkDict.subDict("Y1");
+
+    Info<< "Constructing a row of " << nCells << " cells" << nl << endl;
+
+    autoPtr<fvMesh> meshPtr(createRowMesh(runTime, nCells));
+    fvMesh& mesh = meshPtr();
+
+    autoPtr<rhoReactionThermo> pThermo(rhoReactionThermo::New(mesh));
+    rhoReactionThermo& thermo = pThermo();
+
+    autoPtr<BasicChemistryModel<rhoReactionThermo>> pChemistry
+    (
+        BasicChemistryModel<rhoReactionThermo>::New(thermo)
+    );
+    BasicChemistryModel<rhoReactionThermo>& chemistry = pChemistry();
+
+    basicSpecieMixture& composition = thermo.composition();
+    PtrList<volScalarField>& Y = composition.Y();
+
+    // Initial state of the cells
+    {
+        Random rndGen(benchmarkDict.lookupOrDefault<label>("seed", 0));
+
+        scalarField& T = thermo.T().primitiveFieldRef();
+        scalarField& p = thermo.p().primitiveFieldRef();
+
+        forAll(T, celli)
+        {
+            T[celli] = Trange[0] + rndGen.scalar01()*(Trange[1] - Trange[0]);
+            p[celli] = prange[0] + rndGen.scalar01()*(prange[1] - prange[0]);
+
+            const scalar f = rndGen.scalar01();
+
+            forAll(Y, i)
+            {
+                const word& name = composition.species()[i];
+
+                Y[i].primitiveFieldRef()[celli] =
+                    (1 - f)*Y0Dict.lookupOrDefault<scalar>(name, 0)
+                  + f*Y1Dict.lookupOrDefault<scalar>(name, 0);
+            }
+        }
+
+        thermo.he() = thermo.he(thermo.p(), thermo.T());
+        thermo.correct();
+    }
+
+    runTime.setDeltaT(deltaT);
+
+    Info<< "Integrating " << nCells << " cells for " << nSteps
+        << " steps of " << deltaT << " s" << nl << endl;
+
+    chemistry.resetStatistics();
+
+    scalar solveTime = 0;
+
+    for (label stepi = 0; stepi < nSteps; stepi++)
+    {
+        runTime++;
+
+        const clockTime timer;
+
+        const scalar deltaTChem = chemistry.solve(deltaT);
+
+        solveTime += timer.elapsedTime();
+
+        // Advance the adiabatic constant pressure reactors. As in chemFoam
+        // the heat released is added to the sensible enthalpy.
+        const volScalarField rho(thermo.rho());
+
+        thermo.he().primitiveFieldRef() +=
+            deltaT*chemistry.Qdot()().primitiveField()/rho.primitiveField();
+
+        forAll(Y, i)
+        {
+            scalarField& Yi = Y[i].primitiveFieldRef();
+            const scalarField& RRi = chemistry.RR(i);
+
+            forAll(Yi, celli)
+            {
+                Yi[celli] = max(Yi[celli] + deltaT*RRi[celli]/rho[celli], 0);
+            }
+        }
+
+        thermo.correct();
+
+        Info<< "Step " << stepi + 1
+            << ": T min/max = " << min(thermo.T()).value()
+            << ", " << max(thermo.T()).value()
+            << ", minimum chemical time step = " << deltaTChem << endl;
+    }
+
+    const scalar nCellSteps = scalar(nCells)*nSteps;
+
+    Info<< nl << "Chemistry " << chemistry.type() << nl
+        << "    cells integrated  " << nCellSteps << nl
+        << "    clock time        " << solveTime << " s" << nl
+        << "    cells/s           " << nCellSteps/max(solveTime, small)
+        << nl;
+
+    chemistry.writeStatistics(Info);
+
+    Info<< "\nEnd\n" << endl;
+
+    return 0;
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,144 @@
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+    \\  /    A nd           | Copyright (C) 2019 OpenFOAM Foundation
+     \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+    This file is part of OpenFOAM.
+
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Application
+    Test-chemkinCache
+
+Description
+    Write/read-back test of the mechanism cache of chemkinReader.
+
+    The CHEMKIN files named in constant/thermophysicalProperties, which must
+    have a CHEMKINCache entry, are loaded twice. The cache is removed first,
+    so the first load parses the CHEMKIN files and writes the cache and the
+    second reads it. The thermodynamic data and reactions of the two loads
+    must be written identically, and in parallel identically to those of
+    the master.
+
+\*---------------------------------------------------------------------------*/
+
+#include <includeAllModules.hxx>
+
+#include <argList.hxx>
+#include <Time.hxx>
+#include <IOdictionary.hxx>
+#include <OStringStream.hxx>
+#include <chemkinReader.hxx>
+
+using namespace tnbLib;
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+// Load the mechanism and return its thermodynamic data, in the order of the
+// species, and reactions as written
+string load(const dictionary& thermoDict)
+{
+    speciesTable species;
+    chemkinReader reader(thermoDict, species);
+
+    OStringStream os;
+
+    forAll(reader.species(), i)
+    {
+        reader.speciesThermo()[reader.species()[i]]->write(os);
+    }
+
+    reader.reactions().write(os);
+
+    Info<< "    " << reader.species().size() << " species, "
+        << reader.reactions().size() << " reactions" << endl;
+
+    return os.str();
+}
+
+
+int main(int argc, char *argv[])
+{
+#include <setRootCase.lxx>
+#include <createTime.lxx>
+
+    const IOdictionary thermoDict
+    (
+        IOobject
+        (
+            "thermophysicalProperties",
+            runTime.constant(),
+            runTime,
+            IOobject::MUST_READ,
+            IOobject::NO_WRITE,
+            false
+        )
+    );
+
+    // Relative to the file of the dictionary, as in chemkinReader
+    const fileName relPath(thermoDict.dictionary::name().path());
+
+    fileName cacheFile(fileName(thermoDict.lookup("CHEMKINCache")).expand());
+
+    if (relPath.size() && !cacheFile.isAbsolute())
+    {
+        cacheFile = relPath/cacheFile;
+    }
+
+    if (Pstream::master() && isFile(cacheFile))
+    {
+        Info<< "Removing " << cacheFile << endl;
+        rm(cacheFile);
+    }
+
+    Info<< nl << "Parsing the CHEMKIN files" << endl;
+    const string parsed(load(thermoDict));
+
+    if (Pstream::master() && !isFile(cacheFile))
+    {
+        FatalErrorInFunction
+            << "The cache " << cacheFile << " has not been written"
+            << exit(FatalError);
+    }
+
+    Info<< nl << "Reading the cache" << endl;
+    const string cached(load(thermoDict));
+
+    string masterCached(cached);
+    Pstream::scatter(masterCached);
+
+    const bool same = returnReduce
+    (
+        cached == parsed && cached == masterCached,
+        andOp<bool>()
+    );
+
+    if (!same)
+    {
+        FatalErrorInFunction
+            << "The mechanism read from the cache " << cacheFile
+            << " differs from that parsed from the CHEMKIN files"
+            << exit(FatalError);
+    }
+
+    Info<< nl << "end" << endl;
+
+    return 0;
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,281 @@
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+    \\  /    A nd           | Copyright (C) 2019 OpenFOAM Foundation
+     \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+    This file is part of OpenFOAM.
+
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Application
+    Test-fvMeshRenumber
+
+Description
+    Write/read-back test of the in-memory renumbering of fvMesh.
+
+    The mesh is renumbered, by the renumber sub-dictionary of the controlDict
+    or else by reverse Cuthill-McKee, and the cell centres, a flux and the
+    face area magnitudes are written at the next time. The written fields are
+    compared with the geometry of the mesh read from disk without
+    renumbering and read back into the renumbered mesh. The flux changes
+    sign on the faces flipped by the renumbering and the face area magnitudes
+    do not. The mesh itself must not have been written.
+
+\*---------------------------------------------------------------------------*/
+
+#include <includeAllModules.hxx>
+
+#include <fvCFD.hxx>
+#include <bandCompression.hxx>
+#include <IFstream.hxx>
+
+using namespace tnbLib;
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+// Return the maximum difference between two fields relative to the maximum
+// magnitude of the second
+template<class Type>
+scalar maxDiff(const Field<Type>& a, const Field<Type>& b)
+{
+    if (a.empty())
+    {
+        return 0;
+    }
+
+    return max(mag(a - b))/max(max(mag(b)), small);
+}
+
+
+// Read the internal field of the given field file of the current time
+template<class Type>
+tmp<Field<Type>> readInternalField
+(
+    const Time& runTime,
+    const word& name,
+    const label size
+)
+{
+    IFstream is(runTime.timePath()/name);
+    const dictionary dict(is);
+
+    return tmp<Field<Type>>(new Field<Type>("internalField", dict, size));
+}
+
+
+// Fail if the relative difference exceeds the round-off of the written
+// values
+void check(const word& what, const scalar diff)
+{
+    const scalar tol = 1e-5;
+
+    Info<< "    " << what << ": max relative difference " << diff << endl;
+
+    if (diff > tol)
+    {
+        FatalErrorInFunction
+            << what << " differs by " << diff << " > " << tol
+            << exit(FatalError);
+    }
+}
+
+
+int main(int argc, char* argv[])
+{
+#include <setRootCase.lxx>
+
+#include <createTime.lxx>
+#include <createMesh.lxx>
+
+    if (!mesh.renumbered())
+    {
+        labelList cellOrder(bandCompression(mesh.cellCells()));
+        reverse(cellOrder);
+        mesh.renumber(cellOrder);
+    }
+
+    const vector U(1, 2, 3);
+
+    runTime++;
+
+    volVectorField Ctest
+    (
+        IOobject
+        (
+            "Ctest",
+            runTime.timeName(),
+            mesh,
+            IOobject::NO_READ,
+            IOobject::AUTO_WRITE
+        ),
+        mesh.C()
+    );
+
+    surfaceScalarField phiTest
+    (
+        IOobject
+        (
+            "phiTest",
+            runTime.timeName(),
+            mesh,
+            IOobject::NO_READ,
+            IOobject::AUTO_WRITE
+        ),
+        mesh.Sf() & U
+    );
+
+    surfaceScalarField magSfTest
+    (
+        IOobject
+        (
+            "magSfTest",
+            runTime.timeName(),
+            mesh,
+            IOobject::NO_READ,
+            IOobject::AUTO_WRITE
+        ),
+        mesh.magSf()
+    );
+
+    if (!phiTest.oriented() || magSfTest.oriented())
+    {
+        FatalErrorInFunction
+            << "The flux must be oriented and the face area magnitudes not"
+            << exit(FatalError);
+    }
+
+    Info<< "Flipped "
+        << returnReduce
+           (
+               findIndices(mesh.ioFlipMap(), true).size(),
+               sumOp<label>()
+           )
+        << " internal faces" << endl;
+
+    runTime.writeNow();
+
+    Info<< "Checking the mesh files of time " << runTime.timeName() << endl;
+
+    if (isFile(runTime.timePath()/polyMesh::meshSubDir/"faces"))
+    {
+        FatalErrorInFunction
+            << "The renumbered mesh has been written to "
+            << runTime.timePath()/polyMesh::meshSubDir
+            << exit(FatalError);
+    }
+
+
+    Info<< "Checking the fields against the mesh on disk" << endl;
+
+    polyMesh ioMesh
+    (
+        IOobject
+        (
+            polyMesh::defaultRegion,
+            runTime.timeName(),
+            runTime,
+            IOobject::MUST_READ,
+            IOobject::NO_WRITE,
+            false
+        )
+    );
+
+    const label nIoFaces = ioMesh.nInternalFaces();
+
+    check
+    (
+        "cell centres",
+        maxDiff
+        (
+            readInternalField<vector>(runTime, "Ctest", ioMesh.nCells())(),
+            ioMesh.cellCentres()
+        )
+    );
+
+    check
+    (
+        "flux",
+        maxDiff
+        (
+            readInternalField<scalar>(runTime, "phiTest", nIoFaces)(),
+            scalarField
+            (
+                SubField<vector>(ioMesh.faceAreas(), nIoFaces) & U
+            )
+        )
+    );
+
+    check
+    (
+        "face area magnitudes",
+        maxDiff
+        (
+            readInternalField<scalar>(runTime, "magSfTest", nIoFaces)(),
+            scalarField(mag(SubField<vector>(ioMesh.faceAreas(), nIoFaces)))
+        )
+    );
+
+
+    Info<< "Checking the fields read back into the renumbered mesh" << endl;
+
+    const volVectorField Cread
+    (
+        IOobject
+        (
+            "Ctest",
+            runTime.timeName(),
+            mesh,
+            IOobject::MUST_READ,
+            IOobject::NO_WRITE,
+            false
+        ),
+        mesh
+    );
+
+    const surfaceScalarField phiRead
+    (
+        IOobject
+        (
+            "phiTest",
+            runTime.timeName(),
+            mesh,
+            IOobject::MUST_READ,
+            IOobject::NO_WRITE,
+            false
+        ),
+        mesh
+    );
+
+    check
+    (
+        "cell centres",
+        maxDiff(Cread.primitiveField(), Ctest.primitiveField())
+    );
+
+    check
+    (
+        "flux",
+        maxDiff(phiRead.primitiveField(), phiTest.primitiveField())
+    );
+
+    Info<< "end" << endl;
+
+    return 0;
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,286 @@
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+    \\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+     \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+    This file is part of OpenFOAM.
+
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Application
+    Test-renumber
+
+Description
+    Benchmark of the effect of the cell ordering on the throughput of the
+    matrix-vector product (Amul), the Gauss gradient (fvc::grad) and, if
+    constant/particleProperties is present, solid particle tracking
+    (Cloud::move).
+
+    The mesh is renumbered in memory in turn with each of the methods
+    given, the default being the original order, Cuthill-McKee and the
+    Hilbert and Morton space-filling curves, and the clock time of the
+    kernels is reported for each ordering.
+
+    Usage: Test-renumber [-nIter 100] [-nMove 10]
+        [-methods '(none CuthillMcKee hilbert morton)']
+
+\*---------------------------------------------------------------------------*/
+
+#include <includeAllModules.hxx>
+
+#include <fvCFD.hxx>
+#include <renumberMethod.hxx>
+#include <solidParticleCloud.hxx>
+#include <clockTime.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+// Return the renumberMethod dictionary for the benchmark method name
+dictionary methodDict(const word& name)
+{
+    dictionary dict;
+
+    if (name == "hilbert" || name == "morton")
+    {
+        dict.add("method", "spaceFillingCurve");
+
+        dictionary coeffs;
+        coeffs.add("curve", name);
+        dict.add("spaceFillingCurveCoeffs", coeffs);
+    }
+    else
+    {
+        dict.add("method", name);
+    }
+
+    return dict;
+}
+
+
+// Return the maximum distance between the owner and neighbour of the
+// internal faces
+label bandwidth(const fvMesh& mesh)
+{
+    const labelUList& own = mesh.owner();
+    const labelUList& nei = mesh.neighbour();
+
+    label band = 0;
+    forAll(nei, facei)
+    {
+        band = max(band, nei[facei] - own[facei]);
+    }
+
+    return returnReduce(band, maxOp<label>());
+}
+
+
+int main(int argc, char* argv[])
+{
+    argList::addOption
+    (
+        "methods",
+        "wordList",
+        "renumber methods to compare, "
+        "default is '(none CuthillMcKee hilbert morton)'"
+    );
+    argList::addOption
+    (
+        "nIter",
+        "label",
+        "number of Amul and fvc::grad evaluations, default is 100"
+    );
+    argList::addOption
+    (
+        "nMove",
+        "label",
+        "number of Cloud::move calls, default is 10"
+    );
+
+#include <setRootCase.lxx>
+#include <createTime.lxx>
+#include <createMesh.lxx>
+    runTime.functionObjects().off();
+
+    wordList methods(4);
+    methods[0] = "none";
+    methods[1] = "CuthillMcKee";
+    methods[2] = "hilbert";
+    methods[3] = "morton";
+    args.optionReadIfPresent("methods", methods);
+
+    const label nIter = args.optionLookupOrDefault<label>("nIter", 100);
+    const label nMove = args.optionLookupOrDefault<label>("nMove", 10);
+
+    const bool moveParticles = IOobject
+    (
+        "particleProperties",
+        runTime.constant(),
+        mesh,
+        IOobject::MUST_READ,
+        IOobject::NO_WRITE,
+        false
+    ).typeHeaderOk<IOdictionary>(true);
+
+    Info<< "Cells:" << returnReduce(mesh.nCells(), sumOp<label>())
+        << " nIter:" << nIter;
+    if (moveParticles)
+    {
+        Info<< " nMove:" << nMove;
+    }
+    Info<< nl << endl;
+
+    forAll(methods, methodi)
+    {
+        const word& name = methods[methodi];
+
+        if (name != "none")
+        {
+            const dictionary dict(methodDict(name));
+            autoPtr<renumberMethod> method = renumberMethod::New(dict);
+
+            mesh.renumber(method().renumber(mesh, mesh.cellCentres()));
+        }
+
+        Info<< name << nl
+            << "    bandwidth         : " << bandwidth(mesh) << endl;
+
+        volScalarField T
+        (
+            IOobject
+            (
+                "T",
+                runTime.timeName(),
+                mesh,
+                IOobject::NO_READ,
+                IOobject::NO_WRITE
+            ),
+            mag(mesh.C())
+        );
+
+        // Matrix-vector product
+        {
+            fvScalarMatrix TEqn(fvm::laplacian(T));
+
+            const lduInterfaceFieldPtrsList interfaces
+            (
+                T.boundaryField().scalarInterfaces()
+            );
+
+            scalarField ATpsi(mesh.nCells());
+            scalarField psi(T.primitiveField());
+
+            clockTime timer;
+            for (label iter = 0; iter < nIter; iter++)
+            {
+                TEqn.Amul
+                (
+                    ATpsi,
+                    tmp<scalarField>(psi),
+                    TEqn.boundaryCoeffs(),
+                    interfaces,
+                    0
+                );
+            }
+
+            Info<< "    Amul              : " << timer.elapsedTime()
+                << " s" << endl;
+        }
+
+        // Gradient
+        {
+            clockTime timer;
+            for (label iter = 0; iter < nIter; iter++)
+            {
+                volVectorField gradT(fvc::grad(T));
+            }
+
+            Info<< "    fvc::grad         : " << timer.elapsedTime()
+                << " s" << endl;
+        }
+
+        // Particle tracking through a uniform flow with one particle per
+        // cell starting at the cell centres
+        if (moveParticles)
+        {
+            const boundBox bb(mesh.points());
+
+            volScalarField rho
+            (
+                IOobject("rho", runTime.timeName(), mesh),
+                mesh,
+                dimensionedScalar(dimDensity, 1)
+            );
+            volScalarField nu
+            (
+                IOobject("nu", runTime.timeName(), mesh),
+                mesh,
+                dimensionedScalar(dimViscosity, 1e-5)
+            );
+            volVectorField U
+            (
+                IOobject("U", runTime.timeName(), mesh),
+                mesh,
+                dimensionedVector
+                (
+                    dimVelocity,
+                    0.1*bb.span()/runTime.deltaTValue()
+                )
+            );
+
+            const dimensionedVector g(dimAcceleration, Zero);
+
+            double moveTime = 0;
+
+            for (label iter = 0; iter < nMove; iter++)
+            {
+                solidParticleCloud particles(mesh, "benchmarkCloud", false);
+
+                forAll(mesh.cells(), celli)
+                {
+                    particles.addParticle
+                    (
+                        new solidParticle
+                        (
+                            mesh,
+                            barycentric(1, 0, 0, 0),
+                            celli,
+                            mesh.cells()[celli][0],
+                            1,
+                            1e-4,
+                            Zero
+                        )
+                    );
+                }
+
+                clockTime timer;
+                particles.move(g);
+                moveTime += timer.elapsedTime();
+            }
+
+            Info<< "    Cloud::move       : " << moveTime << " s" << endl;
+        }
+
+        Info<< endl;
+    }
+
+    Info<< "End\n" << endl;
+
+    return 0;
+}
+
+
+// ************************************************************************* //
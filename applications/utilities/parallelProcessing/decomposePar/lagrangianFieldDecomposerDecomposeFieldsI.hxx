@@ -3,6 +3,7 @@
 // .cxx
 
 #include <IOobjectList.hxx>
+#include <cloudColumns.hxx>
 
 // * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
 
@@ -20,12 +21,22 @@ void tnbLib::lagrangianFieldDecomposer::readFields
         lagrangianObjects.lookupClass(IOField<Type>::typeName)
     );
 
+    // and for the fields held in the columns file
+    autoPtr<cloudColumns> columnsPtr(cloudColumns::New(lagrangianObjects));
+
+    const wordList columnNames
+    (
+        columnsPtr.valid()
+      ? columnsPtr->columnNames<Type>(lagrangianObjects)
+      : wordList()
+    );
+
     lagrangianFields.set
     (
         cloudI,
         new PtrList<IOField<Type>>
         (
-            lagrangianTypeObjects.size()
+            lagrangianTypeObjects.size() + columnNames.size()
             )
     );
 
@@ -38,6 +49,15 @@ void tnbLib::lagrangianFieldDecomposer::readFields
             new IOField<Type>(*iter())
         );
     }
+
+    forAll(columnNames, i)
+    {
+        lagrangianFields[cloudI].set
+        (
+            lagrangianFieldi++,
+            columnsPtr->readField<Type>(columnNames[i]).ptr()
+        );
+    }
 }
 
 
@@ -89,6 +89,7 @@ Usage
 #include <symmTensorIOField.hxx>
 #include <tensorIOField.hxx>
 #include <passiveParticleCloud.hxx>
+#include <cloudColumns.hxx>
 #include <faceSet.hxx>
 #include <stringListOps.hxx>
 #include <wordRe.hxx>
@@ -134,6 +135,62 @@ void print(Ostream& os, const wordList& flds)
 }
 
 
+// Return the names of the lagrangian fields of the given type in files of
+// their own and in the columns file of the cloud
+template<class Type>
+wordList cloudFieldNames
+(
+    const IOobjectList& cloudObjects,
+    const autoPtr<cloudColumns>& columnsPtr
+)
+{
+    wordList names(cloudObjects.names(IOField<Type>::typeName));
+
+    if (columnsPtr.valid())
+    {
+        names.append(columnsPtr->columnNames<Type>(cloudObjects));
+    }
+
+    return names;
+}
+
+
+// Read a lagrangian field from its own file or else from the columns file
+// of the cloud
+template<class Type>
+tmp<Field<Type>> readCloudField
+(
+    const fvMesh& mesh,
+    const word& cloudName,
+    const IOobjectList& cloudObjects,
+    autoPtr<cloudColumns>& columnsPtr,
+    const word& fieldName
+)
+{
+    if (columnsPtr.valid() && !cloudObjects.lookup(fieldName))
+    {
+        return columnsPtr->readColumn<Type>(fieldName);
+    }
+
+    return tmp<Field<Type>>
+    (
+        new IOField<Type>
+        (
+            IOobject
+            (
+                fieldName,
+                mesh.time().timeName(),
+                cloud::prefix/cloudName,
+                mesh,
+                IOobject::MUST_READ,
+                IOobject::NO_WRITE,
+                false
+            )
+        )
+    );
+}
+
+
 tnbLib::labelList getSelectedPatches
 (
     const polyBoundaryMesh& patches,
@@ -1251,15 +1308,29 @@ int main(int argc, char *argv[])
 
                 Info<< "    Lagrangian: " << lagrFileName << endl;
 
-                wordList labelNames(sprayObjs.names(labelIOField::typeName));
+                autoPtr<cloudColumns> columnsPtr
+                (
+                    cloudColumns::New(sprayObjs)
+                );
+
+                wordList labelNames
+                (
+                    cloudFieldNames<label>(sprayObjs, columnsPtr)
+                );
                 Info<< "        labels            :";
                 print(Info, labelNames);
 
-                wordList scalarNames(sprayObjs.names(scalarIOField::typeName));
+                wordList scalarNames
+                (
+                    cloudFieldNames<scalar>(sprayObjs, columnsPtr)
+                );
                 Info<< "        scalars           :";
                 print(Info, scalarNames);
 
-                wordList vectorNames(sprayObjs.names(vectorIOField::typeName));
+                wordList vectorNames
+                (
+                    cloudFieldNames<vector>(sprayObjs, columnsPtr)
+                );
                 Info<< "        vectors           :";
                 print(Info, vectorNames);
 
@@ -1360,19 +1431,18 @@ int main(int argc, char *argv[])
                 // labelFields
                 forAll(labelNames, i)
                 {
-                    IOField<label> fld
+                    const tmp<Field<label>> tfld
                     (
-                        IOobject
+                        readCloudField<label>
                         (
-                            labelNames[i],
-                            mesh.time().timeName(),
-                            cloud::prefix/cloudDirs[cloudI],
                             mesh,
-                            IOobject::MUST_READ,
-                            IOobject::NO_WRITE,
-                            false
+                            cloudDirs[cloudI],
+                            sprayObjs,
+                            columnsPtr,
+                            labelNames[i]
                         )
                     );
+                    const Field<label>& fld = tfld();
 
                     scalarField sfld(fld.size());
                     forAll(fld, j)
@@ -1384,37 +1454,35 @@ int main(int argc, char *argv[])
                 // scalarFields
                 forAll(scalarNames, i)
                 {
-                    IOField<scalar> fld
+                    const tmp<Field<scalar>> tfld
                     (
-                        IOobject
+                        readCloudField<scalar>
                         (
-                            scalarNames[i],
-                            mesh.time().timeName(),
-                            cloud::prefix/cloudDirs[cloudI],
                             mesh,
-                            IOobject::MUST_READ,
-                            IOobject::NO_WRITE,
-                            false
+                            cloudDirs[cloudI],
+                            sprayObjs,
+                            columnsPtr,
+                            scalarNames[i]
                         )
                     );
+                    const Field<scalar>& fld = tfld();
                     writer.writeField(fld);
                 }
                 // vectorFields
                 forAll(vectorNames, i)
                 {
-                    IOField<vector> fld
+                    const tmp<Field<vector>> tfld
                     (
-                        IOobject
+                        readCloudField<vector>
                         (
-                            vectorNames[i],
-                            mesh.time().timeName(),
-                            cloud::prefix/cloudDirs[cloudI],
                             mesh,
-                            IOobject::MUST_READ,
-                            IOobject::NO_WRITE,
-                            false
+                            cloudDirs[cloudI],
+                            sprayObjs,
+                            columnsPtr,
+                            vectorNames[i]
                         )
                     );
+                    const Field<vector>& fld = tfld();
                     writer.writeField(fld);
                 }
 
@@ -95,6 +95,15 @@ namespace tnbLib
 			return "Arrhenius";
 		}
 
+		//- Return the pre-exponential factor
+		inline scalar A() const;
+
+		//- Return the temperature exponent
+		inline scalar temperatureExponent() const;
+
+		//- Return the activation temperature
+		inline scalar Ta() const;
+
 		inline scalar operator()
 			(
 				const scalar p,
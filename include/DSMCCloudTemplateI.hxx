@@ -1,5 +1,6 @@
 #pragma once
 #include <constants.hxx>
+#include <threadLoop.hxx>
 
 using namespace tnbLib::constant;
 using namespace tnbLib::constant::mathematical;
@@ -44,10 +45,15 @@ inline tnbLib::scalar tnbLib::DSMCCloud<ParcelType>::nParticle() const
 
 
 template<class ParcelType>
-inline const tnbLib::List<tnbLib::DynamicList<ParcelType*>>&
-tnbLib::DSMCCloud<ParcelType>::cellOccupancy() const
+inline const tnbLib::SubList<ParcelType*>
+tnbLib::DSMCCloud<ParcelType>::cellParcels(const label celli) const
 {
-	return cellOccupancy_;
+	return SubList<ParcelType*>
+	(
+		cellParcels_,
+		cellParcelStart_[celli + 1] - cellParcelStart_[celli],
+		cellParcelStart_[celli]
+	);
 }
 
 
@@ -96,7 +102,12 @@ tnbLib::DSMCCloud<ParcelType>::constProps
 template<class ParcelType>
 inline tnbLib::Random& tnbLib::DSMCCloud<ParcelType>::rndGen()
 {
-	return rndGen_;
+	const label threadi = threadLoop::threadIndex();
+
+	return
+		threadi && threadRndGen_.size()
+	  ? threadRndGen_[threadi - 1]
+	  : rndGen_;
 }
 
 
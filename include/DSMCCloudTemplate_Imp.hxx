@@ -9,6 +9,8 @@
 #include <Time.hxx>  // added by amir
 #include <OFstream.hxx>  // added by amir
 
+#include <algorithm>
+
 using namespace tnbLib::constant;
 
 // * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
@@ -41,14 +43,28 @@ void tnbLib::DSMCCloud<ParcelType>::buildConstProps()
 template<class ParcelType>
 void tnbLib::DSMCCloud<ParcelType>::buildCellOccupancy()
 {
-	forAll(cellOccupancy_, cO)
+	// Count the parcels of each cell
+	cellParcelStart_.setSize(mesh_.nCells() + 1);
+	cellParcelStart_ = 0;
+
+	forAllConstIter(typename DSMCCloud<ParcelType>, *this, iter)
+	{
+		cellParcelStart_[iter().cell() + 1]++;
+	}
+
+	for (label celli = 0; celli < mesh_.nCells(); celli++)
 	{
-		cellOccupancy_[cO].clear();
+		cellParcelStart_[celli + 1] += cellParcelStart_[celli];
 	}
 
+	// Place the parcels after those of the preceding cells
+	cellParcels_.setSize(this->size());
+
+	labelList cellParceli(SubList<label>(cellParcelStart_, mesh_.nCells()));
+
 	forAllIter(typename DSMCCloud<ParcelType>, *this, iter)
 	{
-		cellOccupancy_[iter().cell()].append(&iter());
+		cellParcels_[cellParceli[iter().cell()]++] = &iter();
 	}
 }
 
@@ -189,150 +205,188 @@ void tnbLib::DSMCCloud<ParcelType>::collisions()
 		return;
 	}
 
-	// Temporary storage for subCells
-	List<DynamicList<label>> subCells(8);
-
-	scalar deltaT = mesh().time().deltaTValue();
+	const scalar deltaT = mesh().time().deltaTValue();
 
-	label collisionCandidates = 0;
+	// Construct the demand-driven mesh data before the threads start
+	const vectorField& cellCentres = mesh_.cellCentres();
+	const scalarField& cellVolumes = mesh_.cellVolumes();
 
-	label collisions = 0;
+	const label nThreads = threadLoop::nThreadsFor(cellParcels_.size(), 1000);
 
-	forAll(cellOccupancy_, celli)
+	threadRndGen_.setSize(nThreads - 1);
+	forAll(threadRndGen_, i)
 	{
-		const DynamicList<ParcelType*>& cellParcels(cellOccupancy_[celli]);
+		threadRndGen_.set(i, new Random(rndGen_.sampleAB<label>(0, labelMax)));
+	}
 
-		label nC(cellParcels.size());
+	labelList threadCollisionCandidates(nThreads, 0);
+	labelList threadCollisions(nThreads, 0);
 
-		if (nC > 1)
+	// The sorted parcels rather than the cells are split between the threads
+	// so that the threads have similar numbers of candidates. Each thread
+	// takes the cells whose parcels start within its chunk.
+	threadLoop::run
+	(
+		cellParcels_.size(),
+		nThreads,
+		[&](const label threadi, const label start, const label end)
 		{
-			// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-			// Assign particles to one of 8 Cartesian subCells
+			Random& rndGen = this->rndGen();
 
-			// Clear temporary lists
-			forAll(subCells, i)
-			{
-				subCells[i].clear();
-			}
+			const label cellStart =
+				std::lower_bound
+				(
+					cellParcelStart_.begin(),
+					cellParcelStart_.end() - 1,
+					start
+				) - cellParcelStart_.begin();
 
-			// Inverse addressing specifying which subCell a parcel is in
-			List<label> whichSubCell(cellParcels.size());
+			const label cellEnd =
+				std::lower_bound
+				(
+					cellParcelStart_.begin(),
+					cellParcelStart_.end() - 1,
+					end
+				) - cellParcelStart_.begin();
+
+			// Temporary storage for subCells
+			List<DynamicList<label>> subCells(8);
 
-			const point& cC = mesh_.cellCentres()[celli];
+			// Inverse addressing specifying which subCell a parcel is in
+			DynamicList<label> whichSubCell;
 
-			forAll(cellParcels, i)
+			for (label celli = cellStart; celli < cellEnd; celli++)
 			{
-				const ParcelType& p = *cellParcels[i];
-				vector relPos = p.position() - cC;
+				const SubList<ParcelType*> cellParcels(this->cellParcels(celli));
 
-				label subCell =
-					pos0(relPos.x()) + 2 * pos0(relPos.y()) + 4 * pos0(relPos.z());
+				label nC(cellParcels.size());
 
-				subCells[subCell].append(i);
-				whichSubCell[i] = subCell;
-			}
+				if (nC < 2)
+				{
+					continue;
+				}
 
-			// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+				// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+				// Assign particles to one of 8 Cartesian subCells
 
-			scalar sigmaTcRMax = sigmaTcRMax_[celli];
+				// Clear temporary lists
+				forAll(subCells, i)
+				{
+					subCells[i].clear();
+				}
 
-			scalar selectedPairs =
-				collisionSelectionRemainder_[celli]
-				+ 0.5*nC*(nC - 1)*nParticle_*sigmaTcRMax*deltaT
-				/ mesh_.cellVolumes()[celli];
+				whichSubCell.setSize(nC);
 
-			label nCandidates(selectedPairs);
-			collisionSelectionRemainder_[celli] = selectedPairs - nCandidates;
-			collisionCandidates += nCandidates;
+				const point& cC = cellCentres[celli];
 
-			for (label c = 0; c < nCandidates; c++)
-			{
-				// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-				// subCell candidate selection procedure
+				forAll(cellParcels, i)
+				{
+					const ParcelType& p = *cellParcels[i];
+					vector relPos = p.position() - cC;
 
-				// Select the first collision candidate
-				label candidateP = rndGen_.sampleAB<label>(0, nC);
+					label subCell =
+						pos0(relPos.x()) + 2 * pos0(relPos.y())
+					  + 4 * pos0(relPos.z());
 
-				// Declare the second collision candidate
-				label candidateQ = -1;
+					subCells[subCell].append(i);
+					whichSubCell[i] = subCell;
+				}
 
-				List<label> subCellPs = subCells[whichSubCell[candidateP]];
-				label nSC = subCellPs.size();
+				// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
-				if (nSC > 1)
-				{
-					// If there are two or more particle in a subCell, choose
-					// another from the same cell.  If the same candidate is
-					// chosen, choose again.
+				scalar sigmaTcRMax = sigmaTcRMax_[celli];
 
-					do
-					{
-						candidateQ = subCellPs[rndGen_.sampleAB<label>(0, nSC)];
-					} while (candidateP == candidateQ);
-				}
-				else
-				{
-					// Select a possible second collision candidate from the
-					// whole cell.  If the same candidate is chosen, choose
-					// again.
+				scalar selectedPairs =
+					collisionSelectionRemainder_[celli]
+					+ 0.5*nC*(nC - 1)*nParticle_*sigmaTcRMax*deltaT
+					/ cellVolumes[celli];
 
-					do
-					{
-						candidateQ = rndGen_.sampleAB<label>(0, nC);
-					} while (candidateP == candidateQ);
-				}
+				label nCandidates(selectedPairs);
+				collisionSelectionRemainder_[celli] =
+					selectedPairs - nCandidates;
+				threadCollisionCandidates[threadi] += nCandidates;
 
-				// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-				// uniform candidate selection procedure
+				for (label c = 0; c < nCandidates; c++)
+				{
+					// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+					// subCell candidate selection procedure
 
-				// // Select the first collision candidate
-				// label candidateP = rndGen_.sampleAB<label>(0, nC);
+					// Select the first collision candidate
+					label candidateP = rndGen.sampleAB<label>(0, nC);
 
-				// // Select a possible second collision candidate
-				// label candidateQ = rndGen_.sampleAB<label>(0, nC);
+					// Declare the second collision candidate
+					label candidateQ = -1;
 
-				// // If the same candidate is chosen, choose again
-				// while (candidateP == candidateQ)
-				// {
-				//     candidateQ = rndGen_.sampleAB<label>(0, nC);
-				// }
+					const DynamicList<label>& subCellPs =
+						subCells[whichSubCell[candidateP]];
+					label nSC = subCellPs.size();
 
-				// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+					if (nSC > 1)
+					{
+						// If there are two or more particle in a subCell,
+						// choose another from the same cell.  If the same
+						// candidate is chosen, choose again.
+
+						do
+						{
+							candidateQ =
+								subCellPs[rndGen.sampleAB<label>(0, nSC)];
+						} while (candidateP == candidateQ);
+					}
+					else
+					{
+						// Select a possible second collision candidate from
+						// the whole cell.  If the same candidate is chosen,
+						// choose again.
 
-				ParcelType& parcelP = *cellParcels[candidateP];
-				ParcelType& parcelQ = *cellParcels[candidateQ];
+						do
+						{
+							candidateQ = rndGen.sampleAB<label>(0, nC);
+						} while (candidateP == candidateQ);
+					}
 
-				scalar sigmaTcR = binaryCollision().sigmaTcR
-				(
-					parcelP,
-					parcelQ
-				);
+					// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
-				// Update the maximum value of sigmaTcR stored, but use the
-				// initial value in the acceptance-rejection criteria because
-				// the number of collision candidates selected was based on this
+					ParcelType& parcelP = *cellParcels[candidateP];
+					ParcelType& parcelQ = *cellParcels[candidateQ];
 
-				if (sigmaTcR > sigmaTcRMax_[celli])
-				{
-					sigmaTcRMax_[celli] = sigmaTcR;
-				}
-
-				if ((sigmaTcR / sigmaTcRMax) > rndGen_.scalar01())
-				{
-					binaryCollision().collide
+					scalar sigmaTcR = binaryCollision().sigmaTcR
 					(
 						parcelP,
 						parcelQ
 					);
 
-					collisions++;
+					// Update the maximum value of sigmaTcR stored, but use
+					// the initial value in the acceptance-rejection criteria
+					// because the number of collision candidates selected
+					// was based on this
+
+					if (sigmaTcR > sigmaTcRMax_[celli])
+					{
+						sigmaTcRMax_[celli] = sigmaTcR;
+					}
+
+					if ((sigmaTcR / sigmaTcRMax) > rndGen.scalar01())
+					{
+						binaryCollision().collide
+						(
+							parcelP,
+							parcelQ
+						);
+
+						threadCollisions[threadi]++;
+					}
 				}
 			}
 		}
-	}
+	);
+
+	threadRndGen_.clear();
 
+	label collisions = sum(threadCollisions);
 	reduce(collisions, sumOp<label>());
 
+	label collisionCandidates = sum(threadCollisionCandidates);
 	reduce(collisionCandidates, sumOp<label>());
 
 	sigmaTcRMax_.correctBoundaryConditions();
@@ -470,7 +524,8 @@ tnbLib::DSMCCloud<ParcelType>::DSMCCloud
 	),
 	typeIdList_(particleProperties_.lookup("typeIdList")),
 	nParticle_(readScalar(particleProperties_.lookup("nEquivalentParticles"))),
-	cellOccupancy_(mesh_.nCells()),
+	cellParcelStart_(),
+	cellParcels_(),
 	sigmaTcRMax_
 	(
 		IOobject
@@ -701,7 +756,8 @@ tnbLib::DSMCCloud<ParcelType>::DSMCCloud
 	),
 	typeIdList_(particleProperties_.lookup("typeIdList")),
 	nParticle_(readScalar(particleProperties_.lookup("nEquivalentParticles"))),
-	cellOccupancy_(),
+	cellParcelStart_(),
+	cellParcels_(),
 	sigmaTcRMax_
 	(
 		IOobject
@@ -1064,8 +1120,7 @@ void tnbLib::DSMCCloud<ParcelType>::autoMap(const mapPolyMesh& mapper)
 {
 	Cloud<ParcelType>::autoMap(mapper);
 
-	// Update the cell occupancy field
-	cellOccupancy_.setSize(mesh_.nCells());
+	// Update the cell occupancy
 	buildCellOccupancy();
 
 	// Update the inflow BCs
@@ -110,6 +110,10 @@ namespace tnbLib
 		//- Dimension set for this field
 		dimensionSet dimensions_;
 
+		//- Does the field change sign with the orientation of the faces,
+		//  e.g. a face flux
+		bool oriented_;
+
 
 		// Private Member Functions
 
@@ -298,6 +302,14 @@ namespace tnbLib
 		//- Return non-const access to dimensions
 		inline dimensionSet& dimensions();
 
+		//- Return true if the field changes sign with the orientation of
+		//  the faces. Set for the face area vectors and fluxes and
+		//  carried through the field algebra.
+		inline bool oriented() const;
+
+		//- Return non-const access to the orientation
+		inline bool& oriented();
+
 		inline const Field<Type>& field() const;
 
 		inline Field<Type>& field();
@@ -32,6 +32,19 @@ tnbLib::DimensionedField<Type, GeoMesh>::dimensions()
 }
 
 
+template<class Type, class GeoMesh>
+inline bool tnbLib::DimensionedField<Type, GeoMesh>::oriented() const
+{
+	return oriented_;
+}
+
+template<class Type, class GeoMesh>
+inline bool& tnbLib::DimensionedField<Type, GeoMesh>::oriented()
+{
+	return oriented_;
+}
+
+
 template<class Type, class GeoMesh>
 inline const tnbLib::Field<Type>&
 tnbLib::DimensionedField<Type, GeoMesh>::field() const
@@ -82,6 +82,35 @@ namespace tnbLib
 		}
 
 
+		// Field I/O ordering
+
+			//- Return true if the mesh elements are held in a different
+			//  order from that on disk
+		template<class Mesh>
+		static bool reordered(const Mesh&)
+		{
+			return false;
+		}
+
+		//- Convert a field read from disk into the in-memory order. The
+		//  values of oriented fields change sign on flipped faces.
+		template<class Mesh, class FieldType>
+		static void readOrder(const Mesh&, FieldType&, const bool)
+		{}
+
+		//- Return a field in the on-disk order
+		template<class Mesh, class FieldType>
+		static FieldType writeOrder
+		(
+			const Mesh&,
+			const FieldType& f,
+			const bool
+		)
+		{
+			return f;
+		}
+
+
 		// Member Operators
 
 			//- Return reference to polyMesh
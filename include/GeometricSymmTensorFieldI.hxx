@@ -13,6 +13,7 @@ namespace tnbLib
 	{
 		tnbLib::sqr(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::sqr(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -43,6 +44,7 @@ namespace tnbLib
 	{
 		tnbLib::innerSqr(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::innerSqr(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -74,6 +76,7 @@ namespace tnbLib
 	{
 		tnbLib::tr(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::tr(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -104,6 +107,7 @@ namespace tnbLib
 	{
 		tnbLib::sph(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::sph(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -136,6 +140,7 @@ namespace tnbLib
 	{
 		tnbLib::symm(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::symm(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -167,6 +172,7 @@ namespace tnbLib
 	{
 		tnbLib::twoSymm(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::twoSymm(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -199,6 +205,7 @@ namespace tnbLib
 	{
 		tnbLib::dev(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::dev(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -230,6 +237,7 @@ namespace tnbLib
 	{
 		tnbLib::dev2(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::dev2(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -260,6 +268,7 @@ namespace tnbLib
 	{
 		tnbLib::det(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::det(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -289,6 +298,7 @@ namespace tnbLib
 	{
 		tnbLib::cof(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::cof(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -320,6 +330,7 @@ namespace tnbLib
 	{
 		tnbLib::inv(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::inv(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -354,6 +365,7 @@ namespace tnbLib
 	{
 		tnbLib::hdual(res.primitiveFieldRef(), gf1.primitiveField());
 		tnbLib::hdual(res.boundaryFieldRef(), gf1.boundaryField());
+		res.oriented() = false;
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -384,6 +396,7 @@ namespace tnbLib
 	{
 		tnbLib::dot(res.primitiveFieldRef(), gf1.primitiveField(), gf2.primitiveField());
 		tnbLib::dot(res.boundaryFieldRef(), gf1.boundaryField(), gf2.boundaryField());
+		res.oriented() = gf1.oriented() != gf2.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -447,6 +460,7 @@ namespace tnbLib
 	{
 		tnbLib::dot(res.primitiveFieldRef(), dt1.value(), gf2.primitiveField());
 		tnbLib::dot(res.boundaryFieldRef(), dt1.value(), gf2.boundaryField());
+		res.oriented() = gf2.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
@@ -494,6 +508,7 @@ namespace tnbLib
 	{
 		tnbLib::dot(res.primitiveFieldRef(), gf1.primitiveField(), dt2.value());
 		tnbLib::dot(res.boundaryFieldRef(), gf1.boundaryField(), dt2.value());
+		res.oriented() = gf1.oriented();
 	}
 
 	template<template<class> class PatchField, class GeoMesh>
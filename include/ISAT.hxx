@@ -40,6 +40,27 @@ Description
 		Combustion Theory and Modelling, 1, 41-63.
 	\endverbatim
 
+	In parallel the most retrieved chemPoints can be exchanged between the
+	processors every shareInterval chemistry time steps, so that the table of
+	every processor benefits from the compositions learnt by the others. The
+	numbers of retrieves since the last exchange are gathered on the master,
+	which selects the nSharePoints chemPoints retrieved most often over all
+	the processors. Only these are sent to the master and broadcast, and each
+	processor adds those not already within the ellipsoid of accuracy of its
+	own nearest chemPoint. The exchange requires the mechanism reduction to be
+	inactive since the gradients of the chemPoints are then of the complete
+	set of species,
+	e.g.:
+	\verbatim
+	tabulation
+	{
+		method          ISAT;
+		...
+		shareInterval   10;
+		nSharePoints    200;
+	}
+	\endverbatim
+
 \*---------------------------------------------------------------------------*/
 
 #include <binaryTree.hxx>
@@ -132,10 +153,17 @@ namespace tnbLib
 			//- Number of equations in addition to the species eqs.
 			label nAdditionalEqns_;
 
+			//- Number of time steps between the exchanges of chemPoints
+			//  between the processors, 0 for none
+			label shareInterval_;
+
+			//- Number of chemPoints exchanged over all the processors
+			label nSharePoints_;
+
 
 			// Private Member Functions
 
-				//- Add a chemPoint to the MRU list
+			//- Add a chemPoint to the MRU list
 			void addToMRU(chemPointISAT<CompType, ThermoType>* phi0);
 
 			//- Compute and return the mapping of the composition phiq
@@ -169,6 +197,10 @@ namespace tnbLib
 			//- Clean and balance the tree
 			bool cleanAndBalance();
 
+			//- Exchange the most retrieved chemPoints between the processors
+			//  and add those received to the tree
+			void sharePoints();
+
 			//- Functions to construct the gradients matrix
 			//  When mechanism reduction is active, the A matrix is given by
 			//        Aaa Aad
@@ -257,10 +289,9 @@ namespace tnbLib
 				const scalar deltaT
 			);
 
-			virtual bool update()
-			{
-				return cleanAndBalance();
-			}
+			//- Clean and balance the tree and exchange the chemPoints between
+			//  the processors if required
+			virtual bool update();
 		};
 
 
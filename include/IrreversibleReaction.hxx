@@ -154,7 +154,14 @@ namespace tnbLib
 
 		// Member Functions
 
-			// IrreversibleReaction rate coefficients
+			//- Return the forward reaction rate
+		const ReactionRate& k() const
+		{
+			return k_;
+		}
+
+
+		// IrreversibleReaction rate coefficients
 
 				//- Forward rate constant
 		virtual scalar kf
@@ -5,6 +5,23 @@
 #include <PstreamReduceOps.hxx>  // added by amir
 #include <extrapolatedCalculatedFvPatchFields.hxx>  // added by amir
 
+// * * * * * * * * * * * * Protected Member Functions  * * * * * * * * * * * //
+
+template<class CloudType>
+template<class Type>
+inline tnbLib::DimensionedField<Type, tnbLib::volMesh>&
+tnbLib::KinematicCloud<CloudType>::threadField
+(
+	DimensionedField<Type, volMesh>& field,
+	PtrList<DimensionedField<Type, volMesh>>& threadFields
+)
+{
+	const label threadi = threadLoop::threadIndex();
+
+	return threadi && threadFields.size() ? threadFields[threadi - 1] : field;
+}
+
+
 // * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
 
 template<class CloudType>
@@ -337,7 +354,12 @@ inline tnbLib::scalar tnbLib::KinematicCloud<CloudType>::Dmax() const
 template<class CloudType>
 inline tnbLib::Random& tnbLib::KinematicCloud<CloudType>::rndGen() const
 {
-	return rndGen_;
+	const label threadi = threadLoop::threadIndex();
+
+	return
+		threadi && threadRndGen_.size()
+	  ? threadRndGen_[threadi - 1]
+	  : rndGen_;
 }
 
 
@@ -379,7 +401,7 @@ template<class CloudType>
 inline tnbLib::DimensionedField<tnbLib::vector, tnbLib::volMesh>&
 tnbLib::KinematicCloud<CloudType>::UTrans()
 {
-	return UTrans_();
+	return threadField(UTrans_(), threadUTrans_);
 }
 
 
@@ -395,7 +417,7 @@ template<class CloudType>
 inline tnbLib::DimensionedField<tnbLib::scalar, tnbLib::volMesh>&
 tnbLib::KinematicCloud<CloudType>::UCoeff()
 {
-	return UCoeff_();
+	return threadField(UCoeff_(), threadUCoeff_);
 }
 
 
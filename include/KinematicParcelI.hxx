@@ -665,16 +665,16 @@ void tnbLib::KinematicParcel<ParcelType>::writeFields(const CloudType& c)
 
 	const bool write = np > 0;
 
-	active.write(write);
-	typeId.write(write);
-	nParticle.write(write);
-	d.write(write);
-	dTarget.write(write);
-	U.write(write);
-	rho.write(write);
-	age.write(write);
-	tTurb.write(write);
-	UTurb.write(write);
+	c.writeField(active, write);
+	c.writeField(typeId, write);
+	c.writeField(nParticle, write);
+	c.writeField(d, write);
+	c.writeField(dTarget, write);
+	c.writeField(U, write);
+	c.writeField(rho, write);
+	c.writeField(age, write);
+	c.writeField(tTurb, write);
+	c.writeField(UTurb, write);
 }
 
 
@@ -1049,12 +1049,18 @@ bool tnbLib::KinematicParcel<ParcelType>::move
 
 		p.age() += dt;
 
-		if (p.active() && p.onFace())
+		if (cloud.functions().size())
 		{
-			cloud.functions().postFace(p, ttd.keepParticle);
-		}
+			// The cloud functions are shared by the threads of a threaded move
+			std::unique_lock<std::recursive_mutex> lock(cloud.threadLock());
+
+			if (p.active() && p.onFace())
+			{
+				cloud.functions().postFace(p, ttd.keepParticle);
+			}
 
-		cloud.functions().postMove(p, dt, start, ttd.keepParticle);
+			cloud.functions().postMove(p, dt, start, ttd.keepParticle);
+		}
 
 		if (p.active() && p.onFace() && ttd.keepParticle)
 		{
@@ -1079,6 +1085,9 @@ bool tnbLib::KinematicParcel<ParcelType>::hitPatch
 
 	const polyPatch& pp = p.mesh().boundaryMesh()[p.patch()];
 
+	// The patch models are shared by the threads of a threaded move
+	std::unique_lock<std::recursive_mutex> lock(cloud.threadLock());
+
 	// Invoke post-processing model
 	cloud.functions().postPatch(p, pp, td.keepParticle);
 
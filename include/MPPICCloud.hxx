@@ -211,6 +211,13 @@ namespace tnbLib
 		//- Evolve the cloud
 		void evolve();
 
+		//- Return false, the parcels are tracked serially as the packing
+		//  and damping models act on the cloud as a whole
+		bool threadedTracking() const
+		{
+			return false;
+		}
+
 		//- Particle motion
 		template<class TrackCloudType>
 		void motion
@@ -207,7 +207,7 @@ void tnbLib::MPPICParcel<ParcelType>::writeFields(const CloudType& c)
 		i++;
 	}
 
-	UCorrect.write(np > 0);
+	c.writeField(UCorrect, np > 0);
 }
 
 
@@ -31,12 +31,31 @@ Class
 Description
 	Abstract base-class for ODE system solvers
 
+	The stiff-system solvers factorise their implicit matrix with
+	decomposeLU() and backSubstituteLU(), which use the dense LU with partial
+	pivoting or, if sparseLU is switched on and the ODESystem returns the
+	pattern of its Jacobian, the sparse LU analysed once for this pattern:
+	\verbatim
+	odeCoeffs
+	{
+		solver          Rosenbrock34;
+		absTol          1e-12;
+		relTol          0.01;
+		sparseLU        on;
+	}
+	\endverbatim
+
+	The number of steps, Jacobian evaluations and LU decompositions and the
+	clock time of the LU decompositions and back-substitutions are counted,
+	see stats() and resetStats().
+
 SourceFiles
 	ODESolver.C
 
 \*---------------------------------------------------------------------------*/
 
 #include <ODESystem.hxx>
+#include <sparseLU.hxx>
 #include <typeInfo.hxx>
 #include <autoPtr.hxx>
 #include <runTimeSelectionTables.hxx>  // added by amir
@@ -52,6 +71,42 @@ namespace tnbLib
 
 	class ODESolver
 	{
+	public:
+
+		//- Counters of the work of the solver
+		class statistics
+		{
+		public:
+
+			//- Number of integration steps
+			label nSteps;
+
+			//- Number of evaluations of the Jacobian
+			label nJacobians;
+
+			//- Number of LU decompositions
+			label nLU;
+
+			//- Clock time of the LU decompositions and back-substitutions
+			scalar LUTime;
+
+			statistics()
+				:
+				nSteps(0),
+				nJacobians(0),
+				nLU(0),
+				LUTime(0)
+			{}
+
+			void operator+=(const statistics& s)
+			{
+				nSteps += s.nSteps;
+				nJacobians += s.nJacobians;
+				nLU += s.nLU;
+				LUTime += s.LUTime;
+			}
+		};
+
 
 	protected:
 
@@ -75,6 +130,19 @@ namespace tnbLib
 		//- The maximum number of sub-steps allowed for the integration step
 		label maxSteps_;
 
+		//- Switch to factorise with the sparse LU
+		mutable bool sparse_;
+
+		//- Sparse LU for the pattern of the Jacobian, analysed on the first
+		//  factorisation
+		mutable autoPtr<sparseLU> sparseLUPtr_;
+
+		//- Whether the last factorisation is the dense LU
+		mutable bool denseLU_;
+
+		//- Counters of the work since the last resetStats
+		mutable statistics stats_;
+
 
 		// Protected Member Functions
 
@@ -86,6 +154,32 @@ namespace tnbLib
 			const scalarField& err
 		) const;
 
+		//- Evaluate the Jacobian of the ODESystem, counting the evaluations
+		FoamODE_EXPORT void jacobian
+		(
+			const scalar x,
+			const scalarField& y,
+			scalarField& dfdx,
+			scalarSquareMatrix& dfdy
+		) const;
+
+		//- LU decompose the matrix of the implicit stiff-system solvers,
+		//  with the sparse LU if selected and otherwise or if a pivot is too
+		//  small with the dense LU
+		FoamODE_EXPORT void decomposeLU
+		(
+			scalarSquareMatrix& a,
+			labelList& pivotIndices
+		) const;
+
+		//- Solve with the last LU decomposition in place of the source
+		FoamODE_EXPORT void backSubstituteLU
+		(
+			const scalarSquareMatrix& a,
+			const labelList& pivotIndices,
+			scalarField& source
+		) const;
+
 
 	public:
 
@@ -240,6 +334,18 @@ namespace tnbLib
 
 		inline void resizeMatrix(scalarSquareMatrix& m) const;
 
+		//- Return the counters of the work since the last resetStats
+		const statistics& stats() const
+		{
+			return stats_;
+		}
+
+		//- Reset the counters of the work
+		void resetStats() const
+		{
+			stats_ = statistics();
+		}
+
 		//- Solve the ODE system as far as possible up to dxTry
 		//  adjusting the step as necessary to provide a solution within
 		//  the specified tolerance.
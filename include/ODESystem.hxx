@@ -31,10 +31,15 @@ Class
 Description
 	Abstract base class for the systems of ordinary differential equations.
 
+	A system with a sparse Jacobian may return the columns of the non-zero
+	coefficients of each row from jacobianPattern() so that the stiff-system
+	solvers can factorise their implicit matrix with the sparse LU.
+
 \*---------------------------------------------------------------------------*/
 
 #include <scalarField.hxx>
 #include <scalarMatrices.hxx>
+#include <labelList.hxx>
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
@@ -84,6 +89,10 @@ namespace tnbLib
 			scalarField& dfdx,
 			scalarSquareMatrix& dfdy
 		) const = 0;
+
+		//- Return the columns of the non-zero coefficients of each row of
+		//  the Jacobian, or an empty list, the default, if it is dense
+		FoamODE_EXPORT virtual labelListList jacobianPattern() const;
 	};
 
 
@@ -0,0 +1,198 @@
+#pragma once
+#ifndef _PengRobinsonZTable_Header
+#define _PengRobinsonZTable_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+
+Class
+	tnbLib::PengRobinsonZTable
+
+Description
+	Table of the compression factor of the Peng-Robinson equation of state.
+
+	The compression factor is the largest root of the cubic
+
+	\verbatim
+		Z^3 - (1 - B) Z^2 + (A - 2 B - 3 B^2) Z - (A B - B^2 - B^3) = 0
+	\endverbatim
+
+	which only depends on the reduced attraction A and co-volume B, so a
+	single table of Z(A, B) serves every species and every mixture. Z is
+	interpolated bilinearly on a uniform grid of [0, Amax] x [0, Bmax]. On
+	construction the interpolation is checked against the cubic at the centre
+	and edge midpoints of every cell of the grid, and the cells where it
+	differs by more than the relative tolerance, i.e. near the critical point
+	and where the largest root jumps from the liquid to the vapour branch,
+	are solved exactly, as are the points outside of the table.
+
+	The table is opt-in, constructed on first use from the optimisation
+	switches:
+
+	\verbatim
+	OptimisationSwitches
+	{
+		PengRobinsonZTable            512;
+		PengRobinsonZTableAmax        20;
+		PengRobinsonZTableBmax        2;
+		PengRobinsonZTableTolerance   1e-4;
+	}
+	\endverbatim
+
+	where PengRobinsonZTable is the number of intervals of each axis, 0 (the
+	default) to always solve the cubic.
+
+SourceFiles
+	PengRobinsonZTableI.hxx
+	PengRobinsonZTable.cxx
+
+\*---------------------------------------------------------------------------*/
+
+#include <scalarField.hxx>
+#include <boolList.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	/*---------------------------------------------------------------------------*\
+							   Class PengRobinsonZTable Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class PengRobinsonZTable
+	{
+		// Private Data
+
+			//- Number of intervals of each axis
+		label n_;
+
+		//- Inverse of the interval of A
+		scalar rDeltaA_;
+
+		//- Inverse of the interval of B
+		scalar rDeltaB_;
+
+		//- Compression factor at the points of the grid, by rows of B
+		scalarField Z_;
+
+		//- Whether the interpolation is within the tolerance in each cell
+		boolList accurate_;
+
+
+		// Private Member Functions
+
+			//- Return the bilinear interpolation in the cell of the grid at
+			//  the given fractions of the intervals
+		inline scalar interpolate
+		(
+			const label i,
+			const label j,
+			const scalar fa,
+			const scalar fb
+		) const;
+
+
+	public:
+
+		// Static Data
+
+			//- Number of intervals of each axis of the table of the
+			//  switches, 0 for none
+		static FoamThermophysicalModels_EXPORT int nIntervals;
+
+		//- Upper limit of A of the table of the switches
+		static FoamThermophysicalModels_EXPORT float Amax;
+
+		//- Upper limit of B of the table of the switches
+		static FoamThermophysicalModels_EXPORT float Bmax;
+
+		//- Relative tolerance of the interpolation of the table of the
+		//  switches
+		static FoamThermophysicalModels_EXPORT float tolerance;
+
+
+		// Constructors
+
+			//- Construct for the given number of intervals of each axis,
+			//  limits and tolerance
+		FoamThermophysicalModels_EXPORT PengRobinsonZTable
+		(
+			const label n,
+			const scalar Amax,
+			const scalar Bmax,
+			const scalar tolerance
+		);
+
+		//- Disallow default bitwise copy construction
+		PengRobinsonZTable(const PengRobinsonZTable&) = delete;
+
+
+		// Static Member Functions
+
+			//- Return the largest root of the cubic
+		static FoamThermophysicalModels_EXPORT scalar solve
+		(
+			const scalar A,
+			const scalar B
+		);
+
+		//- Return the table of the switches, nullptr if not enabled
+		static FoamThermophysicalModels_EXPORT const PengRobinsonZTable*
+			table();
+
+
+		// Member Functions
+
+			//- Return the number of intervals of each axis
+		label n() const
+		{
+			return n_;
+		}
+
+		//- Return the fraction of the cells which are interpolated
+		FoamThermophysicalModels_EXPORT scalar fractionAccurate() const;
+
+		//- Return the compression factor, interpolated if possible
+		inline scalar Z(const scalar A, const scalar B) const;
+
+
+		// Member Operators
+
+			//- Disallow default bitwise assignment
+		void operator=(const PengRobinsonZTable&) = delete;
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#include <PengRobinsonZTableI.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_PengRobinsonZTable_Header
@@ -125,6 +125,13 @@ namespace tnbLib
 		PtrList<volScalarField::Internal> rhoTrans_;
 
 
+		// Threaded tracking
+
+			//- Mass sources of the threads other than the first for each
+			//  carrier phase specie
+		List<PtrList<volScalarField::Internal>> threadRhoTrans_;
+
+
 		// Protected Member Functions
 
 			// New parcel helper functions
@@ -299,6 +306,12 @@ namespace tnbLib
 		//- Apply scaling to (transient) cloud sources
 		void scaleSources();
 
+		//- Set the per-thread sources
+		void beginThreadedMove(const label nThreads);
+
+		//- Add the per-thread sources to the cloud sources
+		void endThreadedMove();
+
 		//- Evolve the cloud
 		void evolve();
 
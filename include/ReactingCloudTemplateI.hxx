@@ -78,7 +78,10 @@ template<class CloudType>
 inline tnbLib::DimensionedField<tnbLib::scalar, tnbLib::volMesh>&
 tnbLib::ReactingCloud<CloudType>::rhoTrans(const label i)
 {
-	return rhoTrans_[i];
+	return
+		threadRhoTrans_.size()
+	  ? this->threadField(rhoTrans_[i], threadRhoTrans_[i])
+	  : rhoTrans_[i];
 }
 
 
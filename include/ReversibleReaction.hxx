@@ -151,7 +151,14 @@ namespace tnbLib
 
 		// Member Functions
 
-			// ReversibleReaction rate coefficients
+			//- Return the forward reaction rate
+		const ReactionRate& k() const
+		{
+			return k_;
+		}
+
+
+		// ReversibleReaction rate coefficients
 
 				//- Forward rate constant
 		virtual scalar kf
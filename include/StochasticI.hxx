@@ -175,12 +175,23 @@ void tnbLib::IsotropyModels::Stochastic<CloudType>::calculate()
 		)
 	);
 	AveragingMethod<vector>& uTildeAverage = uTildeAveragePtr();
-	forAllIter(typename CloudType, this->owner(), iter)
+
+	const label nParcels = this->owner().size();
+	List<barycentric> coordinates(nParcels);
+	List<tetIndices> tetIs(nParcels);
+	vectorField momenta(nParcels);
 	{
-		typename CloudType::parcelType& p = iter();
-		const tetIndices tetIs(p.currentTetIndices());
-		uTildeAverage.add(p.coordinates(), tetIs, p.nParticle()*p.mass()*p.U());
+		label parceli = 0;
+		forAllIter(typename CloudType, this->owner(), iter)
+		{
+			typename CloudType::parcelType& p = iter();
+			coordinates[parceli] = p.coordinates();
+			tetIs[parceli] = p.currentTetIndices();
+			momenta[parceli] = p.nParticle()*p.mass()*p.U();
+			parceli++;
+		}
 	}
+	uTildeAverage.add(coordinates, tetIs, momenta);
 	uTildeAverage.average(massAverage);
 
 	autoPtr<AveragingMethod<scalar>> uTildeSqrAveragePtr
@@ -198,18 +209,23 @@ void tnbLib::IsotropyModels::Stochastic<CloudType>::calculate()
 		)
 	);
 	AveragingMethod<scalar>& uTildeSqrAverage = uTildeSqrAveragePtr();
-	forAllIter(typename CloudType, this->owner(), iter)
+	scalarField uTildeSqrs(nParcels);
 	{
-		typename CloudType::parcelType& p = iter();
-		const tetIndices tetIs(p.currentTetIndices());
-		const vector uTilde = uTildeAverage.interpolate(p.coordinates(), tetIs);
-		uTildeSqrAverage.add
-		(
-			p.coordinates(),
-			tetIs,
-			p.nParticle()*p.mass()*magSqr(p.U() - uTilde)
-		);
+		label parceli = 0;
+		forAllIter(typename CloudType, this->owner(), iter)
+		{
+			typename CloudType::parcelType& p = iter();
+			const vector uTilde =
+				uTildeAverage.interpolate
+				(
+					coordinates[parceli],
+					tetIs[parceli]
+				);
+			uTildeSqrs[parceli] = p.nParticle()*p.mass()*magSqr(p.U() - uTilde);
+			parceli++;
+		}
 	}
+	uTildeSqrAverage.add(coordinates, tetIs, uTildeSqrs);
 	uTildeSqrAverage.average(massAverage);
 
 	// conservation correction
@@ -143,6 +143,20 @@ namespace tnbLib
 		autoPtr<volScalarField::Internal> hsCoeff_;
 
 
+		// Threaded tracking
+
+			//- Radiation fields of the threads other than the first
+		PtrList<volScalarField::Internal> threadRadAreaP_;
+		PtrList<volScalarField::Internal> threadRadT4_;
+		PtrList<volScalarField::Internal> threadRadAreaPT4_;
+
+		//- Enthalpy sources of the threads other than the first
+		PtrList<volScalarField::Internal> threadHsTrans_;
+
+		//- hs equation coefficients of the threads other than the first
+		PtrList<volScalarField::Internal> threadHsCoeff_;
+
+
 		// Protected Member Functions
 
 			 // Initialisation
@@ -347,6 +361,12 @@ namespace tnbLib
 		//- Apply scaling to (transient) cloud sources
 		void scaleSources();
 
+		//- Set the per-thread sources
+		void beginThreadedMove(const label nThreads);
+
+		//- Add the per-thread sources to the cloud sources
+		void endThreadedMove();
+
 		//- Pre-evolve
 		void preEvolve();
 
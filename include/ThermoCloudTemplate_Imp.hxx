@@ -427,6 +427,40 @@ void tnbLib::ThermoCloud<CloudType>::scaleSources()
 }
 
 
+template<class CloudType>
+void tnbLib::ThermoCloud<CloudType>::beginThreadedMove(const label nThreads)
+{
+	CloudType::beginThreadedMove(nThreads);
+
+	this->setThreadFields(hsTrans_(), threadHsTrans_, nThreads);
+	this->setThreadFields(hsCoeff_(), threadHsCoeff_, nThreads);
+
+	if (radiation_)
+	{
+		this->setThreadFields(radAreaP_(), threadRadAreaP_, nThreads);
+		this->setThreadFields(radT4_(), threadRadT4_, nThreads);
+		this->setThreadFields(radAreaPT4_(), threadRadAreaPT4_, nThreads);
+	}
+}
+
+
+template<class CloudType>
+void tnbLib::ThermoCloud<CloudType>::endThreadedMove()
+{
+	this->addThreadFields(hsTrans_(), threadHsTrans_);
+	this->addThreadFields(hsCoeff_(), threadHsCoeff_);
+
+	if (radiation_)
+	{
+		this->addThreadFields(radAreaP_(), threadRadAreaP_);
+		this->addThreadFields(radT4_(), threadRadT4_);
+		this->addThreadFields(radAreaPT4_(), threadRadAreaPT4_);
+	}
+
+	CloudType::endThreadedMove();
+}
+
+
 template<class CloudType>
 void tnbLib::ThermoCloud<CloudType>::preEvolve()
 {
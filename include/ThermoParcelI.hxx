@@ -339,8 +339,8 @@ void tnbLib::ThermoParcel<ParcelType>::writeFields(const CloudType& c)
 		i++;
 	}
 
-	T.write(np > 0);
-	Cp.write(np > 0);
+	c.writeField(T, np > 0);
+	c.writeField(Cp, np > 0);
 }
 
 
@@ -183,6 +183,15 @@ namespace tnbLib
 		//- Return the heat release rate [kg/m/s^3]
 		FoamThermophysicalModels_EXPORT virtual tmp<volScalarField> Qdot() const = 0;
 
+		//- Reset the counters of the work of the chemistry solution
+		virtual void resetStatistics()
+		{}
+
+		//- Write the counters of the work of the chemistry solution since
+		//  the last resetStatistics
+		virtual void writeStatistics(Ostream& os) const
+		{}
+
 
 		// Member Operators
 
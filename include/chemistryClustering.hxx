@@ -0,0 +1,192 @@
+#pragma once
+#ifndef _chemistryClustering_Header
+#define _chemistryClustering_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+	tnbLib::chemistryClustering
+
+Description
+	Grouping of the cells of similar thermochemical state so that only one
+	representative cell of each cluster is integrated by the chemistry
+	model.
+
+	Every solve the cells are binned by their temperature, the logarithms
+	of their pressure and time step and their mass fractions, quantised by
+	the tolerances TTolerance [K], pTolerance (relative, also applied to
+	the time step) and YTolerance (absolute). The first cell of every bin is
+	its representative. After the integration the change of the mass
+	fractions of the representative over its time step is applied to the
+	other cells of the cluster over theirs, limited so that no mass
+	fraction becomes negative, and their chemical time step is set to that
+	of the representative.
+
+	\verbatim
+	clustering
+	{
+		active          on;
+		TTolerance      1;
+		pTolerance      1e-3;
+		YTolerance      1e-4;
+	}
+	\endverbatim
+
+SourceFiles
+	chemistryClustering.cxx
+	chemistryClustering_Imp.hxx
+
+\*---------------------------------------------------------------------------*/
+
+#include <volFields.hxx>
+#include <Switch.hxx>
+#include <Hasher.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	/*---------------------------------------------------------------------------*\
+							   Class chemistryClustering Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class chemistryClustering
+	{
+		// Private Data
+
+			//- Cluster the cells
+		Switch active_;
+
+		//- Temperature bin width [K]
+		scalar TTolerance_;
+
+		//- Relative pressure and time step bin width
+		scalar pTolerance_;
+
+		//- Mass fraction bin width
+		scalar YTolerance_;
+
+		//- Representative cell of every cell of the last clustering, the
+		//  cell itself for the representatives
+		labelList representative_;
+
+		//- Number of clusters of the last clustering
+		label nClusters_;
+
+
+		//- Hash of the bins of a cell
+		class binHash
+		{
+		public:
+
+			unsigned operator()(const labelList& key) const
+			{
+				return Hasher(key.cdata(), key.byteSize());
+			}
+		};
+
+
+		// Private Member Functions
+
+			//- Return the bin of a value
+		inline static label bin(const scalar x, const scalar tolerance);
+
+
+	public:
+
+		// Constructors
+
+			//- Construct from the clustering dictionary
+		FoamThermophysicalModels_EXPORT chemistryClustering
+		(
+			const dictionary& dict
+		);
+
+		//- Disallow default bitwise copy construction
+		chemistryClustering(const chemistryClustering&) = delete;
+
+
+		// Member Functions
+
+			//- Return true if the cells are clustered
+		bool active() const
+		{
+			return active_;
+		}
+
+		//- Return the number of clusters of the last clustering
+		label nClusters() const
+		{
+			return nClusters_;
+		}
+
+		//- Return true if the cell is to be integrated, i.e. it is the
+		//  representative of its cluster or the cells are not clustered
+		inline bool integrated(const label celli) const;
+
+		//- Cluster the cells by their thermochemical state
+		template<class DeltaTType>
+		void cluster
+		(
+			const PtrList<volScalarField>& Y,
+			const scalarField& T,
+			const scalarField& p,
+			const DeltaTType& deltaT
+		);
+
+		//- Set the reaction rates and chemical time steps of the cells
+		//  which are not integrated from those of their representatives.
+		//  The mass fraction increments are scaled by a single factor
+		//  to keep the mass fractions of the cell non-negative.
+		template<class DeltaTType>
+		void map
+		(
+			const PtrList<volScalarField>& Y,
+			const scalarField& rho,
+			const DeltaTType& deltaT,
+			PtrList<volScalarField::Internal>& RR,
+			scalarField& deltaTChem
+		) const;
+
+
+		// Member Operators
+
+			//- Disallow default bitwise assignment
+		void operator=(const chemistryClustering&) = delete;
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#include <chemistryClusteringI.hxx>
+#include <chemistryClustering_Imp.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_chemistryClustering_Header
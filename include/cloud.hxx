@@ -45,6 +45,7 @@ namespace tnbLib
 
 	// Forward declaration of classes
 	class mapPolyMesh;
+	class mapDistributePolyMesh;
 
 	/*---------------------------------------------------------------------------*\
 								Class cloud Declaration
@@ -70,6 +71,10 @@ namespace tnbLib
 		//- The default cloud name: %defaultCloud
 		static FoamBase_EXPORT word defaultName;
 
+		//- Number of time steps between the sorting of the particles by
+		//  cell, 0 for no sorting
+		static FoamBase_EXPORT int sortInterval;
+
 
 		// Constructors
 
@@ -92,6 +97,17 @@ namespace tnbLib
 				//  mesh topology change
 		FoamBase_EXPORT virtual void autoMap(const mapPolyMesh&);
 
+		//- Hold back the particles ahead of a redistribution of the mesh
+		//  so that they are left untouched by its topology changes
+		FoamBase_EXPORT virtual void beginDistribute();
+
+		//- Send the held back particles to the processors their cells
+		//  have been distributed to and add them back to the cloud
+		FoamBase_EXPORT virtual void distribute(const mapDistributePolyMesh&);
+
+		//- Add the number of particles in each cell to nParticles
+		FoamBase_EXPORT virtual void countParticles(labelList& nParticles) const;
+
 
 		// Member Operators
 
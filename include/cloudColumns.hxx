@@ -0,0 +1,241 @@
+#pragma once
+#ifndef _cloudColumns_Header
+#define _cloudColumns_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+	tnbLib::cloudColumns
+
+Description
+	Single binary file holding the fields of a cloud as typed columns.
+
+	The file starts with the number of rows, the number of rows per chunk
+	and the name, type and element size of every column, followed by the
+	data of the columns one after the other, each split into chunks of
+	rows written as binary blocks. The file is always written in binary
+	format and compressed if the time write compression is on.
+
+	Columns are added with add() and written together with write().
+	When constructed for reading only the table of contents is read, the
+	columns are read on demand with readColumn() by streaming forward
+	through the file and skipping the chunks of the columns which are not
+	asked for, so that a subset of the columns can be read without holding
+	the others in memory.
+
+	Writing the fields of the clouds into a columns file rather than one
+	file per field is selected by the optimisation switch cloudColumns and
+	the number of rows per chunk by cloudColumnsChunkSize.
+
+	Readers which find the fields of a cloud directory by class in an
+	IOobjectList (decomposePar, reconstructPar, foamToTecplot360) add the
+	columns with New, columnNames and readField.
+
+SourceFiles
+	cloudColumns.cxx
+	cloudColumnsI.hxx
+
+\*---------------------------------------------------------------------------*/
+
+#include <regIOobject.hxx>
+#include <IOField.hxx>
+#include <IOobjectList.hxx>
+#include <DynamicList.hxx>
+#include <PtrList.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	/*---------------------------------------------------------------------------*\
+							  Class cloudColumns Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class cloudColumns
+		:
+		public regIOobject
+	{
+		// Private Data
+
+			//- Number of rows
+		label nRows_;
+
+		//- Number of rows per chunk
+		label chunkSize_;
+
+		//- Names of the columns
+		DynamicList<word> names_;
+
+		//- Types of the columns
+		DynamicList<word> types_;
+
+		//- Sizes in bytes of the elements of the columns
+		DynamicList<label> sizes_;
+
+		//- Data of the columns added for writing
+		PtrList<List<char>> data_;
+
+		//- Column at which the open stream is positioned
+		label nextColumn_;
+
+
+		// Private Member Functions
+
+			//- Open the stream and read the table of contents
+		void readTOC();
+
+		//- Read the chunks of a column into the given buffer, skipping the
+		//  columns in between
+		FoamLagrangian_EXPORT void readChunks(const label columni, char* buf);
+
+
+	public:
+
+		//- Runtime type information
+		//TypeName("cloudColumns");
+		static const char* typeName_() { return "cloudColumns"; }
+		static FoamLagrangian_EXPORT const ::tnbLib::word typeName;
+		static FoamLagrangian_EXPORT int debug;
+		virtual const word& type() const { return typeName; };
+
+
+		// Static Data
+
+			//- Write the fields of the clouds into a columns file
+			//  (optimisation switch cloudColumns)
+		static FoamLagrangian_EXPORT bool active;
+
+		//- Number of rows per chunk written
+		//  (optimisation switch cloudColumnsChunkSize)
+		static FoamLagrangian_EXPORT int defaultChunkSize;
+
+
+		// Constructors
+
+			//- Construct from IOobject, reading the table of contents if
+			//  required
+		FoamLagrangian_EXPORT explicit cloudColumns(const IOobject& io);
+
+		//- Disallow default bitwise copy construction
+		FoamLagrangian_EXPORT cloudColumns(const cloudColumns&) = delete;
+
+
+		// Selectors
+
+			//- Return the columns file of the given objects of a cloud
+			//  directory for reading, or an empty pointer if there is none
+		static FoamLagrangian_EXPORT autoPtr<cloudColumns> New
+		(
+			const IOobjectList& cloudObjects
+		);
+
+
+		//- Destructor
+		FoamLagrangian_EXPORT virtual ~cloudColumns();
+
+
+		// Member Functions
+
+			// Access
+
+				//- Return the number of rows
+			label nRows() const
+			{
+				return nRows_;
+			}
+
+			//- Return the names of the columns
+			const DynamicList<word>& names() const
+			{
+				return names_;
+			}
+
+			//- Return the types of the columns
+			const DynamicList<word>& types() const
+			{
+				return types_;
+			}
+
+			//- Return whether there is a column of the given name
+			FoamLagrangian_EXPORT bool found(const word& name) const;
+
+			//- Return the names of the columns of the given type which
+			//  are not also in the given objects, i.e. in a file of their
+			//  own
+			template<class Type>
+			wordList columnNames(const IOobjectList& cloudObjects) const;
+
+
+			// Edit
+
+				//- Add a column to be written
+			template<class Type>
+			void add(const word& name, const UList<Type>& fld);
+
+
+			// Read
+
+				//- Read a column
+			template<class Type>
+			tmp<Field<Type>> readColumn(const word& name);
+
+			//- Read a column as an IOField of the cloud directory
+			template<class Type>
+			autoPtr<IOField<Type>> readField(const word& name);
+
+
+			// Write
+
+				//- Write the table of contents and the chunks of the columns
+			FoamLagrangian_EXPORT virtual bool writeData(Ostream&) const;
+
+			//- Write in binary format with the given version and compression
+			FoamLagrangian_EXPORT virtual bool writeObject
+			(
+				IOstream::streamFormat,
+				IOstream::versionNumber,
+				IOstream::compressionType,
+				const bool write
+			) const;
+
+
+		// Member Operators
+
+			//- Disallow default bitwise assignment
+		void operator=(const cloudColumns&) = delete;
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#include <cloudColumnsI.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_cloudColumns_Header
@@ -0,0 +1,72 @@
+#pragma once
+// * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * * //
+
+template<class Type>
+void tnbLib::dynamicLoadBalanceFvMesh::storeInternalFields
+(
+	PtrList<GeometricField<Type, fvPatchField, volMesh>>& flds
+) const
+{
+	typedef DimensionedField<Type, volMesh> InternalField;
+	typedef GeometricField<Type, fvPatchField, volMesh> VolField;
+
+	// Sorted so that the fields are created in the same order on all
+	// processors
+	const wordList names(sortedNames(InternalField::typeName));
+
+	flds.setSize(names.size());
+
+	forAll(names, i)
+	{
+		const InternalField& fld = lookupObject<InternalField>(names[i]);
+
+		flds.set
+		(
+			i,
+			new VolField
+			(
+				IOobject
+				(
+					fld.name() + ":distribute",
+					time().timeName(),
+					*this,
+					IOobject::NO_READ,
+					IOobject::NO_WRITE
+				),
+				*this,
+				dimensioned<Type>("zero", fld.dimensions(), Zero)
+			)
+		);
+
+		flds[i].primitiveFieldRef() = fld.field();
+	}
+}
+
+
+template<class Type>
+void tnbLib::dynamicLoadBalanceFvMesh::restoreInternalFields
+(
+	PtrList<GeometricField<Type, fvPatchField, volMesh>>& flds
+)
+{
+	typedef DimensionedField<Type, volMesh> InternalField;
+
+	forAll(flds, i)
+	{
+		const word& name = flds[i].name();
+		const word fldName(name.substr(0, name.rfind(':')));
+
+		// Fields which are recreated by their owners on topology change,
+		// e.g. the cell volumes, are no longer registered
+		if (foundObject<InternalField>(fldName))
+		{
+			lookupObjectRef<InternalField>(fldName).field() =
+				flds[i].primitiveField();
+		}
+	}
+
+	flds.clear();
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,199 @@
+#pragma once
+#ifndef _exactPatchDistMethod_Header
+#define _exactPatchDistMethod_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+	tnbLib::patchDistMethods::exact
+
+Description
+	Exact distance to the nearest patch face for all cells and boundary
+	faces, found by geometric search.
+
+	The distance is found by a nearest query in an octree of the patch
+	faces, which is exact on distorted meshes and needs no iteration or
+	processor sweeps. In parallel each processor first bounds its
+	distances using its own patch faces and a small set of patch points
+	gathered from all processors. The samples of each processor are binned
+	into sub-boxes of their bounding box, and each processor then receives
+	only those remote patch faces which may be nearer to any of its
+	sub-boxes than the largest bound of the samples in it, so that a few
+	distant samples do not widen the search of the whole processor. The
+	queries are threaded over the nThreads optimisation switch.
+
+	Example of the wallDist specification in fvSchemes:
+	\verbatim
+		wallDist
+		{
+			method exact;
+
+			// Optional entry enabling the calculation
+			// of the normal-to-wall field
+			nRequired false;
+
+			// Optional number of patch points per processor used to bound
+			// the search, default 16
+			nSamples 16;
+
+			// Optional number of divisions in each direction of the
+			// bounding box of the samples of a processor into search
+			// regions, default 4
+			nDivisions 4;
+		}
+	\endverbatim
+
+See also
+	tnbLib::patchDistMethod::meshWave
+	tnbLib::wallDist
+
+SourceFiles
+	exactPatchDistMethod.C
+
+\*---------------------------------------------------------------------------*/
+
+#include <patchDistMethod.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+	namespace patchDistMethods
+	{
+
+		/*---------------------------------------------------------------------------*\
+								  Class exact Declaration
+		\*---------------------------------------------------------------------------*/
+
+		class exact
+			:
+			public patchDistMethod
+		{
+			// Private Member Data
+
+				//- Number of patch points per processor used to bound the
+				//  search
+			const label nSamples_;
+
+			//- Number of divisions in each direction of the bounding box of
+			//  the samples of a processor into search regions
+			const label nDivisions_;
+
+			//- Number of unset cells and faces.
+			mutable label nUnset_;
+
+
+			// Private Member Functions
+
+				//- Update the distance, and optionally the normal, of the
+				//  sample points nearer to the given faces than dist
+			static void nearest
+			(
+				const faceList& faces,
+				const pointField& points,
+				const pointField& samples,
+				scalarField& dist,
+				vectorField* normalPtr
+			);
+
+			//- Return the remote patch faces, compacted to their own
+			//  points, which may be nearer to any of the sample points
+			//  than the local distance
+			void remotePatchFaces
+			(
+				const faceList& localFaces,
+				const pointField& localPoints,
+				const pointField& samples,
+				const scalarField& dist,
+				faceList& faces,
+				pointField& points
+			) const;
+
+			//- Calculate the distance and optionally the normal to the
+			//  nearest patch face for the sample points
+			void calculate
+			(
+				const pointField& samples,
+				scalarField& dist,
+				vectorField* normalPtr
+			) const;
+
+			//- Correct the distance and optionally the normal fields
+			bool correct(volScalarField& y, volVectorField* nPtr);
+
+
+		public:
+
+			//- Runtime type information
+			/*TypeName("exact");*/
+			static const char* typeName_() { return "exact"; }
+			static FoamFiniteVolume_EXPORT const ::tnbLib::word typeName;
+			static FoamFiniteVolume_EXPORT int debug;
+			virtual const word& type() const { return typeName; };
+
+
+			// Constructors
+
+				//- Construct from coefficients dictionary, mesh
+				//  and fixed-value patch set
+			FoamFiniteVolume_EXPORT exact
+			(
+				const dictionary& dict,
+				const fvMesh& mesh,
+				const labelHashSet& patchIDs
+			);
+
+			//- Disallow default bitwise copy construction
+			FoamFiniteVolume_EXPORT exact(const exact&) = delete;
+
+
+			// Member Functions
+
+			label nUnset() const
+			{
+				return nUnset_;
+			}
+
+			//- Correct the given distance-to-patch field
+			FoamFiniteVolume_EXPORT virtual bool correct(volScalarField& y);
+
+			//- Correct the given distance-to-patch and normal-to-patch fields
+			FoamFiniteVolume_EXPORT virtual bool correct(volScalarField& y, volVectorField& n);
+
+
+			// Member Operators
+
+			//- Disallow default bitwise assignment
+			FoamFiniteVolume_EXPORT void operator=(const exact&) = delete;
+		};
+
+
+		// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+	} // End namespace patchDistMethods
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_exactPatchDistMethod_Header
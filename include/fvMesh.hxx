@@ -42,9 +42,31 @@ Description
 	motion).  It is therefore unsafe to keep local references to the
 	derived data outside of the time loop.
 
+	The cells and internal faces may be renumbered in memory for locality
+	on construction (see renumber). Volume and surface fields are then still
+	read and written in the original (I/O) order, selected by the optional
+	renumber sub-dictionary of the controlDict, e.g.
+
+	\verbatim
+	renumber
+	{
+		// none, CuthillMcKee, reverseCuthillMcKee, hilbert, morton
+		method      CuthillMcKee;
+	}
+	\endverbatim
+
+	Faces whose owner is numbered after their neighbour are flipped, and
+	the oriented surface fields, e.g. fluxes, change sign on them on input
+	and output. The mesh files are not rewritten; after a topological
+	change the mesh and the fields are written in the new order. Cell and
+	face labels stored in other files are not translated, so the mesh is
+	not renumbered if it has sets and clouds cannot be constructed on a
+	renumbered mesh.
+
 SourceFiles
 	fvMesh.C
 	fvMeshGeometry.C
+	fvMeshRenumber.C
 
 \*---------------------------------------------------------------------------*/
 
@@ -129,6 +151,18 @@ namespace tnbLib
 		mutable surfaceScalarField* phiPtr_;
 
 
+		// In-memory renumbering
+
+			//- I/O cell label for every cell if renumbered in memory
+		autoPtr<labelList> ioCellMapPtr_;
+
+		//- I/O face label for every internal face
+		autoPtr<labelList> ioFaceMapPtr_;
+
+		//- Is every internal face flipped relative to its I/O face
+		autoPtr<boolList> ioFlipMapPtr_;
+
+
 		// Private Member Functions
 
 			// Storage management
@@ -159,6 +193,13 @@ namespace tnbLib
 		FoamFiniteVolume_EXPORT void makeCf() const;
 
 
+		// In-memory renumbering
+
+			//- Renumber according to the renumber sub-dictionary of the
+			//  controlDict if present
+		FoamFiniteVolume_EXPORT void renumberFromControlDict();
+
+
 	public:
 
 		// Public Typedefs
@@ -377,6 +418,31 @@ namespace tnbLib
 		FoamFiniteVolume_EXPORT DimensionedField<scalar, volMesh>& setV0();
 
 
+		// In-memory renumbering
+
+			//- Renumber the cells into the given order (old cell for every
+			//  new cell) and the internal faces into upper-triangular
+			//  order, flipping the faces whose owner would be numbered
+			//  after their neighbour. The mesh files are not changed and
+			//  volume and surface fields are read and written in the
+			//  original order and orientation. Has to be called before any
+			//  fields are constructed.
+		FoamFiniteVolume_EXPORT void renumber(const labelList& cellOrder);
+
+		//- Return true if the mesh has been renumbered in memory
+		inline bool renumbered() const;
+
+		//- Return the I/O cell label for every cell
+		FoamFiniteVolume_EXPORT const labelList& ioCellMap() const;
+
+		//- Return the I/O face label for every internal face
+		FoamFiniteVolume_EXPORT const labelList& ioFaceMap() const;
+
+		//- Return whether every internal face is flipped relative to its
+		//  I/O face
+		FoamFiniteVolume_EXPORT const boolList& ioFlipMap() const;
+
+
 		// Write
 
 			//- Write the underlying polyMesh and other data
@@ -13,25 +13,42 @@ void tnbLib::heRhoThermo<BasicPsiThermo, MixtureType>::calculate()
 	scalarField& muCells = this->mu_.primitiveFieldRef();
 	scalarField& alphaCells = this->alpha_.primitiveFieldRef();
 
-	forAll(TCells, celli)
+	// Evaluate the cells by blocks for the mixtures to select the species
+	// present in each block
+	for
+	(
+		label start = 0;
+		start < TCells.size();
+		start += MixtureType::cellBlockSize
+	)
 	{
-		const typename MixtureType::thermoType& mixture_ =
-			this->cellMixture(celli);
+		const label end =
+			min(start + MixtureType::cellBlockSize, TCells.size());
 
-		TCells[celli] = mixture_.THE
-		(
-			hCells[celli],
-			pCells[celli],
-			TCells[celli]
-		);
+		this->setCellBlock(start, end);
 
-		psiCells[celli] = mixture_.psi(pCells[celli], TCells[celli]);
-		rhoCells[celli] = mixture_.rho(pCells[celli], TCells[celli]);
+		for (label celli = start; celli < end; celli++)
+		{
+			const typename MixtureType::thermoType& mixture_ =
+				this->cellMixture(celli);
+
+			TCells[celli] = mixture_.THE
+			(
+				hCells[celli],
+				pCells[celli],
+				TCells[celli]
+			);
+
+			psiCells[celli] = mixture_.psi(pCells[celli], TCells[celli]);
+			rhoCells[celli] = mixture_.rho(pCells[celli], TCells[celli]);
 
-		muCells[celli] = mixture_.mu(pCells[celli], TCells[celli]);
-		alphaCells[celli] = mixture_.alphah(pCells[celli], TCells[celli]);
+			muCells[celli] = mixture_.mu(pCells[celli], TCells[celli]);
+			alphaCells[celli] = mixture_.alphah(pCells[celli], TCells[celli]);
+		}
 	}
 
+	this->setCellBlock(0, 0);
+
 	volScalarField::Boundary& pBf =
 		this->p_.boundaryFieldRef();
 
@@ -38,6 +38,7 @@ SourceFiles
 
 #include <point.hxx>
 #include <tensor.hxx>
+#include <threadedWave.hxx>
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
@@ -200,6 +201,14 @@ namespace tnbLib
 	}
 
 
+	//- The updates of minData do not read the mesh
+	template<>
+	inline bool threadedWave<minData>()
+	{
+		return true;
+	}
+
+
 	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
 } // End namespace tnbLib
@@ -29,7 +29,20 @@ Class
 	tnbLib::multiComponentMixture
 
 Description
-	tnbLib::multiComponentMixture
+	Mixture of the species thermodynamic data weighted by the mass fractions.
+
+	Species of mass fraction below the optional Ymin entry of the
+	thermophysical properties are left out of the mixture of a cell or
+	boundary face (default 0, all the species are included). Since the
+	mixture weights are normalised by the sum of the mass fractions included
+	the error is of the order of Ymin, while the cost of the mixture, which is
+	proportional to the number of species included, is much reduced in the
+	large parts of the domain where only a few species are present.
+
+	The mass fractions of every species are first scanned over the block of
+	cells set by setCellBlock, which is contiguous in each mass fraction
+	field, and the cellMixture of the cells of the block is then only
+	evaluated from the species present in the block.
 
 SourceFiles
 	multiComponentMixture.C
@@ -38,6 +51,7 @@ SourceFiles
 
 #include <basicSpecieMixture.hxx>
 #include <HashPtrTable.hxx>
+#include <DynamicList.hxx>
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
@@ -65,6 +79,19 @@ namespace tnbLib
 		//  cell/face mixture thermo data
 		mutable ThermoType mixtureVol_;
 
+		//- Mass fraction below which a species is left out of the mixture
+		scalar Ymin_;
+
+		//- Start of the block of cells of blockSpecies_
+		mutable label blockStart_;
+
+		//- End of the block of cells of blockSpecies_
+		mutable label blockEnd_;
+
+		//- Species with a mass fraction of at least Ymin_ in a cell of the
+		//  block
+		mutable DynamicList<label> blockSpecies_;
+
 
 		// Private Member Functions
 
@@ -75,6 +102,16 @@ namespace tnbLib
 		//- Correct the mass fractions to sum to 1
 		void correctMassFractions();
 
+		//- Set mixture_ to the species of the given list (all if nullptr)
+		//  of mass fraction of at least Ymin_. Returns false if there are
+		//  none.
+		template<class YFunction>
+		bool massWeightedMixture
+		(
+			const UList<label>* species,
+			const YFunction& Y
+		) const;
+
 		//- Construct as copy (not implemented)
 		multiComponentMixture(const multiComponentMixture<ThermoType>&);
 
@@ -115,6 +152,10 @@ namespace tnbLib
 			return "multiComponentMixture<" + ThermoType::typeName() + '>';
 		}
 
+		//- Set the block of cells [start, end) of the following cellMixture
+		//  calls and select the species present in the block
+		void setCellBlock(const label start, const label end) const;
+
 		const ThermoType& cellMixture(const label celli) const;
 
 		const ThermoType& patchFaceMixture
@@ -45,6 +45,41 @@ void tnbLib::multiComponentMixture<ThermoType>::correctMassFractions()
 }
 
 
+template<class ThermoType>
+template<class YFunction>
+bool tnbLib::multiComponentMixture<ThermoType>::massWeightedMixture
+(
+	const UList<label>* species,
+	const YFunction& Y
+) const
+{
+	bool found = false;
+
+	const label nSpecies = species ? species->size() : Y_.size();
+
+	for (label i = 0; i < nSpecies; i++)
+	{
+		const label n = species ? (*species)[i] : i;
+		const scalar Yn = Y(n);
+
+		if (Yn >= Ymin_)
+		{
+			if (found)
+			{
+				mixture_ += Yn * speciesData_[n];
+			}
+			else
+			{
+				mixture_ = Yn * speciesData_[n];
+				found = true;
+			}
+		}
+	}
+
+	return found;
+}
+
+
 // * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
 
 template<class ThermoType>
@@ -60,7 +95,10 @@ tnbLib::multiComponentMixture<ThermoType>::multiComponentMixture
 	basicSpecieMixture(thermoDict, specieNames, mesh, phaseName),
 	speciesData_(species_.size()),
 	mixture_("mixture", *thermoData[specieNames[0]]),
-	mixtureVol_("volMixture", *thermoData[specieNames[0]])
+	mixtureVol_("volMixture", *thermoData[specieNames[0]]),
+	Ymin_(thermoDict.lookupOrDefault<scalar>("Ymin", 0)),
+	blockStart_(0),
+	blockEnd_(0)
 {
 	forAll(species_, i)
 	{
@@ -92,7 +130,10 @@ tnbLib::multiComponentMixture<ThermoType>::multiComponentMixture
 	),
 	speciesData_(species_.size()),
 	mixture_("mixture", constructSpeciesData(thermoDict)),
-	mixtureVol_("volMixture", speciesData_[0])
+	mixtureVol_("volMixture", speciesData_[0]),
+	Ymin_(thermoDict.lookupOrDefault<scalar>("Ymin", 0)),
+	blockStart_(0),
+	blockEnd_(0)
 {
 	correctMassFractions();
 }
@@ -100,12 +141,60 @@ tnbLib::multiComponentMixture<ThermoType>::multiComponentMixture
 
 // * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
 
+template<class ThermoType>
+void tnbLib::multiComponentMixture<ThermoType>::setCellBlock
+(
+	const label start,
+	const label end
+) const
+{
+	blockStart_ = start;
+	blockEnd_ = end;
+
+	if (Ymin_ > 0)
+	{
+		blockSpecies_.clear();
+
+		forAll(Y_, n)
+		{
+			const scalarField& Yn = Y_[n];
+
+			for (label celli = start; celli < end; celli++)
+			{
+				if (Yn[celli] >= Ymin_)
+				{
+					blockSpecies_.append(n);
+					break;
+				}
+			}
+		}
+	}
+}
+
+
 template<class ThermoType>
 const ThermoType& tnbLib::multiComponentMixture<ThermoType>::cellMixture
 (
 	const label celli
 ) const
 {
+	if (Ymin_ > 0)
+	{
+		const bool inBlock = celli >= blockStart_ && celli < blockEnd_;
+
+		if
+		(
+			massWeightedMixture
+			(
+				inBlock ? &blockSpecies_ : nullptr,
+				[&](const label n){ return Y_[n][celli]; }
+			)
+		)
+		{
+			return mixture_;
+		}
+	}
+
 	mixture_ = Y_[0][celli] * speciesData_[0];
 
 	for (label n = 1; n < Y_.size(); n++)
@@ -124,6 +213,19 @@ const ThermoType& tnbLib::multiComponentMixture<ThermoType>::patchFaceMixture
 	const label facei
 ) const
 {
+	if
+	(
+		Ymin_ > 0
+	 && massWeightedMixture
+		(
+			nullptr,
+			[&](const label n){ return Y_[n].boundaryField()[patchi][facei]; }
+		)
+	)
+	{
+		return mixture_;
+	}
+
 	mixture_ = Y_[0].boundaryField()[patchi][facei] * speciesData_[0];
 
 	for (label n = 1; n < Y_.size(); n++)
@@ -200,6 +302,8 @@ void tnbLib::multiComponentMixture<ThermoType>::read
 	const dictionary& thermoDict
 )
 {
+	Ymin_ = thermoDict.lookupOrDefault<scalar>("Ymin", 0);
+
 	forAll(species_, i)
 	{
 		speciesData_[i] = ThermoType(thermoDict.subDict(species_[i]));
@@ -46,6 +46,7 @@ Description
 #include <polyMeshTetDecomposition.hxx>
 #include <particleMacros.hxx>
 #include <vectorTensorTransform.hxx>
+#include <particlePool.hxx>
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
@@ -384,6 +385,10 @@ namespace tnbLib
 		//- Cumulative particle counter - used to provide unique ID
 		static FoamLagrangian_EXPORT label particleCount_;
 
+		//- Use the tet transforms cached by the mesh for tracking on a
+		//  stationary mesh (optimisation switch cacheTetTransforms)
+		static FoamLagrangian_EXPORT bool cacheTetTransforms;
+
 
 		// Constructors
 
@@ -446,6 +451,22 @@ namespace tnbLib
 		{}
 
 
+		// Allocation
+
+			//- Allocate from the particle pool. See particlePool.
+		static void* operator new(std::size_t size)
+		{
+			return particlePool::allocate(size);
+		}
+
+		//- Return to the particle pool. The size is that of the dynamic
+		//  type as the destructor is virtual.
+		static void operator delete(void* ptr, std::size_t size)
+		{
+			particlePool::deallocate(ptr, size);
+		}
+
+
 		// Member Functions
 
 			// Access
@@ -686,6 +707,9 @@ namespace tnbLib
 			//- Map after a topology change
 		FoamLagrangian_EXPORT void autoMap(const vector& position, const mapPolyMesh& mapper);
 
+		//- Map to the given cell after a redistribution of the mesh
+		FoamLagrangian_EXPORT void autoMap(const vector& position, const label celli);
+
 
 		// I-O
 
@@ -44,6 +44,7 @@ SourceFiles
 #include <scalar.hxx>
 #include <tensor.hxx>
 #include <pTraits.hxx>
+#include <threadedWave.hxx>
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
@@ -241,6 +242,14 @@ namespace tnbLib
 	}
 
 
+	//- The updates of pointEdgePoint only read the points and edges
+	template<>
+	inline bool threadedWave<pointEdgePoint>()
+	{
+		return true;
+	}
+
+
 	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
 } // End namespace tnbLib
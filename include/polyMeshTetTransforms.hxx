@@ -0,0 +1,156 @@
+#pragma once
+#ifndef _polyMeshTetTransforms_Header
+#define _polyMeshTetTransforms_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+	tnbLib::polyMeshTetTransforms
+
+Description
+	Cache of the reverse barycentric transforms of all the tets of the
+	decomposition of the cells of a polyMesh.
+
+	The transform of a tet, the matrix of the cross products of its edges
+	which maps a displacement onto the barycentric coordinates scaled by
+	the determinant, and the determinant are stored together, 13 scalars
+	per tet, in one contiguous list ordered by face. The tets on the owner
+	side of all the faces come first, followed by the tets on the neighbour
+	side of the internal faces, so that the tets of a face crossing are
+	next to each other.
+
+	The cache is constructed on demand by polyMesh::tetTransforms() and
+	cleared with the mesh geometry, i.e. on movePoints and on topology
+	changes. It is used by the particle tracking for a stationary mesh if
+	the cacheTetTransforms optimisation switch is set.
+
+SourceFiles
+	polyMeshTetTransforms.cxx
+
+\*---------------------------------------------------------------------------*/
+
+#include <barycentricTensor.hxx>
+#include <vector.hxx>
+#include <labelList.hxx>
+#include <List.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	// Forward declaration of classes
+	class polyMesh;
+
+	/*---------------------------------------------------------------------------*\
+					   Class polyMeshTetTransforms Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class polyMeshTetTransforms
+	{
+	public:
+
+		//- Reverse transform of a tet and its determinant
+		struct transform
+		{
+			barycentricTensor T;
+			scalar detA;
+		};
+
+
+	private:
+
+		// Private Data
+
+			//- Reference to the face owners
+		const labelList& faceOwner_;
+
+		//- Start of the owner side tets of the faces
+		labelList ownerStart_;
+
+		//- Start of the neighbour side tets of the internal faces
+		labelList neighbourStart_;
+
+		//- Transforms of the tets
+		List<transform> transforms_;
+
+
+	public:
+
+		// Constructors
+
+			//- Construct from the mesh
+		FoamBase_EXPORT polyMeshTetTransforms(const polyMesh& mesh);
+
+		//- Disallow default bitwise copy construction
+		FoamBase_EXPORT polyMeshTetTransforms(const polyMeshTetTransforms&) = delete;
+
+
+		// Static Member Functions
+
+			//- Calculate the reverse transform and determinant of the tet
+			//  with the given (centre, base, vertex1, vertex2) transform
+		static inline void reverseTransform
+		(
+			const barycentricTensor& A,
+			scalar& detA,
+			barycentricTensor& T
+		);
+
+
+		// Member Functions
+
+			//- Return the number of cached tets
+		label size() const
+		{
+			return transforms_.size();
+		}
+
+		//- Return the transform of the tet with the given tet indices
+		inline const transform& operator()
+		(
+			const label celli,
+			const label facei,
+			const label tetPti
+		) const;
+
+
+		// Member Operators
+
+			//- Disallow default bitwise assignment
+		FoamBase_EXPORT void operator=(const polyMeshTetTransforms&) = delete;
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#include <polyMeshTetTransformsI.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_polyMeshTetTransforms_Header
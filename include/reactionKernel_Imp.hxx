@@ -0,0 +1,382 @@
+#pragma once
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+template<class ThermoType>
+tnbLib::label tnbLib::reactionKernel<ThermoType>::addArrhenius
+(
+	const ArrheniusReactionRate& k,
+	const Reaction<ThermoType>& R
+)
+{
+	A_.append(k.A());
+	beta_.append(k.temperatureExponent());
+	Ta_.append(k.Ta());
+	Tlow_.append(R.Tlow());
+	Thigh_.append(R.Thigh());
+
+	return A_.size() - 1;
+}
+
+
+template<class ThermoType>
+tnbLib::label tnbLib::reactionKernel<ThermoType>::addThirdBody
+(
+	const List<Tuple2<label, scalar>>& efficiencies
+)
+{
+	forAll(efficiencies, i)
+	{
+		if (efficiencies[i].second() != 1)
+		{
+			MSpecie_.append(efficiencies[i].first());
+			MEfficiency_.append(efficiencies[i].second() - 1);
+		}
+	}
+
+	MStart_.append(MSpecie_.size());
+
+	return MStart_.size() - 2;
+}
+
+
+template<class ThermoType>
+void tnbLib::reactionKernel<ThermoType>::addRate
+(
+	const ArrheniusReactionRate& k,
+	const Reaction<ThermoType>& R
+)
+{
+	k0_.append(addArrhenius(k, R));
+	kInf_.append(-1);
+	M_.append(-1);
+	F_.append(-1);
+	troeF_.append(false);
+}
+
+
+template<class ThermoType>
+void tnbLib::reactionKernel<ThermoType>::addRate
+(
+	const thirdBodyArrheniusReactionRate& k,
+	const Reaction<ThermoType>& R
+)
+{
+	k0_.append(addArrhenius(k.k(), R));
+	kInf_.append(-1);
+	M_.append(addThirdBody(k.beta()));
+	F_.append(-1);
+	troeF_.append(false);
+}
+
+
+template<class ThermoType>
+template<class FallOffFunction>
+void tnbLib::reactionKernel<ThermoType>::addRate
+(
+	const FallOffReactionRate<ArrheniusReactionRate, FallOffFunction>& k,
+	const Reaction<ThermoType>& R
+)
+{
+	k0_.append(addArrhenius(k.k0(), R));
+	kInf_.append(addArrhenius(k.kInf(), R));
+	M_.append(addThirdBody(k.beta()));
+	addFallOffFunction(k.F());
+}
+
+
+template<class ThermoType>
+void tnbLib::reactionKernel<ThermoType>::addFallOffFunction
+(
+	const LindemannFallOffFunction&
+)
+{
+	F_.append(-1);
+	troeF_.append(false);
+}
+
+
+template<class ThermoType>
+void tnbLib::reactionKernel<ThermoType>::addFallOffFunction
+(
+	const TroeFallOffFunction& F
+)
+{
+	F_.append(troe_.size());
+	troeF_.append(true);
+	troe_.append(&F);
+}
+
+
+template<class ThermoType>
+void tnbLib::reactionKernel<ThermoType>::addFallOffFunction
+(
+	const SRIFallOffFunction& F
+)
+{
+	F_.append(sri_.size());
+	troeF_.append(false);
+	sri_.append(&F);
+}
+
+
+template<class ThermoType>
+template<class ReactionRate>
+bool tnbLib::reactionKernel<ThermoType>::addReaction
+(
+	const Reaction<ThermoType>& R
+)
+{
+	typedef IrreversibleReaction<Reaction, ThermoType, ReactionRate>
+		irreversibleType;
+
+	typedef ReversibleReaction<Reaction, ThermoType, ReactionRate>
+		reversibleType;
+
+	if (isA<irreversibleType>(R))
+	{
+		addRate(refCast<const irreversibleType>(R).k(), R);
+		reversible_.append(false);
+	}
+	else if (isA<reversibleType>(R))
+	{
+		addRate(refCast<const reversibleType>(R).k(), R);
+		reversible_.append(true);
+	}
+	else
+	{
+		return false;
+	}
+
+	forAll(R.lhs(), i)
+	{
+		lhsSpecie_.append(R.lhs()[i].index);
+		lhsStoichCoeff_.append(R.lhs()[i].stoichCoeff);
+		lhsExponent_.append(R.lhs()[i].exponent);
+	}
+	lhsStart_.append(lhsSpecie_.size());
+
+	forAll(R.rhs(), i)
+	{
+		rhsSpecie_.append(R.rhs()[i].index);
+		rhsStoichCoeff_.append(R.rhs()[i].stoichCoeff);
+		rhsExponent_.append(R.rhs()[i].exponent);
+	}
+	rhsStart_.append(rhsSpecie_.size());
+
+	return true;
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+template<class ThermoType>
+tnbLib::reactionKernel<ThermoType>::reactionKernel
+(
+	const PtrList<Reaction<ThermoType>>& reactions
+)
+	:
+	reactions_(reactions),
+	MStart_(1, 0),
+	lhsStart_(1, 0),
+	rhsStart_(1, 0)
+{
+	forAll(reactions_, ri)
+	{
+		const Reaction<ThermoType>& R = reactions_[ri];
+
+		if
+		(
+			addReaction<ArrheniusReactionRate>(R)
+		 || addReaction<thirdBodyArrheniusReactionRate>(R)
+		 || addReaction
+			<
+				FallOffReactionRate
+				<
+					ArrheniusReactionRate,
+					LindemannFallOffFunction
+				>
+			>(R)
+		 || addReaction
+			<
+				FallOffReactionRate<ArrheniusReactionRate, TroeFallOffFunction>
+			>(R)
+		 || addReaction
+			<
+				FallOffReactionRate<ArrheniusReactionRate, SRIFallOffFunction>
+			>(R)
+		)
+		{
+			kernelReactions_.append(ri);
+		}
+		else
+		{
+			otherReactions_.append(ri);
+		}
+	}
+
+	kernelReactions_.shrink();
+	otherReactions_.shrink();
+	reversible_.shrink();
+	k0_.shrink();
+	kInf_.shrink();
+	M_.shrink();
+	F_.shrink();
+	troeF_.shrink();
+	troe_.shrink();
+	sri_.shrink();
+	A_.shrink();
+	beta_.shrink();
+	Ta_.shrink();
+	Tlow_.shrink();
+	Thigh_.shrink();
+	MStart_.shrink();
+	MSpecie_.shrink();
+	MEfficiency_.shrink();
+	lhsStart_.shrink();
+	lhsSpecie_.shrink();
+	lhsStoichCoeff_.shrink();
+	lhsExponent_.shrink();
+	rhsStart_.shrink();
+	rhsSpecie_.shrink();
+	rhsStoichCoeff_.shrink();
+	rhsExponent_.shrink();
+
+	work_.setSize(A_.size() + MStart_.size() - 1);
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+template<class ThermoType>
+void tnbLib::reactionKernel<ThermoType>::setNThreads
+(
+	const label nThreads
+) const
+{
+	const label nOld = threadWork_.size();
+
+	threadWork_.setSize(max(nThreads - 1, 0));
+
+	for (label threadi = nOld; threadi < threadWork_.size(); threadi++)
+	{
+		threadWork_.set(threadi, new scalarField(work_.size()));
+	}
+}
+
+
+template<class ThermoType>
+void tnbLib::reactionKernel<ThermoType>::omega
+(
+	const scalar p,
+	const scalar T,
+	const scalarField& c,
+	scalarField& dcdt
+) const
+{
+	scalarField& w = work();
+
+	// Arrhenius rates at the temperature clipped to the limits of their
+	// reactions
+	const label nk = A_.size();
+
+	for (label i = 0; i < nk; i++)
+	{
+		const scalar Ti = min(max(T, Tlow_[i]), Thigh_[i]);
+		w[i] = A_[i]*exp(beta_[i]*log(Ti) - Ta_[i]/Ti);
+	}
+
+	// Third-body concentrations from the total concentration corrected
+	// for the efficiencies which differ from one
+	scalar sumC = 0;
+	forAll(c, i)
+	{
+		sumC += c[i];
+	}
+
+	for (label m = 0; m < MStart_.size() - 1; m++)
+	{
+		scalar M = sumC;
+
+		for (label j = MStart_[m]; j < MStart_[m + 1]; j++)
+		{
+			M += MEfficiency_[j]*c[MSpecie_[j]];
+		}
+
+		w[nk + m] = M;
+	}
+
+	forAll(kernelReactions_, r)
+	{
+		const Reaction<ThermoType>& R = reactions_[kernelReactions_[r]];
+
+		const scalar Tr = min(max(T, R.Tlow()), R.Thigh());
+
+		scalar kf = w[k0_[r]];
+
+		if (M_[r] != -1)
+		{
+			const scalar M = w[nk + M_[r]];
+
+			if (kInf_[r] == -1)
+			{
+				kf *= M;
+			}
+			else
+			{
+				const scalar kInf = w[kInf_[r]];
+				const scalar Pr = kf*M/kInf;
+
+				kf = kInf*(Pr/(1 + Pr));
+
+				if (F_[r] != -1)
+				{
+					kf *=
+						troeF_[r]
+					  ? (*troe_[F_[r]])(Tr, Pr)
+					  : (*sri_[F_[r]])(Tr, Pr);
+				}
+			}
+		}
+
+		const scalar kr =
+			reversible_[r] ? kf/max(R.Kc(p, Tr), rootSmall) : 0;
+
+		const scalar omegaI =
+			kf
+		   *concentrationProduct
+			(
+				lhsStart_[r],
+				lhsStart_[r + 1],
+				lhsSpecie_,
+				lhsExponent_,
+				c
+			)
+		  - kr
+		   *concentrationProduct
+			(
+				rhsStart_[r],
+				rhsStart_[r + 1],
+				rhsSpecie_,
+				rhsExponent_,
+				c
+			);
+
+		for (label s = lhsStart_[r]; s < lhsStart_[r + 1]; s++)
+		{
+			dcdt[lhsSpecie_[s]] -= lhsStoichCoeff_[s]*omegaI;
+		}
+
+		for (label s = rhsStart_[r]; s < rhsStart_[r + 1]; s++)
+		{
+			dcdt[rhsSpecie_[s]] += rhsStoichCoeff_[s]*omegaI;
+		}
+	}
+
+	forAll(otherReactions_, i)
+	{
+		reactions_[otherReactions_[i]].omega(p, T, c, dcdt);
+	}
+}
+
+
+// ************************************************************************* //
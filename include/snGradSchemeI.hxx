@@ -99,6 +99,7 @@ namespace tnbLib
 					)
 			);
 			GeometricField<Type, fvsPatchField, surfaceMesh>& ssf = tsf.ref();
+			ssf.oriented() = true;
 
 			// set reference to difference factors array
 			const scalarField& deltaCoeffs = tdeltaCoeffs();
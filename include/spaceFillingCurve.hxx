@@ -0,0 +1,76 @@
+#pragma once
+#ifndef _spaceFillingCurve_Header
+#define _spaceFillingCurve_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+InNamespace
+	tnbLib
+
+Description
+	Orderings of points along the Hilbert and Morton (Z-order) space-filling
+	curves.
+
+	The points are quantised on a 2^21 lattice spanning the cube enclosing
+	their local bounding box and sorted by their 63-bit curve key. Points that
+	are close along the curve are close in space, so the ordering clusters
+	the cells that share data irrespective of the mesh connectivity. The
+	Hilbert curve has no jumps between consecutive lattice cells and
+	therefore gives the better locality; the Morton key is cheaper.
+
+	The ordering only depends on the points given, no communication is
+	required, and it may be called independently on each processor.
+
+SourceFiles
+	spaceFillingCurve.C
+
+\*---------------------------------------------------------------------------*/
+
+#include <pointField.hxx>
+#include <uint64.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	//- Return the Hilbert key of the point within the given bounds
+	FoamBase_EXPORT uint64_t hilbertKey(const point& pt, const point& min, const scalar span);
+
+	//- Return the Morton key of the point within the given bounds
+	FoamBase_EXPORT uint64_t mortonKey(const point& pt, const point& min, const scalar span);
+
+	//- Return the order in which the points are visited by the Hilbert
+	//  curve (i.e. ordered to original)
+	FoamBase_EXPORT labelList hilbertOrder(const UList<point>& points);
+
+	//- Return the order in which the points are visited by the Morton
+	//  curve (i.e. ordered to original)
+	FoamBase_EXPORT labelList mortonOrder(const UList<point>& points);
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_spaceFillingCurve_Header
@@ -89,6 +89,10 @@ namespace tnbLib
 		//- Construct non-orthogonality correction vectors
 		FoamFiniteVolume_EXPORT void makeNonOrthCorrectionVectors() const;
 
+		//- Update the allocated geometric coefficients of the faces whose
+		//  geometry changed in an incremental mesh geometry update
+		FoamFiniteVolume_EXPORT void updateGeomChangedFaces() const;
+
 
 	protected:
 
@@ -248,6 +248,7 @@ tnbLib::surfaceInterpolationScheme<Type>::dotInterpolate
 			)
 	);
 	GeometricField<RetType, fvsPatchField, surfaceMesh>& sf = tsf.ref();
+	sf.oriented() = Sf.oriented();
 
 	Field<RetType>& sfi = sf.primitiveFieldRef();
 
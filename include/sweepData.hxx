@@ -41,6 +41,7 @@ SourceFiles
 
 #include <scalar.hxx> // added by amir
 #include <point.hxx>  // added by amir
+#include <threadedWave.hxx>
 
 namespace tnbLib
 {
@@ -225,6 +226,14 @@ namespace tnbLib
 	}
 
 
+	//- The updates of sweepData only read the cell and face centres
+	template<>
+	inline bool threadedWave<sweepData>()
+	{
+		return true;
+	}
+
+
 
 	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
@@ -48,6 +48,13 @@ inline tnbLib::thirdBodyArrheniusReactionRate::thirdBodyArrheniusReactionRate
 
 // * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
 
+inline const tnbLib::ArrheniusReactionRate&
+tnbLib::thirdBodyArrheniusReactionRate::k() const
+{
+	return *this;
+}
+
+
 inline tnbLib::scalar tnbLib::thirdBodyArrheniusReactionRate::operator()
 (
 	const scalar p,
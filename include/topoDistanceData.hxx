@@ -39,6 +39,7 @@ SourceFiles
 
 #include <point.hxx>
 #include <tensor.hxx>
+#include <threadedWave.hxx>
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
@@ -213,6 +214,14 @@ namespace tnbLib
 	}
 
 
+	//- The updates of topoDistanceData do not read the mesh
+	template<>
+	inline bool threadedWave<topoDistanceData>()
+	{
+		return true;
+	}
+
+
 	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
 } // End namespace tnbLib
@@ -29,6 +29,7 @@ namespace tnbLib
 			trf.boundaryField(),
 			tf.boundaryField()
 		);
+		rtf.oriented() = tf.oriented();
 	}
 
 
@@ -108,6 +109,7 @@ namespace tnbLib
 	{
 		transform(rtf.primitiveFieldRef(), t.value(), tf.primitiveField());
 		transform(rtf.boundaryFieldRef(), t.value(), tf.boundaryField());
+		rtf.oriented() = tf.oriented();
 	}
 
 